@@ -17,6 +17,7 @@ export MODULES_DIR := $(TOP_DIR)/module
 export DOC_DIR := $(TOP_DIR)/doc
 export MOD_TEST_DIR := $(TOP_DIR)/unit_test
 export MOD_TEST_BUILD_DIR=$(BUILD_DIR)/module/test
+export MOD_BENCHMARK_BUILD_DIR=$(BUILD_DIR)/module/benchmark
 export FWK_TEST_DIR=$(FWK_DIR)/test
 export FWK_TEST_BUILD_DIR=$(BUILD_DIR)/framework/test
 export PROD_TEST_DIR := $(TOP_DIR)/product/test
@@ -133,7 +134,8 @@ PRODUCTS := $(sort $(shell find product -name "product.mk" -printf "%h\n" | cut
 #
 DEPRECATED_PLATFORMS := tc2
 
-PRODUCT_INDEPENDENT_GOALS := clean help test doc fwk_test mod_test prod_test
+PRODUCT_INDEPENDENT_GOALS := clean help test doc fwk_test mod_test prod_test \
+                             mod_benchmark
 
 ifneq ($(filter-out $(PRODUCT_INDEPENDENT_GOALS), $(MAKECMDGOALS)),)
     ifeq ($(PRODUCT),)
@@ -227,6 +229,7 @@ help:
 	@echo "    clean           Remove all built products"
 	@echo "    fwk_test        Build and runs framework unit tests"
 	@echo "    mod_test        Build and runs module unit tests"
+	@echo "    mod_benchmark   Build and runs module host benchmarks"
 	@echo "    help            Show this documentation"
 	@echo "    doc             Generate the documentation of this project with Doxygen"
 	@echo ""
@@ -364,6 +367,11 @@ ifeq ($(ENABLE_COVERAGE),y)
 	${CD} $(MOD_TEST_BUILD_DIR) && $(GENHTML) scp_v2_unit_test_coverage_filtered.info --prefix "$(TOP_DIR)" --output-directory $(MOD_TEST_BUILD_DIR)/coverage_report
 endif
 
+.PHONY: mod_benchmark
+mod_benchmark:
+	$(CMAKE) -B $(MOD_BENCHMARK_BUILD_DIR) $(MOD_TEST_DIR) -G Ninja -DUNIT_TEST_BENCHMARKS=ON
+	$(CMAKE) --build $(MOD_BENCHMARK_BUILD_DIR) --target unit_test_benchmarks
+
 .PHONY: prod_test
 prod_test:
 	$(CMAKE) -B $(PROD_TEST_BUILD_DIR) $(PROD_TEST_DIR) -G Ninja
@@ -328,6 +328,12 @@ extern const char checkpoint_call[];
 extern const char checkpoint_help[];
 extern int32_t checkpoint_f(int32_t argc, char **argv);
 
+#ifdef FWK_EVENT_PROFILE_ENABLE
+extern const char event_profile_call[];
+extern const char event_profile_help[];
+extern int32_t event_profile_f(int32_t argc, char **argv);
+#endif
+
 /* The last parameter in each of the commands below indicates whether the */
 /* command handles its own help or not.  Right now, the PCIe/CCIX commands */
 /* are the only ones that do that. */
@@ -341,6 +347,9 @@ cli_command_st cli_commands[] = {
     { reset_sys_call, reset_sys_help, &reset_sys_f, false },
     { uptime_call, uptime_help, &uptime_f, false },
     { checkpoint_call, checkpoint_help, &checkpoint_f, false },
+#ifdef FWK_EVENT_PROFILE_ENABLE
+    { event_profile_call, event_profile_help, &event_profile_f, false },
+#endif
 
     /* End of commands. */
     { 0, 0, 0 }
@@ -0,0 +1,131 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cli.h>
+
+#include <fwk_event_profile.h>
+#include <fwk_id.h>
+#include <fwk_io.h>
+#include <fwk_status.h>
+#include <fwk_time.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+const char event_profile_call[] = "evprof";
+const char event_profile_help[] =
+    "  Show the queue-wait and handler times of each event, in microseconds.\n"
+    "    Usage: evprof list\n"
+    "  Show the duration histograms of one entry of the list.\n"
+    "    Usage: evprof hist <entry>\n"
+    "  Write the profile to the console in binary form.\n"
+    "    Usage: evprof dump\n"
+    "  Clear the profile.\n"
+    "    Usage: evprof reset";
+
+/* The CLI formatter only handles 32-bit decimal values */
+static int32_t to_us(uint64_t duration)
+{
+    uint64_t us = duration / FWK_US(1);
+
+    return (us > INT32_MAX) ? INT32_MAX : (int32_t)us;
+}
+
+static int32_t average_us(
+    const struct fwk_event_profile_histogram *histogram,
+    uint64_t count)
+{
+    return (count == 0) ? 0 : to_us(histogram->total / count);
+}
+
+static void event_profile_list(void)
+{
+    unsigned int entry_count, index;
+    uint32_t dropped;
+    struct fwk_event_profile_entry entry;
+
+    (void)fwk_event_profile_get_count(&entry_count, &dropped);
+
+    cli_printf(
+        NONE,
+        "%d entries, %d events dropped\n",
+        (int32_t)entry_count,
+        (int32_t)dropped);
+    cli_print("  #  target  event  count  wait avg/max  run avg/max\n");
+
+    for (index = 0; index < entry_count; index++) {
+        if (fwk_event_profile_get_entry(index, &entry) != FWK_SUCCESS) {
+            break;
+        }
+
+        cli_printf(
+            NONE,
+            "%3d  %s  %s  %d  %d/%d  %d/%d\n",
+            (int32_t)index,
+            FWK_ID_STR(entry.target_id),
+            FWK_ID_STR(entry.event_id),
+            (int32_t)entry.count,
+            average_us(&entry.wait, entry.count),
+            to_us(entry.wait.max),
+            average_us(&entry.handler, entry.count),
+            to_us(entry.handler.max));
+    }
+}
+
+static int32_t event_profile_hist(unsigned int index)
+{
+    unsigned int bucket;
+    struct fwk_event_profile_entry entry;
+
+    if (fwk_event_profile_get_entry(index, &entry) != FWK_SUCCESS) {
+        cli_print("Entry out of range.\n");
+        return FWK_E_RANGE;
+    }
+
+    cli_printf(
+        NONE,
+        "%s -> %s\n",
+        FWK_ID_STR(entry.event_id),
+        FWK_ID_STR(entry.target_id));
+    cli_print("  bucket (us)      wait       run\n");
+
+    for (bucket = 0; bucket < FWK_EVENT_PROFILE_BUCKET_COUNT; bucket++) {
+        cli_printf(
+            NONE,
+            "  < %d  %d  %d\n",
+            (int32_t)(UINT32_C(1) << bucket),
+            (int32_t)entry.wait.buckets[bucket],
+            (int32_t)entry.handler.buckets[bucket]);
+    }
+
+    return FWK_SUCCESS;
+}
+
+int32_t event_profile_f(int32_t argc, char **argv)
+{
+    if ((argc == 2) && (cli_strncmp(argv[1], "list", 4) == 0)) {
+        event_profile_list();
+        return FWK_SUCCESS;
+    }
+
+    else if ((argc == 3) && (cli_strncmp(argv[1], "hist", 4) == 0)) {
+        return event_profile_hist(strtoul(argv[2], NULL, 0));
+    }
+
+    else if ((argc == 2) && (cli_strncmp(argv[1], "dump", 4) == 0)) {
+        return fwk_event_profile_write(fwk_io_stdout);
+    }
+
+    else if ((argc == 2) && (cli_strncmp(argv[1], "reset", 5) == 0)) {
+        fwk_event_profile_reset();
+        return FWK_SUCCESS;
+    }
+
+    cli_print("CLI: Invalid command received.\n");
+
+    return FWK_E_PARAM;
+}
@@ -67,11 +67,49 @@
              : __fwk_put_event, struct fwk_event_light * \
              : __fwk_put_event_light)(event)
 
+/*!
+ * \brief Event queue residency statistics of a priority class.
+ */
+struct fwk_event_queue_stats {
+    /*! Number of events processed from the class */
+    uint32_t event_count;
+
+    /*! Cumulative time spent queued by these events, in nanoseconds */
+    uint64_t total_residency;
+
+    /*! Longest time spent queued by a single event, in nanoseconds */
+    uint64_t max_residency;
+};
+
 /*!
  * \brief Processing events already raised by modules and interrupt handlers.
+ *
+ * \details Events raised by interrupt handlers are moved to the event queues
+ *      in batches, and the next event processed is always taken from the most
+ *      urgent non-empty priority class.
  */
 void fwk_process_event_queue(void);
 
+/*!
+ * \brief Get the queue residency statistics of an event priority class.
+ *
+ * \details The residency of an event is the time between the event being
+ *      queued, including time spent in the ISR event queue, and the framework
+ *      starting to process it. Statistics are only gathered when the framework
+ *      is built with \c FWK_EVENT_QUEUE_STATS_ENABLE defined.
+ *
+ * \param priority Priority class.
+ * \param[out] stats Statistics of the priority class.
+ *
+ * \retval ::FWK_SUCCESS The statistics were returned.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ * \retval ::FWK_E_SUPPORT Statistics are not gathered in this build.
+ * \return Status code representing the result of the operation.
+ */
+int fwk_get_event_queue_stats(
+    enum fwk_event_priority priority,
+    struct fwk_event_queue_stats *stats);
+
 /*!
  * \brief Get a copy of a delayed response event.
  *
@@ -37,6 +37,31 @@
  */
 #define FWK_EVENT_PARAMETERS_SIZE 16
 
+/*!
+ * \brief Event priority classes.
+ *
+ * \details The framework keeps one event queue per priority class and always
+ *      processes the next event of the most urgent non-empty class, in the
+ *      order high, normal, low. Events within a class are processed in the
+ *      order they were queued.
+ *
+ *      Modules declare the class of the events they process through
+ *      ::fwk_module::event_priority and ::fwk_module::event_priorities.
+ */
+enum fwk_event_priority {
+    /*! Default class */
+    FWK_EVENT_PRIORITY_NORMAL,
+
+    /*! Latency-sensitive requests, such as SCMI or PLDM commands */
+    FWK_EVENT_PRIORITY_HIGH,
+
+    /*! Background work, such as statistics or periodic polling */
+    FWK_EVENT_PRIORITY_LOW,
+
+    /*! Number of priority classes */
+    FWK_EVENT_PRIORITY_COUNT,
+};
+
 /*!
  * \brief Event.
  *
@@ -87,6 +112,14 @@ struct fwk_event {
      */
     fwk_id_t id;
 
+#ifdef FWK_EVENT_TIMESTAMP_ENABLE
+    /*!
+     * \internal
+     * \brief Time at which the event was queued, in nanoseconds.
+     */
+    uint64_t queued_at;
+#endif
+
     /*! Table of event parameters */
     alignas(max_align_t) uint8_t params[FWK_EVENT_PARAMETERS_SIZE];
 };
@@ -0,0 +1,187 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Event latency and handler cost profiler.
+ */
+
+#ifndef FWK_EVENT_PROFILE_H
+#define FWK_EVENT_PROFILE_H
+
+#include <fwk_id.h>
+#include <fwk_io.h>
+#include <fwk_macros.h>
+
+#include <stdint.h>
+
+#if FWK_HAS_INCLUDE(<fmw_event_profile.h>)
+#    include <fmw_event_profile.h> /* cppcheck-suppress missingIncludeSystem */
+#endif
+
+/*!
+ * \addtogroup GroupLibFramework Framework
+ * \{
+ */
+
+/*!
+ * \defgroup GroupEventProfile Event profiler
+ *
+ * \details When the framework is built with \c FWK_EVENT_PROFILE_ENABLE
+ *      defined (\c SCP_ENABLE_FWK_EVENT_PROFILING), every event processed by
+ *      the framework is timestamped when it is queued, when its handler is
+ *      called and when its handler returns. The time spent queued and the time
+ *      spent in the handler are accumulated in histograms kept for each pair
+ *      of target module and event identifier.
+ *
+ * \{
+ */
+
+/*!
+ * \def FMW_EVENT_PROFILE_ENTRY_MAX
+ *
+ * \brief Maximum number of (target module, event) pairs profiled.
+ *
+ * \details Events for pairs seen after the table is full are counted as
+ *      dropped.
+ */
+#ifndef FMW_EVENT_PROFILE_ENTRY_MAX
+#    define FMW_EVENT_PROFILE_ENTRY_MAX 64
+#endif
+
+/*!
+ * \brief Number of buckets in a profile histogram.
+ *
+ * \details Bucket zero counts durations below one microsecond. Bucket \c n
+ *      counts durations from \c 2^(n-1) up to \c 2^n microseconds. The last
+ *      bucket also counts every longer duration.
+ */
+#define FWK_EVENT_PROFILE_BUCKET_COUNT 16
+
+/*!
+ * \brief Magic number at the start of a binary profile dump ("EVPF").
+ */
+#define FWK_EVENT_PROFILE_MAGIC UINT32_C(0x46505645)
+
+/*!
+ * \brief Version of the binary profile dump format.
+ */
+#define FWK_EVENT_PROFILE_VERSION 1
+
+/*!
+ * \brief Duration histogram.
+ */
+struct fwk_event_profile_histogram {
+    /*! Sum of all durations, in nanoseconds */
+    uint64_t total;
+
+    /*! Longest duration, in nanoseconds */
+    uint64_t max;
+
+    /*! Number of durations falling in each bucket */
+    uint32_t buckets[FWK_EVENT_PROFILE_BUCKET_COUNT];
+};
+
+/*!
+ * \brief Profile of the events of one identifier sent to one module.
+ *
+ * \details This structure contains no padding and is written as-is to binary
+ *      profile dumps.
+ */
+struct fwk_event_profile_entry {
+    /*! Identifier of the target module */
+    fwk_id_t target_id;
+
+    /*! Identifier of the event or notification */
+    fwk_id_t event_id;
+
+    /*! Number of events processed */
+    uint64_t count;
+
+    /*! Time between the event being queued and its handler being called */
+    struct fwk_event_profile_histogram wait;
+
+    /*! Time spent in the handler */
+    struct fwk_event_profile_histogram handler;
+};
+
+/*!
+ * \brief Header of a binary profile dump.
+ *
+ * \details The header is followed by \ref entry_count entries of type
+ *      ::fwk_event_profile_entry, in native byte order.
+ */
+struct fwk_event_profile_header {
+    /*! ::FWK_EVENT_PROFILE_MAGIC */
+    uint32_t magic;
+
+    /*! ::FWK_EVENT_PROFILE_VERSION */
+    uint16_t version;
+
+    /*! ::FWK_EVENT_PROFILE_BUCKET_COUNT */
+    uint16_t bucket_count;
+
+    /*! Number of entries that follow */
+    uint32_t entry_count;
+
+    /*! Number of events that could not be profiled as the table was full */
+    uint32_t dropped;
+};
+
+/*!
+ * \brief Get the number of profiled (target module, event) pairs.
+ *
+ * \param[out] entry_count Number of entries in the profile table.
+ * \param[out] dropped Number of events that could not be profiled because the
+ *      table was full. May be \c NULL.
+ *
+ * \retval ::FWK_SUCCESS The counts were returned.
+ * \retval ::FWK_E_PARAM \p entry_count is \c NULL.
+ * \return Status code representing the result of the operation.
+ */
+int fwk_event_profile_get_count(unsigned int *entry_count, uint32_t *dropped);
+
+/*!
+ * \brief Get a copy of a profile table entry.
+ *
+ * \param index Index of the entry, in the order entries were created.
+ * \param[out] entry Copy of the entry.
+ *
+ * \retval ::FWK_SUCCESS The entry was returned.
+ * \retval ::FWK_E_PARAM \p entry is \c NULL.
+ * \retval ::FWK_E_RANGE \p index is beyond the last entry.
+ * \return Status code representing the result of the operation.
+ */
+int fwk_event_profile_get_entry(
+    unsigned int index,
+    struct fwk_event_profile_entry *entry);
+
+/*!
+ * \brief Clear the profile table.
+ */
+void fwk_event_profile_reset(void);
+
+/*!
+ * \brief Write the profile table to a stream in binary form.
+ *
+ * \details Writes a ::fwk_event_profile_header followed by every entry of the
+ *      table.
+ *
+ * \param[in] stream Stream to write to.
+ *
+ * \retval ::FWK_SUCCESS The profile was written.
+ * \return One of the status codes returned by ::fwk_io_write.
+ */
+int fwk_event_profile_write(const struct fwk_io_stream *stream);
+
+/*!
+ * \}
+ */
+
+/*!
+ * \}
+ */
+
+#endif /* FWK_EVENT_PROFILE_H */
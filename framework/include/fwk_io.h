@@ -182,6 +182,65 @@ struct fwk_io_adapter {
      */
     int (*putch)(const struct fwk_io_stream *stream, char ch);
 
+    /*!
+     * \brief Read a block of characters from the stream.
+     *
+     * \details Fetch up to `size` characters from the stream without waiting
+     *      for more to arrive. The number of characters fetched is returned
+     *      through `read`.
+     *
+     *      The `stream`, `buffer` and `read` parameters are guaranteed to be
+     *      non-null, and `size` is guaranteed to be non-zero.
+     *
+     * \note This field may be set to a null pointer value, in which case
+     *      blocks are read using the `getch` operation.
+     *
+     * \param[in] stream Stream to read from.
+     * \param[out] buffer Storage for the characters read from the stream.
+     * \param[in] size Maximum number of characters to read.
+     * \param[out] read Number of characters read from the stream.
+     *
+     * \return Status code representing the result of the operation.
+     *
+     * \retval ::FWK_SUCCESS At least one character was successfully read.
+     * \retval ::FWK_PENDING There are no more characters to read.
+     */
+    int (*read)(
+        const struct fwk_io_stream *stream,
+        char *buffer,
+        size_t size,
+        size_t *read);
+
+    /*!
+     * \brief Write a block of characters to the stream.
+     *
+     * \details Write up to `size` characters to the stream without waiting for
+     *      the resource to become available. The number of characters accepted
+     *      is returned through `written`.
+     *
+     *      The `stream`, `buffer` and `written` parameters are guaranteed to be
+     *      non-null, and `size` is guaranteed to be non-zero.
+     *
+     * \note This field may be set to a null pointer value, in which case
+     *      blocks are written using the `putch` operation.
+     *
+     * \param[in] stream Stream to write to.
+     * \param[in] buffer Characters to write to the stream.
+     * \param[in] size Number of characters to write.
+     * \param[out] written Number of characters written to the stream.
+     *
+     * \return Status code representing the result of the operation.
+     *
+     * \retval ::FWK_SUCCESS At least one character was successfully written.
+     * \retval ::FWK_E_BUSY The resource is currently unavailable and it cannot
+     *      accept new characters.
+     */
+    int (*write)(
+        const struct fwk_io_stream *stream,
+        const char *buffer,
+        size_t size,
+        size_t *written);
+
     /*!
      * \brief Close the stream.
      *
@@ -339,6 +398,38 @@ int fwk_io_putch(const struct fwk_io_stream *stream, char ch);
  */
 int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch);
 
+/*!
+ * \brief Write a block of characters to a stream without waiting.
+ *
+ * \details Writes as many characters from `buffer` to the output stream
+ *      `stream` as it can accept without waiting. If the driver becomes busy
+ *      before the whole block is written, `FWK_E_BUSY` is returned and
+ *      `written` holds the number of characters that were accepted, so that
+ *      the caller can retry the remainder later.
+ *
+ * \param[in] stream Stream to write to.
+ * \param[out] written Number of characters written.
+ * \param[in] buffer Characters to write.
+ * \param[in] size Number of characters to write.
+ *
+ * \return Status code representing the result of the operation.
+ *
+ * \retval ::FWK_SUCCESS All the characters were successfully written.
+ * \retval ::FWK_E_BUSY Only part of the block was written.
+ * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+ *      - The `stream` parameter was a null pointer value.
+ *      - The `written` parameter was a null pointer value.
+ *      - The `buffer` parameter was a null pointer value.
+ * \retval ::FWK_E_STATE The `stream` has already been closed.
+ * \retval ::FWK_E_SUPPORT The `stream` was not opened with write access.
+ * \retval ::FWK_E_HANDLER The `stream` adapter encountered an error.
+ */
+int fwk_io_write_nowait(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict written,
+    const void *restrict buffer,
+    size_t size);
+
 /*!
  * \brief Read data from a stream.
  *
@@ -348,6 +439,9 @@ int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch);
  *      in the order they are read. The `read` parameter is updated with the
  *      number of objects successfully read.
  *
+ *      If the stream adapter implements the block read operation, the data is
+ *      fetched in as few calls to the adapter as possible.
+ *
  *      If the `read` parameter is a null pointer value, the function will
  *      return an ::FWK_E_DATA error if the operation completes successfully but
  *      the number of objects read is less than `count`. This error is not
@@ -386,6 +480,9 @@ int fwk_io_read(
  *      `size` times for each object, in order. The `written` parameter is
  *      optional, and may be set to a null pointer value.
  *
+ *      If the stream adapter implements the block write operation, the data is
+ *      written in as few calls to the adapter as possible.
+ *
  * \param[in] stream Output stream.
  * \param[out] written Number of objects written.
  * \param[in] buffer Pointer to the first object in the array to be written.
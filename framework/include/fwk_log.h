@@ -56,6 +56,9 @@
  *      ::FMW_LOG_DRAIN_ID. The default behaviour resorts to using the entity
  *      described by ::FMW_IO_STDOUT_ID as the logging device.
  *
+ *      The cost of formatting buffered messages can also be moved to the
+ *      drain by defining ::FMW_LOG_DEFERRED.
+ *
  *      If a message is too large to fit into the remaining space of the
  *      internal buffer, the message will be dropped.
  *
@@ -113,6 +116,48 @@
 #    define FWK_LOG_BUFFERED
 #endif
 
+/*!
+ * \def FMW_LOG_DEFERRED
+ *
+ * \brief Defer the formatting of buffered messages to the log drain.
+ *
+ * \details When this is defined and buffering is enabled, a log call stores
+ *      the timestamp, the format string pointer and the raw arguments of the
+ *      message in the buffer. The message is formatted when it is drained by
+ *      ::fwk_log_unbuffer, outside of the critical section, rather than by
+ *      the caller.
+ *
+ *      Only integer, character and pointer conversions are deferred. Messages
+ *      using any other conversion, such as `%s`, or needing more than
+ *      ::FMW_LOG_DEFERRED_ARGS_MAX argument words are formatted immediately.
+ *
+ * \warning The format string must remain valid until the message has been
+ *      drained, which is always the case for string literals.
+ */
+
+/*!
+ * \def FMW_LOG_DEFERRED_ARGS_MAX
+ *
+ * \brief Maximum number of 32-bit argument words stored for a deferred
+ *      message.
+ *
+ * \note This definition has a default value of `8`.
+ */
+
+#ifndef FMW_LOG_DEFERRED_ARGS_MAX
+#    define FMW_LOG_DEFERRED_ARGS_MAX 8
+#endif
+
+#if defined(FMW_LOG_DEFERRED) && defined(FWK_LOG_BUFFERED)
+/*!
+ * \def FWK_LOG_DEFERRED
+ *
+ * \brief Determines whether the formatting of buffered messages is deferred
+ *      to the log drain.
+ */
+#    define FWK_LOG_DEFERRED
+#endif
+
 /*!
  * \def FMW_LOG_COLUMNS
  *
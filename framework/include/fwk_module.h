@@ -81,6 +81,25 @@ struct fwk_module {
     /*! Number of events defined by the module */
     unsigned int event_count;
 
+    /*!
+     * \brief Priority class of the events processed by the module.
+     *
+     * \details Applies to every event, response and notification targeting the
+     *      module, unless overridden by ::fwk_module::event_priorities. Defaults
+     *      to ::FWK_EVENT_PRIORITY_NORMAL.
+     */
+    enum fwk_event_priority event_priority;
+
+    /*!
+     * \brief Optional per-event priority classes.
+     *
+     * \details When provided, this table holds one entry for each of the
+     *      ::fwk_module::event_count events defined by the module, giving the
+     *      priority class of requests for that event. Responses and
+     *      notifications still use ::fwk_module::event_priority.
+     */
+    const enum fwk_event_priority *event_priorities;
+
     #ifdef BUILD_HAS_NOTIFICATION
     /*! Number of notifications defined by the module */
     unsigned int notification_count;
@@ -50,7 +50,7 @@
  * \retval ::FWK_E_PARAM One or more identifiers were invalid.
  * \retval ::FWK_E_STATE The entity \p target_id has already subscribed to the
  *      notification \p notification_id from the entity \p source_id.
- * \retval ::FWK_E_NOMEM The maximum number of subscriptions has been reached.
+ * \retval ::FWK_E_NOMEM The subscription could not be stored.
  */
 int fwk_notification_subscribe(fwk_id_t notification_id, fwk_id_t source_id,
                                fwk_id_t target_id);
@@ -8,6 +8,7 @@
 #ifndef FWK_INTERNAL_CONTEXT_H
 #define FWK_INTERNAL_CONTEXT_H
 
+#include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_list.h>
 
@@ -35,8 +36,13 @@ struct __fwk_ctx {
     /* Queue of events, generated by ISRs, that are awaiting processing */
     struct fwk_slist isr_event_queue;
 
-    /* Queue of events that are awaiting processing */
-    struct fwk_slist event_queue;
+    /* Queues of events that are awaiting processing, one per priority class */
+    struct fwk_slist event_queue[FWK_EVENT_PRIORITY_COUNT];
+
+#ifdef FWK_EVENT_QUEUE_STATS_ENABLE
+    /* Queue residency statistics, one per priority class */
+    struct fwk_event_queue_stats queue_stats[FWK_EVENT_PRIORITY_COUNT];
+#endif
 
     /* The event currently being processed */
     struct fwk_event *current_event;
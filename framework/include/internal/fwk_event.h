@@ -37,4 +37,12 @@ enum fwk_event_type {
     FWK_EVENT_TYPE_COUNT,
 };
 
+/*
+ * \internal Events record the time at which they were queued when the event
+ *      queue statistics or the event profiler are enabled.
+ */
+#if defined(FWK_EVENT_QUEUE_STATS_ENABLE) || defined(FWK_EVENT_PROFILE_ENABLE)
+#    define FWK_EVENT_TIMESTAMP_ENABLE
+#endif
+
 #endif /* FWK_INTERNAL_EVENT_H */
@@ -0,0 +1,27 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_INTERNAL_EVENT_PROFILE_H
+#define FWK_INTERNAL_EVENT_PROFILE_H
+
+#include <fwk_event.h>
+#include <fwk_event_profile.h>
+#include <fwk_time.h>
+
+/*
+ * \brief Account for an event that has been processed.
+ *
+ * \param event Event that was processed. Its queued timestamp must be set.
+ * \param dispatched_at Time at which the event handler was called.
+ * \param completed_at Time at which the event handler returned.
+ */
+void __fwk_event_profile_record(
+    const struct fwk_event *event,
+    fwk_timestamp_t dispatched_at,
+    fwk_timestamp_t completed_at);
+
+#endif /* FWK_INTERNAL_EVENT_PROFILE_H */
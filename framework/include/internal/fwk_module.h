@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -43,11 +43,11 @@ struct fwk_module_context {
 
 #ifdef BUILD_HAS_NOTIFICATION
     /*
-     * Table of notification subscription lists. One list per type of
-     * notification defined by the module.
+     * Table of notification subscribers. One entry per type of notification
+     * defined by the module.
      */
-    struct fwk_dlist *subscription_dlist_table;
-    #endif
+    struct __fwk_notification_subscribers *subscription_table;
+#endif
 
     /* List of delayed response events */
     struct fwk_slist delayed_response_list;
@@ -68,11 +68,11 @@ struct fwk_element_ctx {
 
 #ifdef BUILD_HAS_NOTIFICATION
     /*
-     * Table of notification subscription lists. One list per type of
-     * notification defined by the element's module.
+     * Table of notification subscribers. One entry per type of notification
+     * defined by the element's module.
      */
-    struct fwk_dlist *subscription_dlist_table;
-    #endif
+    struct __fwk_notification_subscribers *subscription_table;
+#endif
 
     /* List of delayed response events */
     struct fwk_slist delayed_response_list;
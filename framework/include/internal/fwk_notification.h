@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2018-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,41 +8,28 @@
 #ifndef FWK_INTERNAL_NOTIFICATION_H
 #define FWK_INTERNAL_NOTIFICATION_H
 
-#include <fwk_list.h>
+#include <fwk_id.h>
 #include <fwk_notification.h>
 
 #include <stdbool.h>
 #include <stddef.h>
 
-struct __fwk_notification_subscription {
-    struct fwk_dlist_node dlist_node;
-
-    /* Identifier of the notification source entity. */
-    fwk_id_t source_id;
-
-    /* Identifier of the notification target entity. */
-    fwk_id_t target_id;
-};
-
 /*
- * \brief Initialize the notification framework component.
- *
- * \param notification_count The maximum number of notification subscriptions at
- *      any time.
+ * Subscribers to one notification of one source entity.
  *
- * \retval ::FWK_SUCCESS The notification framework component was initialized.
- * \retval ::FWK_E_PARAM The maximum number of notification subscriptions is
- *      equal to zero.
- * \retval ::FWK_E_NOMEM Insufficient memory available to allocate the
- *      notification subscription.
+ * The source entity and the notification are implied by the position of the
+ * structure in the subscription table of the source, so only the targets are
+ * stored. They are kept in subscription order.
  */
-int __fwk_notification_init(size_t notification_count);
+struct __fwk_notification_subscribers {
+    /* Table of the identifiers of the subscribed target entities. */
+    fwk_id_t *target_table;
 
-/*
- * \brief Reset the notification framework component.
- *
- * \note Only for testing.
- */
-void __fwk_notification_reset(void);
+    /* Number of subscribed target entities. */
+    unsigned int count;
+
+    /* Number of entries allocated for the target table. */
+    unsigned int capacity;
+};
 
 #endif /* FWK_INTERNAL_NOTIFICATION_H */
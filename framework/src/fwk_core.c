@@ -11,6 +11,9 @@
 #include <internal/fwk_context.h>
 #include <internal/fwk_core.h>
 #include <internal/fwk_delayed_resp.h>
+#ifdef FWK_EVENT_PROFILE_ENABLE
+#    include <internal/fwk_event_profile.h>
+#endif
 #include <internal/fwk_module.h>
 
 #include <fwk_assert.h>
@@ -25,11 +28,13 @@
 #endif
 
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_noreturn.h>
 #include <fwk_status.h>
 #include <fwk_string.h>
+#include <fwk_time.h>
 
 #include <inttypes.h>
 #include <stdbool.h>
@@ -47,6 +52,14 @@ enum interrupt_states {
     NOT_INTERRUPT_STATE = 2,
 };
 
+/* Order in which the event priority classes are served */
+static const enum fwk_event_priority
+    priority_order[FWK_EVENT_PRIORITY_COUNT] = {
+        FWK_EVENT_PRIORITY_HIGH,
+        FWK_EVENT_PRIORITY_NORMAL,
+        FWK_EVENT_PRIORITY_LOW,
+    };
+
 /*
  * Static functions
  */
@@ -101,6 +114,68 @@ static struct fwk_event *duplicate_event(
     return allocated_event;
 }
 
+/*
+ * Get the priority class of an event from the descriptor of its target module.
+ */
+static enum fwk_event_priority get_event_priority(
+    const struct fwk_event *event)
+{
+    const struct fwk_module *module;
+    enum fwk_event_priority priority;
+    unsigned int event_idx;
+
+    module = fwk_module_get_ctx(event->target_id)->desc;
+    priority = module->event_priority;
+
+    if ((module->event_priorities != NULL) && !event->is_response &&
+        !event->is_notification) {
+        /* Events the table does not cover use the module priority class */
+        event_idx = fwk_id_get_event_idx(event->id);
+        if (event_idx < module->event_count) {
+            priority = module->event_priorities[event_idx];
+        }
+    }
+
+    fwk_assert(priority < FWK_EVENT_PRIORITY_COUNT);
+
+    return priority;
+}
+
+/*
+ * Queue an event raised outside of an interrupt handler, or pulled from the ISR
+ * event queue, at the tail of the queue of its priority class.
+ */
+static void queue_event(struct fwk_event *event)
+{
+    enum fwk_event_priority priority = get_event_priority(event);
+
+    fwk_list_push_tail(&ctx.event_queue[priority], &event->slist_node);
+
+    FWK_LOG_LOCAL(
+        "[FWK] event_queue[%d] peak: %d",
+        (int)priority,
+        fwk_list_get_max(&ctx.event_queue[priority]));
+}
+
+#ifdef FWK_EVENT_QUEUE_STATS_ENABLE
+static void account_residency(
+    enum fwk_event_priority priority,
+    const struct fwk_event *event)
+{
+    struct fwk_event_queue_stats *stats = &ctx.queue_stats[priority];
+    fwk_timestamp_t now = fwk_time_current();
+    uint64_t residency = 0;
+
+    if (now > event->queued_at) {
+        residency = now - event->queued_at;
+    }
+
+    stats->event_count++;
+    stats->total_residency += residency;
+    stats->max_residency = FWK_MAX(stats->max_residency, residency);
+}
+#endif
+
 static int put_event(
     void *event,
     enum interrupt_states intr_state,
@@ -150,12 +225,13 @@ static int put_event(
             intr_state = NOT_INTERRUPT_STATE;
         }
     }
-    if (intr_state == NOT_INTERRUPT_STATE) {
-        fwk_list_push_tail(&ctx.event_queue, &allocated_event->slist_node);
 
-        FWK_LOG_LOCAL(
-            "[FWK] event_queue peak: %d", fwk_list_get_max(&ctx.event_queue));
+#ifdef FWK_EVENT_TIMESTAMP_ENABLE
+    allocated_event->queued_at = fwk_time_current();
+#endif
 
+    if (intr_state == NOT_INTERRUPT_STATE) {
+        queue_event(allocated_event);
     } else {
         fwk_list_push_tail(&ctx.isr_event_queue, &allocated_event->slist_node);
 
@@ -185,16 +261,25 @@ static void free_event(struct fwk_event *event)
     (void)fwk_interrupt_global_enable(flags);
 }
 
-static void process_next_event(void)
+static void process_next_event(enum fwk_event_priority priority)
 {
     int status;
     struct fwk_event *event, *allocated_event, async_response_event;
     const struct fwk_module *module;
     int (*process_event)(
         const struct fwk_event *event, struct fwk_event *resp_event);
+#ifdef FWK_EVENT_PROFILE_ENABLE
+    fwk_timestamp_t dispatched_at, completed_at;
+#endif
 
     ctx.current_event = event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx.event_queue), struct fwk_event, slist_node);
+        fwk_list_pop_head(&ctx.event_queue[priority]),
+        struct fwk_event,
+        slist_node);
+
+#ifdef FWK_EVENT_QUEUE_STATS_ENABLE
+    account_residency(priority, event);
+#endif
 
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
     FWK_LOG_DEBUG(
@@ -216,7 +301,13 @@ static void process_next_event(void)
         async_response_event.target_id = event->source_id;
         async_response_event.is_delayed_response = false;
 
+#ifdef FWK_EVENT_PROFILE_ENABLE
+        dispatched_at = fwk_time_current();
+#endif
         status = process_event(event, &async_response_event);
+#ifdef FWK_EVENT_PROFILE_ENABLE
+        completed_at = fwk_time_current();
+#endif
         if (status != FWK_SUCCESS) {
             FWK_LOG_CRIT(err_msg_line, status, __func__, __LINE__);
         }
@@ -237,7 +328,13 @@ static void process_next_event(void)
             }
         }
     } else {
+#ifdef FWK_EVENT_PROFILE_ENABLE
+        dispatched_at = fwk_time_current();
+#endif
         status = process_event(event, &async_response_event);
+#ifdef FWK_EVENT_PROFILE_ENABLE
+        completed_at = fwk_time_current();
+#endif
         if ((status != FWK_SUCCESS) && (status != FWK_PENDING)) {
             FWK_LOG_CRIT(
                 "[FWK] Process event (%s: %s -> %s) (%d)",
@@ -248,39 +345,65 @@ static void process_next_event(void)
         }
     }
 
+#ifdef FWK_EVENT_PROFILE_ENABLE
+    __fwk_event_profile_record(event, dispatched_at, completed_at);
+#endif
+
     ctx.current_event = NULL;
     free_event(event);
     return;
 }
 
-static bool process_isr(void)
+/*
+ * Move every event raised by interrupt handlers so far to the event queues.
+ * The ISR event queue is emptied under a single critical section, the events
+ * are then sorted into their priority classes with interrupts enabled.
+ */
+static void process_isr(void)
 {
+    struct fwk_slist isr_events;
+    struct fwk_slist_node *node;
     struct fwk_event *isr_event;
     unsigned int flags;
 
+    fwk_list_init(&isr_events);
+
     flags = fwk_interrupt_global_disable();
-    isr_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx.isr_event_queue), struct fwk_event, slist_node);
+    while ((node = fwk_list_pop_head(&ctx.isr_event_queue)) != NULL) {
+        fwk_list_push_tail(&isr_events, node);
+    }
     (void)fwk_interrupt_global_enable(flags);
 
-    if (isr_event == NULL) {
-        return false;
-    }
+    while ((node = fwk_list_pop_head(&isr_events)) != NULL) {
+        isr_event = FWK_LIST_GET(node, struct fwk_event, slist_node);
 
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
-    FWK_LOG_DEBUG(
-        "[FWK] Pulled ISR event (%s: %s -> %s)",
-        FWK_ID_STR(isr_event->id),
-        FWK_ID_STR(isr_event->source_id),
-        FWK_ID_STR(isr_event->target_id));
+        FWK_LOG_DEBUG(
+            "[FWK] Pulled ISR event (%s: %s -> %s)",
+            FWK_ID_STR(isr_event->id),
+            FWK_ID_STR(isr_event->source_id),
+            FWK_ID_STR(isr_event->target_id));
 #endif
 
-    fwk_list_push_tail(&ctx.event_queue, &isr_event->slist_node);
+        queue_event(isr_event);
+    }
+}
 
-    FWK_LOG_LOCAL(
-        "[FWK] event_queue peak: %d", fwk_list_get_max(&ctx.event_queue));
+/*
+ * Find the most urgent priority class with an event awaiting processing.
+ */
+static bool get_next_event_priority(enum fwk_event_priority *priority)
+{
+    unsigned int idx;
 
-    return true;
+    for (idx = 0; idx < FWK_ARRAY_SIZE(priority_order); idx++) {
+        if (!fwk_list_is_empty(&ctx.event_queue[priority_order[idx]])) {
+            *priority = priority_order[idx];
+            return true;
+        }
+    }
+
+    return false;
 }
 
 /*
@@ -290,14 +413,18 @@ static bool process_isr(void)
 int __fwk_init(size_t event_count)
 {
     struct fwk_event *event_table, *event;
+    unsigned int priority;
 
     event_table = fwk_mm_calloc(event_count, sizeof(struct fwk_event));
 
     /* All the event structures are free to be used. */
     fwk_list_init(&ctx.free_event_queue);
-    fwk_list_init(&ctx.event_queue);
     fwk_list_init(&ctx.isr_event_queue);
 
+    for (priority = 0; priority < FWK_EVENT_PRIORITY_COUNT; priority++) {
+        fwk_list_init(&ctx.event_queue[priority]);
+    }
+
     for (event = event_table; event < (event_table + event_count); event++) {
         fwk_list_push_tail(&ctx.free_event_queue, &event->slist_node);
     }
@@ -309,17 +436,41 @@ int __fwk_init(size_t event_count)
 
 void fwk_process_event_queue(void)
 {
-    for (;;) {
-        while (!fwk_list_is_empty(&ctx.event_queue)) {
-            process_next_event();
-        }
+    enum fwk_event_priority priority;
 
-        if (!process_isr()) {
+    for (;;) {
+        /*
+         * Pull the ISR events in before every dispatch so that an urgent event
+         * raised by an interrupt handler does not wait behind a backlog of
+         * less urgent events.
+         */
+        process_isr();
+
+        if (!get_next_event_priority(&priority)) {
             break;
         }
+
+        process_next_event(priority);
     }
 }
 
+int fwk_get_event_queue_stats(
+    enum fwk_event_priority priority,
+    struct fwk_event_queue_stats *stats)
+{
+#ifdef FWK_EVENT_QUEUE_STATS_ENABLE
+    if ((priority >= FWK_EVENT_PRIORITY_COUNT) || (stats == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    *stats = ctx.queue_stats[priority];
+
+    return FWK_SUCCESS;
+#else
+    return FWK_E_SUPPORT;
+#endif
+}
+
 noreturn void __fwk_run_main_loop(void)
 {
     for (;;) {
@@ -0,0 +1,220 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Event latency and handler cost profiler.
+ */
+
+#include <internal/fwk_event_profile.h>
+
+#include <fwk_assert.h>
+#include <fwk_event.h>
+#include <fwk_event_profile.h>
+#include <fwk_id.h>
+#include <fwk_io.h>
+#include <fwk_math.h>
+#include <fwk_status.h>
+#include <fwk_string.h>
+#include <fwk_time.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The hash index has twice as many slots as there are entries so that probe
+ * sequences stay short even when the table is full. It is rounded up to a
+ * power of two so that the probe position can be masked.
+ */
+#define INDEX_SLOT_COUNT \
+    (2u << fwk_math_log2(2u * FMW_EVENT_PROFILE_ENTRY_MAX - 1u))
+
+/* Marks an unused slot of the hash index */
+#define INDEX_SLOT_FREE UINT16_MAX
+
+static_assert(
+    FMW_EVENT_PROFILE_ENTRY_MAX < INDEX_SLOT_FREE,
+    "FMW_EVENT_PROFILE_ENTRY_MAX is too large");
+
+static struct {
+    /* Entries, in the order they were created */
+    struct fwk_event_profile_entry entries[FMW_EVENT_PROFILE_ENTRY_MAX];
+
+    /* Number of entries in use */
+    unsigned int entry_count;
+
+    /* Number of events not accounted for because the table was full */
+    uint32_t dropped;
+
+    /* Open-addressing index from (target module, event) to entry index */
+    uint16_t index[INDEX_SLOT_COUNT];
+} profile_ctx = {
+    .index = { [0 ... INDEX_SLOT_COUNT - 1] = INDEX_SLOT_FREE },
+};
+
+static unsigned int hash_key(uint32_t module_value, uint32_t event_value)
+{
+    uint32_t key = module_value ^ (event_value * UINT32_C(0x9E3779B1));
+
+    key ^= key >> 16;
+
+    return (unsigned int)key & (INDEX_SLOT_COUNT - 1u);
+}
+
+static struct fwk_event_profile_entry *get_entry(
+    fwk_id_t target_id,
+    fwk_id_t event_id)
+{
+    struct fwk_event_profile_entry *entry;
+    fwk_id_t module_id = fwk_id_build_module_id(target_id);
+    unsigned int slot = hash_key(module_id.value, event_id.value);
+
+    while (profile_ctx.index[slot] != INDEX_SLOT_FREE) {
+        entry = &profile_ctx.entries[profile_ctx.index[slot]];
+        if ((entry->target_id.value == module_id.value) &&
+            (entry->event_id.value == event_id.value)) {
+            return entry;
+        }
+
+        slot = (slot + 1u) & (INDEX_SLOT_COUNT - 1u);
+    }
+
+    if (profile_ctx.entry_count == FMW_EVENT_PROFILE_ENTRY_MAX) {
+        return NULL;
+    }
+
+    profile_ctx.index[slot] = (uint16_t)profile_ctx.entry_count;
+    entry = &profile_ctx.entries[profile_ctx.entry_count++];
+    entry->target_id = module_id;
+    entry->event_id = event_id;
+
+    return entry;
+}
+
+static void histogram_add(
+    struct fwk_event_profile_histogram *histogram,
+    uint64_t duration)
+{
+    unsigned long long us = duration / FWK_US(1);
+    unsigned int bucket = 0;
+
+    if (us != 0) {
+        bucket = (unsigned int)fwk_math_log2(us) + 1u;
+        if (bucket >= FWK_EVENT_PROFILE_BUCKET_COUNT) {
+            bucket = FWK_EVENT_PROFILE_BUCKET_COUNT - 1u;
+        }
+    }
+
+    histogram->buckets[bucket]++;
+    histogram->total += duration;
+    if (duration > histogram->max) {
+        histogram->max = duration;
+    }
+}
+
+void __fwk_event_profile_record(
+    const struct fwk_event *event,
+    fwk_timestamp_t dispatched_at,
+    fwk_timestamp_t completed_at)
+{
+    struct fwk_event_profile_entry *entry;
+
+    entry = get_entry(event->target_id, event->id);
+    if (entry == NULL) {
+        profile_ctx.dropped++;
+
+        return;
+    }
+
+    entry->count++;
+
+    /*
+     * Durations are clamped to zero rather than relying on the time driver
+     * being strictly monotonic.
+     */
+    histogram_add(
+        &entry->wait,
+        (dispatched_at > event->queued_at) ? dispatched_at - event->queued_at :
+                                             0);
+    histogram_add(
+        &entry->handler,
+        (completed_at > dispatched_at) ? completed_at - dispatched_at : 0);
+}
+
+int fwk_event_profile_get_count(unsigned int *entry_count, uint32_t *dropped)
+{
+    if (entry_count == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    *entry_count = profile_ctx.entry_count;
+
+    if (dropped != NULL) {
+        *dropped = profile_ctx.dropped;
+    }
+
+    return FWK_SUCCESS;
+}
+
+int fwk_event_profile_get_entry(
+    unsigned int index,
+    struct fwk_event_profile_entry *entry)
+{
+    if (entry == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (index >= profile_ctx.entry_count) {
+        return FWK_E_RANGE;
+    }
+
+    *entry = profile_ctx.entries[index];
+
+    return FWK_SUCCESS;
+}
+
+void fwk_event_profile_reset(void)
+{
+    unsigned int slot;
+
+    fwk_str_memset(profile_ctx.entries, 0, sizeof(profile_ctx.entries));
+
+    for (slot = 0; slot < INDEX_SLOT_COUNT; slot++) {
+        profile_ctx.index[slot] = INDEX_SLOT_FREE;
+    }
+
+    profile_ctx.entry_count = 0;
+    profile_ctx.dropped = 0;
+}
+
+int fwk_event_profile_write(const struct fwk_io_stream *stream)
+{
+    int status;
+    size_t written;
+    struct fwk_event_profile_header header = {
+        .magic = FWK_EVENT_PROFILE_MAGIC,
+        .version = FWK_EVENT_PROFILE_VERSION,
+        .bucket_count = FWK_EVENT_PROFILE_BUCKET_COUNT,
+        .entry_count = profile_ctx.entry_count,
+        .dropped = profile_ctx.dropped,
+    };
+
+    status = fwk_io_write(stream, &written, &header, sizeof(header), 1);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    if (header.entry_count == 0) {
+        return FWK_SUCCESS;
+    }
+
+    return fwk_io_write(
+        stream,
+        &written,
+        profile_ctx.entries,
+        sizeof(profile_ctx.entries[0]),
+        header.entry_count);
+}
@@ -258,6 +258,145 @@ int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch)
     return status;
 }
 
+static bool fwk_io_has_mode(
+    const struct fwk_io_stream *stream,
+    enum fwk_io_mode mode)
+{
+    return (((unsigned int)stream->mode) & ((unsigned int)mode)) != 0U;
+}
+
+static bool fwk_io_can_read_block(const struct fwk_io_stream *stream)
+{
+    return (stream != NULL) && (stream->adapter != NULL) &&
+        (stream->adapter->read != NULL);
+}
+
+static bool fwk_io_can_write_block(const struct fwk_io_stream *stream)
+{
+    return (stream != NULL) && (stream->adapter != NULL) &&
+        (stream->adapter->write != NULL);
+}
+
+/*
+ * Read up to `length` characters through the block read operation of the
+ * adapter, stopping early if the stream runs dry.
+ */
+static int fwk_io_read_block(
+    const struct fwk_io_stream *stream,
+    char *buffer,
+    size_t length,
+    size_t *read)
+{
+    int status = FWK_SUCCESS;
+    size_t chunk;
+
+    *read = 0;
+
+    if (!fwk_io_has_mode(stream, FWK_IO_MODE_READ)) {
+        return FWK_E_SUPPORT; /* Stream not open for read operations */
+    }
+
+    while ((*read < length) && (status == FWK_SUCCESS)) {
+        chunk = 0;
+        status = stream->adapter->read(
+            stream, &buffer[*read], length - *read, &chunk);
+        if ((status == FWK_SUCCESS) && (chunk == 0)) {
+            status = FWK_PENDING; /* Nothing fetched, treat as end-of-stream */
+        }
+
+        *read += chunk;
+    }
+
+    if ((status != FWK_SUCCESS) && (status != FWK_PENDING)) {
+        return FWK_E_HANDLER;
+    }
+
+    return status;
+}
+
+/*
+ * Write up to `length` characters through the block write operation of the
+ * adapter. If `wait` is set, the adapter is retried until it has accepted the
+ * whole block, otherwise the function returns as soon as the adapter is busy.
+ */
+static int fwk_io_write_block(
+    const struct fwk_io_stream *stream,
+    const char *buffer,
+    size_t length,
+    size_t *written,
+    bool wait)
+{
+    int status = FWK_SUCCESS;
+    size_t chunk;
+
+    *written = 0;
+
+    if (!fwk_io_has_mode(stream, FWK_IO_MODE_WRITE)) {
+        return FWK_E_SUPPORT; /* Stream not open for write operations */
+    }
+
+    while (*written < length) {
+        chunk = 0;
+        status = stream->adapter->write(
+            stream, &buffer[*written], length - *written, &chunk);
+        if ((status == FWK_SUCCESS) && (chunk == 0)) {
+            status = FWK_E_BUSY; /* Nothing accepted, treat as busy */
+        }
+
+        *written += chunk;
+
+        if ((status == FWK_E_BUSY) && wait) {
+            status = FWK_SUCCESS; /* Wait for the adapter to accept more */
+        } else if (status != FWK_SUCCESS) {
+            break;
+        }
+    }
+
+    if ((status != FWK_SUCCESS) && (status != FWK_E_BUSY)) {
+        return FWK_E_HANDLER;
+    }
+
+    return status;
+}
+
+int fwk_io_write_nowait(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict written,
+    const void *restrict buffer,
+    size_t size)
+{
+    int status = FWK_SUCCESS;
+
+    const char *cbuffer = buffer;
+
+    if ((stream == NULL) || (written == NULL) || (cbuffer == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    *written = 0;
+
+    if (stream->adapter == NULL) {
+        return FWK_E_STATE; /* The stream is not open */
+    }
+
+    if (size == 0) {
+        return FWK_SUCCESS;
+    }
+
+    if (fwk_io_can_write_block(stream)) {
+        return fwk_io_write_block(stream, cbuffer, size, written, false);
+    }
+
+    while ((*written < size) && (status == FWK_SUCCESS)) {
+        status = fwk_io_putch_nowait(stream, cbuffer[*written]);
+        if (status == FWK_SUCCESS) {
+            *written += 1;
+        }
+    }
+
+    return status;
+}
+
 int fwk_io_read(
     const struct fwk_io_stream *restrict stream,
     size_t *restrict read,
@@ -268,11 +407,27 @@ int fwk_io_read(
     int status = FWK_SUCCESS;
 
     char *cbuffer = buffer;
+    size_t length;
 
     if (read != NULL) {
         *read = 0;
     }
 
+    if (fwk_io_can_read_block(stream) && (cbuffer != NULL) && (size != 0) &&
+        (count != 0)) {
+        status = fwk_io_read_block(stream, cbuffer, size * count, &length);
+
+        if (read != NULL) {
+            *read = length / size;
+        }
+
+        if ((status == FWK_PENDING) && (read == NULL)) {
+            return FWK_E_DATA; /* Reached end-of-stream */
+        }
+
+        return status;
+    }
+
     for (size_t i = 0; (i < count) && (status == FWK_SUCCESS); i++) {
         for (size_t j = 0; (j < size) && (status == FWK_SUCCESS); j++) {
             status = fwk_io_getch(stream, cbuffer++);
@@ -300,6 +455,7 @@ int fwk_io_write(
     int status = FWK_SUCCESS;
 
     const char *cbuffer = buffer;
+    size_t length;
 
     if (cbuffer == NULL) {
         return FWK_E_PARAM;
@@ -309,6 +465,17 @@ int fwk_io_write(
         *written = 0;
     }
 
+    if (fwk_io_can_write_block(stream) && (size != 0) && (count != 0)) {
+        status =
+            fwk_io_write_block(stream, cbuffer, size * count, &length, true);
+
+        if (written != NULL) {
+            *written = length / size;
+        }
+
+        return status;
+    }
+
     for (size_t i = 0; (i < count) && (status == FWK_SUCCESS); i++) {
         for (size_t j = 0; (j < size) && (status == FWK_SUCCESS); j++) {
             status = fwk_io_putch(stream, *cbuffer++);
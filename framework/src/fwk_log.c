@@ -32,8 +32,70 @@ static struct {
 
     unsigned char remaining; /* Remaining characters in the current message */
 #endif
+
+#ifdef FWK_LOG_DEFERRED
+    /* Deferred message formatted by the drain */
+    char line[FMW_LOG_COLUMNS + sizeof(FWK_LOG_TERMINATOR)];
+
+    size_t line_length; /* Length of the formatted message */
+    size_t line_written; /* Characters of the message already written */
+#endif
 } fwk_log_ctx = { 0 };
 
+#ifdef FWK_LOG_DEFERRED
+/*
+ * Length prefix identifying a deferred record in the ring buffer. Formatted
+ * messages always include their null terminator, so never have a zero length.
+ */
+#    define FWK_LOG_RECORD_MARKER 0
+
+static_assert(
+    (FMW_LOG_COLUMNS + sizeof(FWK_LOG_TERMINATOR)) <= UCHAR_MAX,
+    "FMW_LOG_COLUMNS is too large for the length prefix of a message");
+
+/* Longest conversion specification that can be deferred, e.g. "%-#010llx" */
+#    define FWK_LOG_SPEC_LENGTH_MAX 12
+
+enum fwk_log_arg_type {
+    FWK_LOG_ARG_NONE, /* "%%", which consumes no argument */
+    FWK_LOG_ARG_INT,
+    FWK_LOG_ARG_UINT,
+    FWK_LOG_ARG_LONG,
+    FWK_LOG_ARG_ULONG,
+    FWK_LOG_ARG_LLONG,
+    FWK_LOG_ARG_ULLONG,
+    FWK_LOG_ARG_SIZE,
+    FWK_LOG_ARG_PTR,
+    FWK_LOG_ARG_UNSUPPORTED,
+};
+
+/* Conversion specification found in a format string */
+struct fwk_log_spec {
+    const char *start; /* Position of the '%' character */
+    size_t length; /* Length of the specification */
+    enum fwk_log_arg_type type; /* Type of the argument it consumes */
+};
+
+/* Argument of a deferred message, stored in its native representation */
+union fwk_log_arg {
+    unsigned int u;
+    unsigned long ul;
+    unsigned long long ull;
+    size_t z;
+    void *p;
+};
+
+/*
+ * Header of a deferred record. It is followed in the ring buffer by
+ * `word_count` 32-bit words holding the arguments of the message.
+ */
+struct fwk_log_record {
+    fwk_timestamp_t timestamp;
+    const char *format;
+    unsigned char word_count;
+};
+#endif
+
 static struct fwk_io_stream *fwk_log_stream;
 
 #ifdef FWK_LOG_BUFFERED
@@ -85,13 +147,11 @@ static bool fwk_log_buffer(struct fwk_ring *ring, const char *message)
 }
 #endif
 
-static void fwk_log_vsnprintf(
+static size_t fwk_log_timestamp(
     size_t buffer_size,
     char buffer[buffer_size],
-    const char *format,
-    va_list *args)
+    fwk_timestamp_t timestamp)
 {
-    fwk_timestamp_t timestamp = 0;
     fwk_duration_ns_t duration = 0;
 
     uint32_t duration_s = 0;
@@ -99,14 +159,6 @@ static void fwk_log_vsnprintf(
 
     size_t length = 0;
 
-    buffer_size -= FWK_ARRAY_SIZE(FWK_LOG_TERMINATOR);
-
-    /*
-     * We start by generating a timestamp for the message using the number of
-     * nanoseconds since boot.
-     */
-
-    timestamp = fwk_time_current();
     duration = fwk_time_stamp_duration(timestamp);
 
     /*
@@ -131,6 +183,26 @@ static void fwk_log_vsnprintf(
         duration_us);
     fwk_assert(length < buffer_size);
 
+    return length;
+}
+
+static void fwk_log_vsnprintf(
+    size_t buffer_size,
+    char buffer[buffer_size],
+    const char *format,
+    va_list *args)
+{
+    size_t length = 0;
+
+    buffer_size -= FWK_ARRAY_SIZE(FWK_LOG_TERMINATOR);
+
+    /*
+     * We start by generating a timestamp for the message using the number of
+     * nanoseconds since boot.
+     */
+
+    length = fwk_log_timestamp(buffer_size, buffer, fwk_time_current());
+
     /*
      * We then need to `snprintf()` the message into a temporary buffer because
      * we need to manipulate it before we print or store it.
@@ -161,6 +233,314 @@ static void fwk_log_snprintf(
     va_end(args);
 }
 
+#ifdef FWK_LOG_DEFERRED
+/*
+ * Find the next conversion specification in `format` and return the position
+ * following it, or a null pointer value if there is none.
+ */
+static const char *fwk_log_next_spec(
+    const char *format,
+    struct fwk_log_spec *spec)
+{
+    static const enum fwk_log_arg_type signed_types[] = {
+        FWK_LOG_ARG_INT,
+        FWK_LOG_ARG_LONG,
+        FWK_LOG_ARG_LLONG,
+    };
+    static const enum fwk_log_arg_type unsigned_types[] = {
+        FWK_LOG_ARG_UINT,
+        FWK_LOG_ARG_ULONG,
+        FWK_LOG_ARG_ULLONG,
+    };
+
+    const char *cursor;
+    unsigned int longs = 0;
+    bool size = false;
+    bool modified;
+
+    format = strchr(format, '%');
+    if (format == NULL) {
+        return NULL;
+    }
+
+    /* Flags, field width and precision */
+    cursor = format + 1;
+    cursor += strspn(cursor, "-+ #0");
+    cursor += strspn(cursor, "0123456789");
+    if (*cursor == '.') {
+        cursor++;
+        cursor += strspn(cursor, "0123456789");
+    }
+
+    /* Length modifiers. Shorter integers are promoted to `int`. */
+    modified = (*cursor == 'h') || (*cursor == 'l') || (*cursor == 'z');
+    cursor += strspn(cursor, "h");
+    while (*cursor == 'l') {
+        longs++;
+        cursor++;
+    }
+    if (*cursor == 'z') {
+        size = true;
+        cursor++;
+    }
+
+    spec->start = format;
+
+    if (*cursor == '\0') {
+        spec->length = (size_t)(cursor - format);
+        spec->type = FWK_LOG_ARG_UNSUPPORTED;
+
+        return cursor;
+    }
+
+    spec->length = (size_t)(cursor - format) + 1;
+
+    switch (*cursor) {
+    case '%':
+        spec->type = modified ? FWK_LOG_ARG_UNSUPPORTED : FWK_LOG_ARG_NONE;
+        break;
+
+    case 'd':
+    case 'i':
+        spec->type = size ? FWK_LOG_ARG_UNSUPPORTED :
+                            signed_types[FWK_MIN(longs, 2u)];
+        break;
+
+    case 'c':
+        spec->type = modified ? FWK_LOG_ARG_UNSUPPORTED : FWK_LOG_ARG_INT;
+        break;
+
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+        spec->type = size ? FWK_LOG_ARG_SIZE :
+                            unsigned_types[FWK_MIN(longs, 2u)];
+        break;
+
+    case 'p':
+        spec->type = modified ? FWK_LOG_ARG_UNSUPPORTED : FWK_LOG_ARG_PTR;
+        break;
+
+    default:
+        spec->type = FWK_LOG_ARG_UNSUPPORTED;
+        break;
+    }
+
+    if ((longs > 2) || (size && (longs > 0)) ||
+        (spec->length >= FWK_LOG_SPEC_LENGTH_MAX)) {
+        spec->type = FWK_LOG_ARG_UNSUPPORTED;
+    }
+
+    return cursor + 1;
+}
+
+static size_t fwk_log_arg_size(enum fwk_log_arg_type type)
+{
+    switch (type) {
+    case FWK_LOG_ARG_INT:
+    case FWK_LOG_ARG_UINT:
+        return sizeof(unsigned int);
+
+    case FWK_LOG_ARG_LONG:
+    case FWK_LOG_ARG_ULONG:
+        return sizeof(unsigned long);
+
+    case FWK_LOG_ARG_LLONG:
+    case FWK_LOG_ARG_ULLONG:
+        return sizeof(unsigned long long);
+
+    case FWK_LOG_ARG_SIZE:
+        return sizeof(size_t);
+
+    case FWK_LOG_ARG_PTR:
+        return sizeof(void *);
+
+    default:
+        return 0;
+    }
+}
+
+/*
+ * Copy the arguments of a message into `words`. Returns false if the message
+ * cannot be deferred, in which case `args` must not be used again.
+ */
+static bool fwk_log_capture(
+    const char *format,
+    va_list *args,
+    uint32_t words[FMW_LOG_DEFERRED_ARGS_MAX],
+    unsigned char *word_count)
+{
+    struct fwk_log_spec spec;
+    union fwk_log_arg arg;
+    size_t size;
+    size_t count = 0;
+
+    while ((format = fwk_log_next_spec(format, &spec)) != NULL) {
+        switch (spec.type) {
+        case FWK_LOG_ARG_NONE:
+            continue;
+
+        case FWK_LOG_ARG_INT:
+        case FWK_LOG_ARG_UINT:
+            arg.u = va_arg(*args, unsigned int);
+            break;
+
+        case FWK_LOG_ARG_LONG:
+        case FWK_LOG_ARG_ULONG:
+            arg.ul = va_arg(*args, unsigned long);
+            break;
+
+        case FWK_LOG_ARG_LLONG:
+        case FWK_LOG_ARG_ULLONG:
+            arg.ull = va_arg(*args, unsigned long long);
+            break;
+
+        case FWK_LOG_ARG_SIZE:
+            arg.z = va_arg(*args, size_t);
+            break;
+
+        case FWK_LOG_ARG_PTR:
+            arg.p = va_arg(*args, void *);
+            break;
+
+        default:
+            return false;
+        }
+
+        size = fwk_log_arg_size(spec.type);
+        if ((count + FWK_ALIGN_NEXT(size, sizeof(words[0])) /
+                 sizeof(words[0])) > FMW_LOG_DEFERRED_ARGS_MAX) {
+            return false;
+        }
+
+        (void)memcpy(&words[count], &arg, size);
+        count += FWK_ALIGN_NEXT(size, sizeof(words[0])) / sizeof(words[0]);
+    }
+
+    *word_count = (unsigned char)count;
+
+    return true;
+}
+
+static bool fwk_log_buffer_record(
+    struct fwk_ring *ring,
+    const struct fwk_log_record *record,
+    const uint32_t *words)
+{
+    unsigned char marker = FWK_LOG_RECORD_MARKER;
+    size_t words_size = record->word_count * sizeof(words[0]);
+
+    if ((sizeof(marker) + sizeof(*record) + words_size) >
+        fwk_ring_get_free(ring)) {
+        return false; /* Not enough buffer space */
+    }
+
+    fwk_ring_push(ring, (char *)&marker, sizeof(marker));
+    fwk_ring_push(ring, (const char *)record, sizeof(*record));
+    fwk_ring_push(ring, (const char *)words, words_size);
+
+    return true;
+}
+
+static int fwk_log_format_arg(
+    size_t buffer_size,
+    char buffer[buffer_size],
+    const char *spec,
+    enum fwk_log_arg_type type,
+    const union fwk_log_arg *arg)
+{
+    switch (type) {
+    case FWK_LOG_ARG_INT:
+        return snprintf(buffer, buffer_size, spec, (int)arg->u);
+
+    case FWK_LOG_ARG_UINT:
+        return snprintf(buffer, buffer_size, spec, arg->u);
+
+    case FWK_LOG_ARG_LONG:
+        return snprintf(buffer, buffer_size, spec, (long)arg->ul);
+
+    case FWK_LOG_ARG_ULONG:
+        return snprintf(buffer, buffer_size, spec, arg->ul);
+
+    case FWK_LOG_ARG_LLONG:
+        return snprintf(buffer, buffer_size, spec, (long long)arg->ull);
+
+    case FWK_LOG_ARG_ULLONG:
+        return snprintf(buffer, buffer_size, spec, arg->ull);
+
+    case FWK_LOG_ARG_SIZE:
+        return snprintf(buffer, buffer_size, spec, arg->z);
+
+    case FWK_LOG_ARG_PTR:
+        return snprintf(buffer, buffer_size, spec, arg->p);
+
+    default:
+        return snprintf(buffer, buffer_size, "%%");
+    }
+}
+
+/*
+ * Format a deferred record into the drain line buffer, in the same way as
+ * `fwk_log_vsnprintf()` would have formatted the original message.
+ */
+static void fwk_log_format_record(
+    const struct fwk_log_record *record,
+    const uint32_t *words)
+{
+    char *buffer = fwk_log_ctx.line;
+    size_t buffer_size =
+        sizeof(fwk_log_ctx.line) - FWK_ARRAY_SIZE(FWK_LOG_TERMINATOR);
+
+    const char *format = record->format;
+    const char *next;
+    struct fwk_log_spec spec;
+    char spec_str[FWK_LOG_SPEC_LENGTH_MAX];
+    union fwk_log_arg arg;
+    size_t length;
+    size_t chunk;
+    size_t size;
+    int formatted;
+
+    length = fwk_log_timestamp(buffer_size, buffer, record->timestamp);
+
+    do {
+        next = fwk_log_next_spec(format, &spec);
+
+        /* Literal text up to the next conversion */
+        chunk = (next == NULL) ? strlen(format) : (size_t)(spec.start - format);
+        chunk = FWK_MIN(chunk, buffer_size - 1 - length);
+        (void)memcpy(buffer + length, format, chunk);
+        length += chunk;
+
+        if (next == NULL) {
+            break;
+        }
+
+        size = fwk_log_arg_size(spec.type);
+        (void)memcpy(&arg, words, size);
+        words += FWK_ALIGN_NEXT(size, sizeof(words[0])) / sizeof(words[0]);
+
+        (void)memcpy(spec_str, spec.start, spec.length);
+        spec_str[spec.length] = '\0';
+
+        formatted = fwk_log_format_arg(
+            buffer_size - length, buffer + length, spec_str, spec.type, &arg);
+        if (formatted > 0) {
+            length += FWK_MIN((size_t)formatted, buffer_size - 1 - length);
+        }
+
+        format = next;
+    } while (length < (buffer_size - 1));
+
+    (void)memcpy(
+        buffer + length, FWK_LOG_TERMINATOR, sizeof(FWK_LOG_TERMINATOR));
+
+    fwk_log_ctx.line_length = length + sizeof(FWK_LOG_TERMINATOR) - 1;
+    fwk_log_ctx.line_written = 0;
+}
+#endif
+
 static bool fwk_log_banner(void)
 {
     char buffer[FMW_LOG_COLUMNS];
@@ -200,6 +580,21 @@ void fwk_log_printf(const char *format, ...)
 
     va_list args;
 
+#ifdef FWK_LOG_DEFERRED
+    struct fwk_log_record record = { .format = format };
+    uint32_t words[FMW_LOG_DEFERRED_ARGS_MAX];
+    bool deferred;
+
+    /*
+     * Capturing the arguments only touches the caller's stack, so it is done
+     * before entering the critical section.
+     */
+
+    va_start(args, format);
+    deferred = fwk_log_capture(format, &args, words, &record.word_count);
+    va_end(args);
+#endif
+
     flags = fwk_interrupt_global_disable(); /* Facilitate reentrancy */
 
     /*
@@ -213,6 +608,24 @@ void fwk_log_printf(const char *format, ...)
         banner = fwk_log_banner();
     }
 
+#ifdef FWK_LOG_DEFERRED
+    if (deferred) {
+        /*
+         * Store the record as-is and leave the formatting to the drain. If
+         * there is no room for it, the message is dropped like any other.
+         */
+
+        record.timestamp = fwk_time_current();
+        if (!fwk_log_buffer_record(&fwk_log_ctx.ring, &record, words)) {
+            fwk_log_ctx.dropped++;
+        }
+
+        (void)fwk_interrupt_global_enable(flags);
+
+        return;
+    }
+#endif
+
     va_start(args, format);
     fwk_log_vsnprintf(sizeof(buffer), buffer, format, &args);
     va_end(args);
@@ -253,8 +666,37 @@ int fwk_log_unbuffer(void)
     unsigned char fetched;
     char ch;
 
+#    ifdef FWK_LOG_DEFERRED
+    struct fwk_log_record record;
+    uint32_t words[FMW_LOG_DEFERRED_ARGS_MAX];
+    bool format_record = false;
+    size_t written;
+#    endif
+
     flags = fwk_interrupt_global_disable();
 
+#    ifdef FWK_LOG_DEFERRED
+    if (fwk_log_ctx.line_written < fwk_log_ctx.line_length) {
+        /*
+         * A deferred message has been formatted and is being written out.
+         * Write as much of it as the drain accepts.
+         */
+
+        status = fwk_io_write_nowait(
+            fwk_log_stream,
+            &written,
+            &fwk_log_ctx.line[fwk_log_ctx.line_written],
+            fwk_log_ctx.line_length - fwk_log_ctx.line_written);
+        fwk_log_ctx.line_written += written;
+
+        if ((status == FWK_SUCCESS) || (status == FWK_E_BUSY)) {
+            status = FWK_PENDING;
+        }
+
+        goto exit;
+    }
+#    endif
+
     if (fwk_log_ctx.remaining == 0) {
         /*
          * We've finished printing whatever message we were previously on, so we
@@ -284,6 +726,26 @@ int fwk_log_unbuffer(void)
 
             goto exit;
         }
+
+#    ifdef FWK_LOG_DEFERRED
+        if (fwk_log_ctx.remaining == FWK_LOG_RECORD_MARKER) {
+            /*
+             * This is a deferred record. Take it out of the ring buffer and
+             * format it once the critical section is over.
+             */
+
+            fwk_ring_pop(&fwk_log_ctx.ring, (char *)&record, sizeof(record));
+            fwk_ring_pop(
+                &fwk_log_ctx.ring,
+                (char *)words,
+                record.word_count * sizeof(words[0]));
+
+            format_record = true;
+            status = FWK_PENDING;
+
+            goto exit;
+        }
+#    endif
     }
 
     /*
@@ -317,6 +779,12 @@ int fwk_log_unbuffer(void)
 
 exit:
     fwk_interrupt_global_enable(flags);
+
+#    ifdef FWK_LOG_DEFERRED
+    if (format_record) {
+        fwk_log_format_record(&record, words);
+    }
+#    endif
 #endif
 
     return status;
@@ -77,24 +77,9 @@ static size_t fwk_module_count_elements(const struct fwk_element *elements)
     return count;
 }
 
-#ifdef BUILD_HAS_NOTIFICATION
-static void fwk_module_init_subscriptions(struct fwk_dlist **list, size_t count)
-{
-    *list = fwk_mm_calloc(count, sizeof((*list)[0]));
-    if (*list == NULL) {
-        fwk_trap();
-    }
-
-    for (size_t i = 0; i < count; i++) {
-        fwk_list_init(&((*list)[i]));
-    }
-}
-#endif
-
 static void fwk_module_init_element_ctx(
     struct fwk_element_ctx *ctx,
-    const struct fwk_element *element,
-    size_t notification_count)
+    const struct fwk_element *element)
 {
     *ctx = (struct fwk_element_ctx){
         .state = FWK_MODULE_STATE_UNINITIALIZED,
@@ -103,19 +88,11 @@ static void fwk_module_init_element_ctx(
     };
 
     fwk_list_init(&ctx->delayed_response_list);
-
-#ifdef BUILD_HAS_NOTIFICATION
-    if (notification_count > 0) {
-        fwk_module_init_subscriptions(
-            &ctx->subscription_dlist_table, notification_count);
-    }
-#endif
 }
 
 static void fwk_module_init_element_ctxs(
     struct fwk_module_context *ctx,
-    const struct fwk_element *elements,
-    size_t notification_count)
+    const struct fwk_element *elements)
 {
     ctx->element_count = fwk_module_count_elements(elements);
 
@@ -126,8 +103,7 @@ static void fwk_module_init_element_ctxs(
     }
 
     for (size_t i = 0; i < ctx->element_count; i++) {
-        fwk_module_init_element_ctx(
-            &ctx->element_ctx_table[i], &elements[i], notification_count);
+        fwk_module_init_element_ctx(&ctx->element_ctx_table[i], &elements[i]);
     }
 }
 
@@ -158,22 +134,8 @@ void fwk_module_init(void)
         fwk_list_init(&ctx->delayed_response_list);
 
         if (config->elements.type == FWK_MODULE_ELEMENTS_TYPE_STATIC) {
-            size_t notification_count = 0;
-
-#ifdef BUILD_HAS_NOTIFICATION
-            notification_count = desc->notification_count;
-#endif
-
-            fwk_module_init_element_ctxs(
-                ctx, config->elements.table, notification_count);
-        }
-
-#ifdef BUILD_HAS_NOTIFICATION
-        if (desc->notification_count > 0) {
-            fwk_module_init_subscriptions(
-                &ctx->subscription_dlist_table, desc->notification_count);
+            fwk_module_init_element_ctxs(ctx, config->elements.table);
         }
-#endif
     }
 }
 
@@ -229,8 +191,6 @@ static void fwk_module_init_module(struct fwk_module_context *ctx)
     }
 
     if (config->elements.type == FWK_MODULE_ELEMENTS_TYPE_DYNAMIC) {
-        size_t notification_count = 0;
-
         const struct fwk_element *elements = NULL;
 
         if (config->elements.generator == NULL) {
@@ -242,11 +202,7 @@ static void fwk_module_init_module(struct fwk_module_context *ctx)
             fwk_trap();
         }
 
-#ifdef BUILD_HAS_NOTIFICATION
-        notification_count = desc->notification_count;
-#endif
-
-        fwk_module_init_element_ctxs(ctx, elements, notification_count);
+        fwk_module_init_element_ctxs(ctx, elements);
     }
 
     status = desc->init(ctx->id, ctx->element_count, config->data);
@@ -275,6 +231,54 @@ static void fwk_module_init_modules(void)
     }
 }
 
+#ifdef BUILD_HAS_NOTIFICATION
+/*
+ * Build the notification subscription tables. This is done once all the
+ * elements are known, so that a single allocation holds the subscribers to
+ * every notification of every module and element.
+ */
+static void fwk_module_init_subscriptions(void)
+{
+    unsigned int module_idx;
+    size_t element_idx, entry_count = 0;
+    size_t notification_count;
+    struct fwk_module_context *ctx;
+    struct __fwk_notification_subscribers *subscription_table;
+
+    for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
+        ctx = &fwk_module_ctx.module_ctx_table[module_idx];
+        entry_count +=
+            ctx->desc->notification_count * (ctx->element_count + 1);
+    }
+
+    if (entry_count == 0) {
+        return;
+    }
+
+    subscription_table =
+        fwk_mm_calloc(entry_count, sizeof(subscription_table[0]));
+
+    for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
+        ctx = &fwk_module_ctx.module_ctx_table[module_idx];
+
+        notification_count = ctx->desc->notification_count;
+        if (notification_count == 0) {
+            continue;
+        }
+
+        ctx->subscription_table = subscription_table;
+        subscription_table += notification_count;
+
+        for (element_idx = 0; element_idx < ctx->element_count;
+             element_idx++) {
+            ctx->element_ctx_table[element_idx].subscription_table =
+                subscription_table;
+            subscription_table += notification_count;
+        }
+    }
+}
+#endif
+
 static int fwk_module_bind_elements(
     struct fwk_module_context *fwk_mod_ctx,
     unsigned int round)
@@ -443,6 +447,10 @@ int fwk_module_start(void)
         }
     }
 
+#ifdef BUILD_HAS_NOTIFICATION
+    fwk_module_init_subscriptions();
+#endif
+
     fwk_module_ctx.stage = MODULE_STAGE_START;
     status = start_modules();
     if (status != FWK_SUCCESS) {
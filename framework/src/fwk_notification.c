@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2018-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -13,29 +13,24 @@
 #include <internal/fwk_notification.h>
 
 #include <fwk_assert.h>
-#include <fwk_attributes.h>
-#include <fwk_dlist.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
-#include <fwk_list.h>
 #include <fwk_log.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_notification.h>
 #include <fwk_status.h>
+#include <fwk_string.h>
 
 #include <stdbool.h>
 #include <stddef.h>
 
-struct notification_ctx {
-    /*
-     * Queue of notification subscription structures that are free.
-     */
-    struct fwk_dlist free_subscription_dlist;
-};
-
-static struct notification_ctx ctx;
+/*
+ * Initial number of entries of a target table. Tables double in size when they
+ * are full.
+ */
+#define SUBSCRIBER_TABLE_MIN_CAPACITY 2
 
 #if (FWK_LOG_LEVEL < FWK_LOG_LEVEL_DISABLED)
 static const char err_msg_func[] = "[NOT] Error %d in %s";
@@ -46,65 +41,106 @@ static const char err_msg_func[] = "[NOT] Error %d in %s";
  */
 
 /*
- * Get list of subscriptions for a given notification emitted by a given source
+ * Get the subscribers for a given notification emitted by a given source
  *
  * \note The function assumes the validity of all its input parameters.
  *
  * \param notification_id Identifier of the notification.
  * \param source_id Identifier of the emitter of the notification.
  *
- * \return A pointer to the doubly-linked list of subscriptions.
+ * \return A pointer to the subscribers of the notification, NULL if the
+ *      subscription tables have not been built yet.
  */
-static struct fwk_dlist *get_subscription_dlist(
-    fwk_id_t notification_id, fwk_id_t source_id)
+static struct __fwk_notification_subscribers *get_subscribers(
+    fwk_id_t notification_id,
+    fwk_id_t source_id)
 {
-    struct fwk_dlist *subscription_dlist_table;
+    struct __fwk_notification_subscribers *subscription_table;
 
     if (fwk_id_is_type(source_id, FWK_ID_TYPE_MODULE)) {
-        subscription_dlist_table =
-            fwk_module_get_ctx(source_id)->subscription_dlist_table;
+        subscription_table = fwk_module_get_ctx(source_id)->subscription_table;
     } else {
-        subscription_dlist_table =
-            fwk_module_get_element_ctx(source_id)->subscription_dlist_table;
+        subscription_table =
+            fwk_module_get_element_ctx(source_id)->subscription_table;
+    }
+
+    if (subscription_table == NULL) {
+        return NULL;
     }
 
-    return &subscription_dlist_table[
-               fwk_id_get_notification_idx(notification_id)];
+    return &subscription_table[fwk_id_get_notification_idx(notification_id)];
 }
 
 /*
- * Search for a subscription with a given source and target identifier in a list
- * of subscriptions.
- *
- * \note The function assumes the validity of all its input parameters.
+ * Search for a target in the subscribers of a notification.
  *
- * \param subscription_dlist Pointer to the doubly-linked list of subscriptions
- *      to search.
- * \param source_id Identifier of the emitter of the notification.
+ * \param subscribers Pointer to the subscribers to search.
  * \param target_id Identifier of the target of the notification.
  *
- * \return A pointer to the subscription that has been found if any, NULL
- *      otherwise.
+ * \return The index of the target in the target table if found, the number of
+ *      subscribers otherwise.
  */
-static struct __fwk_notification_subscription *search_subscription(
-    struct fwk_dlist *subscription_dlist,
-    fwk_id_t source_id, fwk_id_t target_id)
+static unsigned int search_subscription(
+    const struct __fwk_notification_subscribers *subscribers,
+    fwk_id_t target_id)
 {
-    struct fwk_dlist_node *node;
-    struct __fwk_notification_subscription *subscription;
+    unsigned int idx;
 
-    for (node = fwk_list_head(subscription_dlist); node != NULL;
-         node = fwk_list_next(subscription_dlist, node)) {
-        subscription = FWK_LIST_GET(node,
-            struct __fwk_notification_subscription, dlist_node);
-
-        if (fwk_id_is_equal(subscription->source_id, source_id) &&
-            fwk_id_is_equal(subscription->target_id, target_id)) {
-            return subscription;
+    for (idx = 0; idx < subscribers->count; idx++) {
+        if (fwk_id_is_equal(subscribers->target_table[idx], target_id)) {
+            break;
         }
     }
 
-    return NULL;
+    return idx;
+}
+
+/*
+ * Make room for one more target in the subscribers of a notification.
+ *
+ * \note The new table is fully populated before it replaces the current one so
+ *      that notifications sent from interrupt handlers always see a consistent
+ *      table.
+ *
+ * \param subscribers Pointer to the subscribers to grow.
+ *
+ * \retval ::FWK_SUCCESS There is room for one more target.
+ * \retval ::FWK_E_NOMEM The target table could not be reallocated.
+ */
+static int grow_subscribers(struct __fwk_notification_subscribers *subscribers)
+{
+    unsigned int flags;
+    unsigned int capacity;
+    fwk_id_t *target_table, *old_target_table;
+
+    if (subscribers->count < subscribers->capacity) {
+        return FWK_SUCCESS;
+    }
+
+    capacity = (subscribers->capacity == 0) ? SUBSCRIBER_TABLE_MIN_CAPACITY :
+                                              (subscribers->capacity * 2);
+
+    target_table = fwk_mm_alloc_notrap(capacity, sizeof(target_table[0]));
+    if (target_table == NULL) {
+        return FWK_E_NOMEM;
+    }
+
+    if (subscribers->count > 0) {
+        fwk_str_memcpy(
+            target_table,
+            subscribers->target_table,
+            subscribers->count * sizeof(target_table[0]));
+    }
+
+    flags = fwk_interrupt_global_disable();
+    old_target_table = subscribers->target_table;
+    subscribers->target_table = target_table;
+    subscribers->capacity = capacity;
+    (void)fwk_interrupt_global_enable(flags);
+
+    fwk_mm_free(old_target_table);
+
+    return FWK_SUCCESS;
 }
 
 /*
@@ -120,26 +156,20 @@ static void send_notifications(struct fwk_event *notification_event,
                                unsigned int *count)
 {
     int status;
-    struct fwk_dlist *subscription_dlist;
-    struct fwk_dlist_node *node;
-    struct __fwk_notification_subscription *subscription;
+    unsigned int idx;
+    const struct __fwk_notification_subscribers *subscribers;
 
-    subscription_dlist = get_subscription_dlist(notification_event->id,
-                                                notification_event->source_id);
     notification_event->is_response = false;
     notification_event->is_notification = true;
 
-    for (node = fwk_list_head(subscription_dlist); node != NULL;
-         node = fwk_list_next(subscription_dlist, node)) {
-        subscription = FWK_LIST_GET(node,
-            struct __fwk_notification_subscription, dlist_node);
-
-        if (!fwk_id_is_equal(
-                subscription->source_id, notification_event->source_id)) {
-            continue;
-        }
+    subscribers = get_subscribers(
+        notification_event->id, notification_event->source_id);
+    if (subscribers == NULL) {
+        return;
+    }
 
-        notification_event->target_id = subscription->target_id;
+    for (idx = 0; idx < subscribers->count; idx++) {
+        notification_event->target_id = subscribers->target_table[idx];
 
         status = __fwk_put_notification(notification_event);
         if (status == FWK_SUCCESS) {
@@ -148,31 +178,6 @@ static void send_notifications(struct fwk_event *notification_event,
     }
 }
 
-/*
- * Private interface functions
- */
-
-static FWK_CONSTRUCTOR void fwk_notification_init(void)
-{
-    static struct __fwk_notification_subscription
-        subscriptions[FMW_NOTIFICATION_MAX];
-
-    unsigned int i;
-
-    /* All the subscription structures are free to be used */
-    fwk_list_init(&ctx.free_subscription_dlist);
-
-    for (i = 0; i < FMW_NOTIFICATION_MAX; i++) {
-        fwk_list_push_tail(
-            &ctx.free_subscription_dlist, &subscriptions[i].dlist_node);
-    }
-}
-
-void __fwk_notification_reset(void)
-{
-    fwk_notification_init();
-}
-
 /*
  * Public interface functions
  */
@@ -182,8 +187,7 @@ int fwk_notification_subscribe(fwk_id_t notification_id, fwk_id_t source_id,
 {
     int status;
     unsigned int flags;
-    struct fwk_dlist *subscription_dlist;
-    struct __fwk_notification_subscription *subscription;
+    struct __fwk_notification_subscribers *subscribers;
 
     if (fwk_is_interrupt_context()) {
         status = FWK_E_HANDLER;
@@ -199,27 +203,25 @@ int fwk_notification_subscribe(fwk_id_t notification_id, fwk_id_t source_id,
         goto error;
     }
 
-    subscription_dlist = get_subscription_dlist(notification_id, source_id);
-    if (search_subscription(subscription_dlist, source_id, target_id) != NULL) {
-        status = FWK_E_STATE;
+    subscribers = get_subscribers(notification_id, source_id);
+    if (subscribers == NULL) {
+        status = FWK_E_INIT;
         goto error;
     }
 
-    subscription = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx.free_subscription_dlist),
-        struct __fwk_notification_subscription, dlist_node);
+    if (search_subscription(subscribers, target_id) != subscribers->count) {
+        status = FWK_E_STATE;
+        goto error;
+    }
 
-    if (subscription == NULL) {
-        status = FWK_E_NOMEM;
+    status = grow_subscribers(subscribers);
+    if (status != FWK_SUCCESS) {
         fwk_unexpected();
         goto error;
     }
 
-    subscription->source_id = source_id;
-    subscription->target_id = target_id;
-
     flags = fwk_interrupt_global_disable();
-    fwk_list_push_tail(subscription_dlist, &subscription->dlist_node);
+    subscribers->target_table[subscribers->count++] = target_id;
     (void)fwk_interrupt_global_enable(flags);
 
     return FWK_SUCCESS;
@@ -233,9 +235,8 @@ int fwk_notification_unsubscribe(fwk_id_t notification_id, fwk_id_t source_id,
                                  fwk_id_t target_id)
 {
     int status;
-    unsigned int flags;
-    struct fwk_dlist *subscription_dlist;
-    struct __fwk_notification_subscription *subscription;
+    unsigned int flags, idx;
+    struct __fwk_notification_subscribers *subscribers;
 
     if (fwk_is_interrupt_context()) {
         status = FWK_E_HANDLER;
@@ -251,18 +252,25 @@ int fwk_notification_unsubscribe(fwk_id_t notification_id, fwk_id_t source_id,
         goto error;
     }
 
-    subscription_dlist = get_subscription_dlist(notification_id, source_id);
-    subscription = search_subscription(subscription_dlist,
-                                       source_id, target_id);
-    if (subscription == NULL) {
+    subscribers = get_subscribers(notification_id, source_id);
+    if (subscribers == NULL) {
         status = FWK_E_STATE;
         goto error;
     }
 
+    idx = search_subscription(subscribers, target_id);
+    if (idx == subscribers->count) {
+        status = FWK_E_STATE;
+        goto error;
+    }
+
+    /* Keep the remaining targets in subscription order */
     flags = fwk_interrupt_global_disable();
-    fwk_list_remove(subscription_dlist, &subscription->dlist_node);
+    subscribers->count--;
+    for (; idx < subscribers->count; idx++) {
+        subscribers->target_table[idx] = subscribers->target_table[idx + 1];
+    }
     (void)fwk_interrupt_global_enable(flags);
-    fwk_list_push_tail(&ctx.free_subscription_dlist, &subscription->dlist_node);
 
     return FWK_SUCCESS;
 
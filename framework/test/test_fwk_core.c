@@ -16,6 +16,7 @@
 #include <fwk_slist.h>
 #include <fwk_status.h>
 #include <fwk_test.h>
+#include <fwk_time.h>
 
 #include <setjmp.h>
 #include <stdbool.h>
@@ -37,12 +38,65 @@ void *__wrap_fwk_mm_calloc(size_t num, size_t size)
     return NULL;
 }
 
+/* Modules declaring the priority class of the events they process */
+#define HIGH_PRIORITY_MODULE_IDX  0x8
+#define LOW_PRIORITY_MODULE_IDX   0x9
+#define MIXED_PRIORITY_MODULE_IDX 0xA
+
+static const enum fwk_event_priority mixed_event_priorities[] = {
+    FWK_EVENT_PRIORITY_LOW,
+    FWK_EVENT_PRIORITY_HIGH,
+};
+
 static struct fwk_module fake_module_desc;
 static struct fwk_module_context fake_module_ctx;
+static struct fwk_module high_priority_module_desc = {
+    .event_priority = FWK_EVENT_PRIORITY_HIGH,
+};
+static struct fwk_module_context high_priority_module_ctx = {
+    .desc = &high_priority_module_desc,
+};
+static struct fwk_module low_priority_module_desc = {
+    .event_priority = FWK_EVENT_PRIORITY_LOW,
+};
+static struct fwk_module_context low_priority_module_ctx = {
+    .desc = &low_priority_module_desc,
+};
+static struct fwk_module mixed_priority_module_desc = {
+    .event_count = FWK_ARRAY_SIZE(mixed_event_priorities),
+    .event_priorities = mixed_event_priorities,
+};
+static struct fwk_module_context mixed_priority_module_ctx = {
+    .desc = &mixed_priority_module_desc,
+};
 struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
 {
-    return &fake_module_ctx;
+    switch (fwk_id_get_module_idx(id)) {
+    case HIGH_PRIORITY_MODULE_IDX:
+        return &high_priority_module_ctx;
+    case LOW_PRIORITY_MODULE_IDX:
+        return &low_priority_module_ctx;
+    case MIXED_PRIORITY_MODULE_IDX:
+        return &mixed_priority_module_ctx;
+    default:
+        return &fake_module_ctx;
+    }
+}
+
+#ifdef FWK_EVENT_QUEUE_STATS_ENABLE
+static fwk_timestamp_t fake_time;
+static fwk_timestamp_t fake_timestamp(const void *ctx)
+{
+    return fake_time;
+}
+
+struct fwk_time_driver fmw_time_driver(const void **ctx)
+{
+    return (struct fwk_time_driver){
+        .timestamp = fake_timestamp,
+    };
 }
+#endif
 
 bool free_event_queue_break;
 extern void __real___fwk_slist_push_tail(
@@ -98,11 +152,17 @@ bool __wrap_fwk_is_interrupt_context(void)
 }
 
 static const struct fwk_event *processed_event;
+static fwk_id_t processed_ids[8];
+static unsigned int processed_count;
 static int process_event(
     const struct fwk_event *event,
     struct fwk_event *response_event)
 {
     processed_event = event;
+    if (processed_count < FWK_ARRAY_SIZE(processed_ids)) {
+        processed_ids[processed_count] = event->id;
+    }
+    processed_count++;
     return FWK_SUCCESS;
 }
 
@@ -122,6 +182,9 @@ static int test_suite_setup(void)
     fake_module_desc.process_event = process_event;
     fake_module_desc.process_notification = process_notification;
     fake_module_ctx.desc = &fake_module_desc;
+    high_priority_module_desc.process_event = process_event;
+    low_priority_module_desc.process_event = process_event;
+    mixed_priority_module_desc.process_event = process_event;
     return FWK_SUCCESS;
 }
 
@@ -133,16 +196,21 @@ static void test_case_setup(void)
     is_valid_notification_id_return_val = true;
     interrupt_get_current_return_val = false;
     fwk_mm_calloc_return_val = true;
+    processed_count = 0;
     fake_module_desc.process_event = process_event;
     fake_module_ctx.desc = &fake_module_desc;
 }
 
 static void test_case_teardown(void)
 {
+    unsigned int priority;
+
     *ctx = (struct __fwk_ctx){};
     fwk_list_init(&ctx->free_event_queue);
-    fwk_list_init(&ctx->event_queue);
     fwk_list_init(&ctx->isr_event_queue);
+    for (priority = 0; priority < FWK_EVENT_PRIORITY_COUNT; priority++) {
+        fwk_list_init(&ctx->event_queue[priority]);
+    }
 }
 
 static void test___fwk_init(void)
@@ -167,6 +235,8 @@ static void test___fwk_run_main_loop(void)
 {
     int result;
     struct fwk_event *free_event, *allocated_event;
+    struct fwk_slist *event_queue =
+        &ctx->event_queue[FWK_EVENT_PRIORITY_NORMAL];
 
     struct fwk_event event1 = {
         .source_id = FWK_ID_MODULE(0x1),
@@ -210,19 +280,18 @@ static void test___fwk_run_main_loop(void)
     allocated_event = FWK_LIST_GET(
         fwk_list_head(&ctx->free_event_queue), struct fwk_event, slist_node);
 
-    __real___fwk_slist_push_tail(&ctx->event_queue, &(event1.slist_node));
-    __real___fwk_slist_push_tail(&ctx->event_queue, &(event2.slist_node));
+    __real___fwk_slist_push_tail(event_queue, &(event1.slist_node));
+    __real___fwk_slist_push_tail(event_queue, &(event2.slist_node));
     __real___fwk_slist_push_tail(&ctx->isr_event_queue, &(event3.slist_node));
     __real___fwk_slist_push_tail(
         &ctx->isr_event_queue, &(notification1.slist_node));
 
-    /* Event1 processing */
+    /* Event1 processing, after both ISR events have been pulled in */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_run_main_loop();
-    assert(ctx->isr_event_queue.head == &(event3.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(ctx->event_queue.head == &(event2.slist_node));
-    assert(ctx->event_queue.tail == &(allocated_event->slist_node));
+    assert(fwk_list_is_empty(&ctx->isr_event_queue));
+    assert(event_queue->head == &(event2.slist_node));
+    assert(event_queue->tail == &(allocated_event->slist_node));
 
     free_event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx->free_event_queue),
@@ -238,10 +307,8 @@ static void test___fwk_run_main_loop(void)
     /* Event2 processing */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_run_main_loop();
-    assert(ctx->isr_event_queue.head == &(event3.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(ctx->event_queue.head == &(allocated_event->slist_node));
-    assert(ctx->event_queue.tail == &(allocated_event->slist_node));
+    assert(event_queue->head == &(event3.slist_node));
+    assert(event_queue->tail == &(allocated_event->slist_node));
 
     free_event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx->free_event_queue),
@@ -254,32 +321,11 @@ static void test___fwk_run_main_loop(void)
     assert(processed_notification->response_requested == false);
     assert(processed_notification->is_notification == true);
 
-    /* Response to Event1 processing */
-    if (setjmp(test_context) == FWK_SUCCESS)
-        __fwk_run_main_loop();
-    assert(ctx->isr_event_queue.head == &(event3.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(fwk_list_is_empty(&ctx->event_queue));
-
-    free_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx->free_event_queue),
-        struct fwk_event,
-        slist_node);
-    assert(free_event == allocated_event);
-    assert(processed_event == allocated_event);
-    assert(processed_event->is_response == true);
-    assert(processed_event->response_requested == false);
-    assert(processed_event->is_notification == false);
-    assert(fwk_id_is_equal(processed_event->source_id, FWK_ID_MODULE(0x2)));
-    assert(fwk_id_is_equal(processed_event->target_id, FWK_ID_MODULE(0x1)));
-    assert(fwk_id_is_equal(processed_event->id, FWK_ID_EVENT(0x2, 0x7)));
-
-    /* Extract ISR Event3 and process it */
+    /* ISR Event3 processing */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_run_main_loop();
-    assert(ctx->isr_event_queue.head == &(notification1.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(fwk_list_is_empty(&ctx->event_queue));
+    assert(event_queue->head == &(notification1.slist_node));
+    assert(event_queue->tail == &(allocated_event->slist_node));
 
     free_event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx->free_event_queue),
@@ -291,15 +337,14 @@ static void test___fwk_run_main_loop(void)
     assert(processed_event->response_requested == false);
     assert(processed_event->is_notification == false);
 
-    /* Extract ISR Notification1 and process it */
+    /* ISR Notification1 processing, its response needs a free event */
     free_event_queue_break = false;
-    fwk_list_push_tail(&ctx->free_event_queue, &(allocated_event->slist_node));
+    fwk_list_push_tail(&ctx->free_event_queue, &(event2.slist_node));
     free_event_queue_break = true;
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_run_main_loop();
-    assert(fwk_list_is_empty(&ctx->isr_event_queue));
-    assert(ctx->event_queue.head == &(allocated_event->slist_node));
-    assert(ctx->event_queue.tail == &(allocated_event->slist_node));
+    assert(event_queue->head == &(allocated_event->slist_node));
+    assert(event_queue->tail == &(event2.slist_node));
 
     free_event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx->free_event_queue),
@@ -311,18 +356,37 @@ static void test___fwk_run_main_loop(void)
     assert(processed_notification->response_requested == true);
     assert(processed_notification->is_notification == true);
 
+    /* Response to Event1 processing */
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_run_main_loop();
+    assert(event_queue->head == &(event2.slist_node));
+    assert(event_queue->tail == &(event2.slist_node));
+
+    free_event = FWK_LIST_GET(
+        fwk_list_pop_head(&ctx->free_event_queue),
+        struct fwk_event,
+        slist_node);
+    assert(free_event == allocated_event);
+    assert(processed_event == allocated_event);
+    assert(processed_event->is_response == true);
+    assert(processed_event->response_requested == false);
+    assert(processed_event->is_notification == false);
+    assert(fwk_id_is_equal(processed_event->source_id, FWK_ID_MODULE(0x2)));
+    assert(fwk_id_is_equal(processed_event->target_id, FWK_ID_MODULE(0x1)));
+    assert(fwk_id_is_equal(processed_event->id, FWK_ID_EVENT(0x2, 0x7)));
+
     /* Process response to Notification1 */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_run_main_loop();
     assert(fwk_list_is_empty(&ctx->isr_event_queue));
-    assert(fwk_list_is_empty(&ctx->event_queue));
+    assert(fwk_list_is_empty(event_queue));
 
     free_event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx->free_event_queue),
         struct fwk_event,
         slist_node);
-    assert(free_event == allocated_event);
-    assert(processed_notification == allocated_event);
+    assert(free_event == &event2);
+    assert(processed_notification == &event2);
     assert(processed_notification->is_response == true);
     assert(processed_notification->response_requested == false);
     assert(processed_notification->is_notification == true);
@@ -381,7 +445,9 @@ static void test_fwk_put_event(void)
     result = fwk_put_event(&event1);
     assert(result == FWK_SUCCESS);
     result_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx->event_queue), struct fwk_event, slist_node);
+        fwk_list_pop_head(&ctx->event_queue[FWK_EVENT_PRIORITY_NORMAL]),
+        struct fwk_event,
+        slist_node);
     assert(fwk_id_is_equal(result_event->source_id, event1.source_id));
     assert(fwk_id_is_equal(result_event->target_id, event1.target_id));
     assert(result_event->is_response == event1.is_response);
@@ -450,7 +516,9 @@ static void test_fwk_put_event_light(void)
     assert(result == FWK_SUCCESS);
     /* Framework always queue light event by converting in a standard event */
     result_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx->event_queue), struct fwk_event, slist_node);
+        fwk_list_pop_head(&ctx->event_queue[FWK_EVENT_PRIORITY_NORMAL]),
+        struct fwk_event,
+        slist_node);
     assert(fwk_id_is_equal(result_event->source_id, event1.source_id));
     assert(fwk_id_is_equal(result_event->target_id, event1.target_id));
     assert(result_event->is_response == false);
@@ -499,7 +567,9 @@ static void test___fwk_put_notification(void)
     result = __fwk_put_notification(&event1);
     assert(result == FWK_SUCCESS);
     result_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx->event_queue), struct fwk_event, slist_node);
+        fwk_list_pop_head(&ctx->event_queue[FWK_EVENT_PRIORITY_NORMAL]),
+        struct fwk_event,
+        slist_node);
     assert(fwk_id_is_equal(result_event->source_id, event1.source_id));
     assert(fwk_id_is_equal(result_event->target_id, event1.target_id));
     assert(result_event->is_response == false);
@@ -520,12 +590,124 @@ static void test___fwk_put_notification(void)
     assert(result_event->is_notification == true);
 }
 
+static void put_test_event(unsigned int module_idx, unsigned int event_idx)
+{
+    int result;
+    struct fwk_event_light event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(module_idx),
+        .id = FWK_ID_EVENT(module_idx, event_idx),
+    };
+
+    result = fwk_put_event(&event);
+    assert(result == FWK_SUCCESS);
+}
+
+static void test_fwk_process_event_queue_priority(void)
+{
+    int result;
+    unsigned int idx;
+
+    static const fwk_id_t expected_order[] = {
+        FWK_ID_EVENT_INIT(HIGH_PRIORITY_MODULE_IDX, 0),
+        FWK_ID_EVENT_INIT(MIXED_PRIORITY_MODULE_IDX, 1),
+        FWK_ID_EVENT_INIT(HIGH_PRIORITY_MODULE_IDX, 1),
+        FWK_ID_EVENT_INIT(0x2, 7),
+        FWK_ID_EVENT_INIT(MIXED_PRIORITY_MODULE_IDX, 2),
+        FWK_ID_EVENT_INIT(LOW_PRIORITY_MODULE_IDX, 0),
+        FWK_ID_EVENT_INIT(MIXED_PRIORITY_MODULE_IDX, 0),
+    };
+
+    result = __fwk_init(FWK_ARRAY_SIZE(expected_order));
+    assert(result == FWK_SUCCESS);
+
+    put_test_event(LOW_PRIORITY_MODULE_IDX, 0);
+    put_test_event(0x2, 7);
+    put_test_event(HIGH_PRIORITY_MODULE_IDX, 0);
+    put_test_event(MIXED_PRIORITY_MODULE_IDX, 0);
+    put_test_event(MIXED_PRIORITY_MODULE_IDX, 1);
+    /* Beyond the per-event table, falls back to the module class */
+    put_test_event(MIXED_PRIORITY_MODULE_IDX, 2);
+
+    assert(fwk_list_is_empty(&ctx->isr_event_queue));
+    assert(!fwk_list_is_empty(&ctx->event_queue[FWK_EVENT_PRIORITY_HIGH]));
+    assert(!fwk_list_is_empty(&ctx->event_queue[FWK_EVENT_PRIORITY_NORMAL]));
+    assert(!fwk_list_is_empty(&ctx->event_queue[FWK_EVENT_PRIORITY_LOW]));
+
+    /* Urgent event raised by an interrupt handler */
+    interrupt_get_current_return_val = true;
+    put_test_event(HIGH_PRIORITY_MODULE_IDX, 1);
+    interrupt_get_current_return_val = false;
+
+    fwk_process_event_queue();
+
+    assert(processed_count == FWK_ARRAY_SIZE(expected_order));
+    for (idx = 0; idx < FWK_ARRAY_SIZE(expected_order); idx++) {
+        assert(fwk_id_is_equal(processed_ids[idx], expected_order[idx]));
+    }
+
+    assert(fwk_list_is_empty(&ctx->isr_event_queue));
+    for (idx = 0; idx < FWK_EVENT_PRIORITY_COUNT; idx++) {
+        assert(fwk_list_is_empty(&ctx->event_queue[idx]));
+    }
+}
+
+static void test_fwk_get_event_queue_stats(void)
+{
+    int result;
+    struct fwk_event_queue_stats stats;
+
+#ifdef FWK_EVENT_QUEUE_STATS_ENABLE
+    result = __fwk_init(4);
+    assert(result == FWK_SUCCESS);
+
+    result = fwk_get_event_queue_stats(FWK_EVENT_PRIORITY_COUNT, &stats);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_get_event_queue_stats(FWK_EVENT_PRIORITY_NORMAL, NULL);
+    assert(result == FWK_E_PARAM);
+
+    fake_time = 100;
+    put_test_event(0x2, 7);
+    fake_time = 200;
+    interrupt_get_current_return_val = true;
+    put_test_event(HIGH_PRIORITY_MODULE_IDX, 0);
+    interrupt_get_current_return_val = false;
+    fake_time = 250;
+    put_test_event(0x2, 7);
+
+    fake_time = 500;
+    fwk_process_event_queue();
+
+    result = fwk_get_event_queue_stats(FWK_EVENT_PRIORITY_NORMAL, &stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.event_count == 2);
+    assert(stats.total_residency == (400 + 250));
+    assert(stats.max_residency == 400);
+
+    result = fwk_get_event_queue_stats(FWK_EVENT_PRIORITY_HIGH, &stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.event_count == 1);
+    assert(stats.total_residency == 300);
+    assert(stats.max_residency == 300);
+
+    result = fwk_get_event_queue_stats(FWK_EVENT_PRIORITY_LOW, &stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.event_count == 0);
+#else
+    result = fwk_get_event_queue_stats(FWK_EVENT_PRIORITY_NORMAL, &stats);
+    assert(result == FWK_E_SUPPORT);
+#endif
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test___fwk_init),
     FWK_TEST_CASE(test___fwk_run_main_loop),
     FWK_TEST_CASE(test_fwk_put_event),
     FWK_TEST_CASE(test_fwk_put_event_light),
-    FWK_TEST_CASE(test___fwk_put_notification)
+    FWK_TEST_CASE(test___fwk_put_notification),
+    FWK_TEST_CASE(test_fwk_process_event_queue_priority),
+    FWK_TEST_CASE(test_fwk_get_event_queue_stats),
 };
 
 struct fwk_test_suite_desc test_suite = {
@@ -0,0 +1,274 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/fwk_event_profile.h>
+
+#include <fwk_event.h>
+#include <fwk_event_profile.h>
+#include <fwk_id.h>
+#include <fwk_io.h>
+#include <fwk_macros.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+#include <fwk_time.h>
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MODULE_IDX 0x2
+#define OTHER_MODULE_IDX 0x3
+
+static uint8_t stream_buffer[
+    sizeof(struct fwk_event_profile_header) +
+    (2 * sizeof(struct fwk_event_profile_entry))];
+static size_t stream_length;
+
+static int stream_putch(const struct fwk_io_stream *stream, char ch)
+{
+    if (stream_length == sizeof(stream_buffer)) {
+        return FWK_E_NOMEM;
+    }
+
+    stream_buffer[stream_length++] = (uint8_t)ch;
+
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_io_stream stream = {
+    .adapter =
+        &(const struct fwk_io_adapter){
+            .putch = stream_putch,
+        },
+    .id = FWK_ID_NONE_INIT,
+    .mode = (enum fwk_io_mode)(FWK_IO_MODE_WRITE | FWK_IO_MODE_BINARY),
+};
+
+static void record(
+    fwk_id_t target_id,
+    fwk_id_t event_id,
+    fwk_timestamp_t queued_at,
+    fwk_timestamp_t dispatched_at,
+    fwk_timestamp_t completed_at)
+{
+    struct fwk_event event = {
+        .target_id = target_id,
+        .id = event_id,
+        .queued_at = queued_at,
+    };
+
+    __fwk_event_profile_record(&event, dispatched_at, completed_at);
+}
+
+static void test_case_setup(void)
+{
+    fwk_event_profile_reset();
+    stream_length = 0;
+}
+
+static void test_fwk_event_profile_record(void)
+{
+    int status;
+    unsigned int entry_count;
+    uint32_t dropped;
+    struct fwk_event_profile_entry entry;
+    fwk_id_t event_id = FWK_ID_EVENT(MODULE_IDX, 1);
+
+    /* 3us queued, 0.5us in the handler */
+    record(
+        FWK_ID_MODULE(MODULE_IDX), event_id, FWK_US(10), FWK_US(13), 13500);
+
+    /* Events for elements of a module are accounted to the module */
+    record(
+        FWK_ID_ELEMENT(MODULE_IDX, 4),
+        event_id,
+        FWK_US(20),
+        FWK_US(21),
+        FWK_US(31));
+
+    status = fwk_event_profile_get_count(&entry_count, &dropped);
+    assert(status == FWK_SUCCESS);
+    assert(entry_count == 1);
+    assert(dropped == 0);
+
+    status = fwk_event_profile_get_entry(0, &entry);
+    assert(status == FWK_SUCCESS);
+    assert(fwk_id_is_equal(entry.target_id, FWK_ID_MODULE(MODULE_IDX)));
+    assert(fwk_id_is_equal(entry.event_id, event_id));
+    assert(entry.count == 2);
+
+    assert(entry.wait.total == FWK_US(4));
+    assert(entry.wait.max == FWK_US(3));
+    assert(entry.wait.buckets[1] == 1); /* [1us, 2us) */
+    assert(entry.wait.buckets[2] == 1); /* [2us, 4us) */
+
+    assert(entry.handler.total == FWK_NS(500) + FWK_US(10));
+    assert(entry.handler.max == FWK_US(10));
+    assert(entry.handler.buckets[0] == 1); /* < 1us */
+    assert(entry.handler.buckets[4] == 1); /* [8us, 16us) */
+}
+
+static void test_fwk_event_profile_record_clamp(void)
+{
+    int status;
+    struct fwk_event_profile_entry entry;
+
+    /* Timestamps going backwards give zero durations */
+    record(
+        FWK_ID_MODULE(MODULE_IDX),
+        FWK_ID_EVENT(MODULE_IDX, 0),
+        FWK_US(5),
+        FWK_US(4),
+        FWK_US(3));
+
+    /* Very long durations fall in the last bucket */
+    record(
+        FWK_ID_MODULE(MODULE_IDX),
+        FWK_ID_EVENT(MODULE_IDX, 0),
+        0,
+        FWK_S(10),
+        FWK_S(20));
+
+    status = fwk_event_profile_get_entry(0, &entry);
+    assert(status == FWK_SUCCESS);
+    assert(entry.count == 2);
+
+    assert(entry.wait.buckets[0] == 1);
+    assert(entry.wait.buckets[FWK_EVENT_PROFILE_BUCKET_COUNT - 1] == 1);
+    assert(entry.wait.max == FWK_S(10));
+
+    assert(entry.handler.buckets[0] == 1);
+    assert(entry.handler.buckets[FWK_EVENT_PROFILE_BUCKET_COUNT - 1] == 1);
+    assert(entry.handler.max == FWK_S(10));
+}
+
+static void test_fwk_event_profile_table_full(void)
+{
+    int status;
+    unsigned int idx, entry_count;
+    uint32_t dropped;
+    struct fwk_event_profile_entry entry;
+
+    for (idx = 0; idx < FMW_EVENT_PROFILE_ENTRY_MAX; idx++) {
+        record(
+            FWK_ID_MODULE(MODULE_IDX + (idx & 1)),
+            FWK_ID_EVENT(MODULE_IDX + (idx & 1), idx),
+            0,
+            FWK_US(1),
+            FWK_US(2));
+    }
+
+    /* New pairs are dropped, existing pairs are still accounted for */
+    record(
+        FWK_ID_MODULE(OTHER_MODULE_IDX),
+        FWK_ID_EVENT(OTHER_MODULE_IDX, 0),
+        0,
+        FWK_US(1),
+        FWK_US(2));
+    record(
+        FWK_ID_MODULE(MODULE_IDX),
+        FWK_ID_EVENT(MODULE_IDX, 0),
+        0,
+        FWK_US(1),
+        FWK_US(2));
+
+    status = fwk_event_profile_get_count(&entry_count, &dropped);
+    assert(status == FWK_SUCCESS);
+    assert(entry_count == FMW_EVENT_PROFILE_ENTRY_MAX);
+    assert(dropped == 1);
+
+    for (idx = 0; idx < FMW_EVENT_PROFILE_ENTRY_MAX; idx++) {
+        status = fwk_event_profile_get_entry(idx, &entry);
+        assert(status == FWK_SUCCESS);
+        assert(fwk_id_get_event_idx(entry.event_id) == idx);
+        assert(entry.count == ((idx == 0) ? 2 : 1));
+    }
+
+    status = fwk_event_profile_get_entry(idx, &entry);
+    assert(status == FWK_E_RANGE);
+
+    fwk_event_profile_reset();
+
+    status = fwk_event_profile_get_count(&entry_count, &dropped);
+    assert(status == FWK_SUCCESS);
+    assert(entry_count == 0);
+    assert(dropped == 0);
+}
+
+static void test_fwk_event_profile_get_invalid_param(void)
+{
+    int status;
+    struct fwk_event_profile_entry entry;
+
+    status = fwk_event_profile_get_count(NULL, NULL);
+    assert(status == FWK_E_PARAM);
+
+    status = fwk_event_profile_get_entry(0, NULL);
+    assert(status == FWK_E_PARAM);
+
+    status = fwk_event_profile_get_entry(0, &entry);
+    assert(status == FWK_E_RANGE);
+}
+
+static void test_fwk_event_profile_write(void)
+{
+    int status;
+    struct fwk_event_profile_header header;
+    struct fwk_event_profile_entry entry, written_entry;
+
+    record(
+        FWK_ID_MODULE(MODULE_IDX),
+        FWK_ID_EVENT(MODULE_IDX, 0),
+        0,
+        FWK_US(1),
+        FWK_US(2));
+    record(
+        FWK_ID_MODULE(OTHER_MODULE_IDX),
+        FWK_ID_NOTIFICATION(MODULE_IDX, 1),
+        0,
+        FWK_US(3),
+        FWK_US(7));
+
+    status = fwk_event_profile_write(&stream);
+    assert(status == FWK_SUCCESS);
+    assert(stream_length == sizeof(stream_buffer));
+
+    memcpy(&header, stream_buffer, sizeof(header));
+    assert(header.magic == FWK_EVENT_PROFILE_MAGIC);
+    assert(header.version == FWK_EVENT_PROFILE_VERSION);
+    assert(header.bucket_count == FWK_EVENT_PROFILE_BUCKET_COUNT);
+    assert(header.entry_count == 2);
+    assert(header.dropped == 0);
+
+    status = fwk_event_profile_get_entry(1, &entry);
+    assert(status == FWK_SUCCESS);
+    memcpy(
+        &written_entry,
+        stream_buffer + sizeof(header) + sizeof(entry),
+        sizeof(written_entry));
+    assert(memcmp(&entry, &written_entry, sizeof(entry)) == 0);
+
+    /* Errors from the stream are reported */
+    stream_length = sizeof(stream_buffer) - 1;
+    status = fwk_event_profile_write(&stream);
+    assert(status == FWK_E_HANDLER);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_event_profile_record),
+    FWK_TEST_CASE(test_fwk_event_profile_record_clamp),
+    FWK_TEST_CASE(test_fwk_event_profile_table_full),
+    FWK_TEST_CASE(test_fwk_event_profile_get_invalid_param),
+    FWK_TEST_CASE(test_fwk_event_profile_write),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_event_profile",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
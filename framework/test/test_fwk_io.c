@@ -0,0 +1,299 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_id.h>
+#include <fwk_io.h>
+#include <fwk_macros.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Number of characters the fake device moves per block operation */
+#define DEVICE_FIFO_DEPTH 4
+
+static char device_data[32];
+static size_t device_length;
+static size_t device_pos;
+
+/* Number of block operations the device rejects before accepting one */
+static unsigned int device_busy_calls;
+static unsigned int device_busy_countdown;
+
+static unsigned int char_calls;
+static unsigned int block_calls;
+static int block_status;
+
+static int device_getch(const struct fwk_io_stream *stream, char *ch)
+{
+    char_calls++;
+
+    if (device_pos == device_length) {
+        return FWK_PENDING;
+    }
+
+    *ch = device_data[device_pos++];
+
+    return FWK_SUCCESS;
+}
+
+static int device_putch(const struct fwk_io_stream *stream, char ch)
+{
+    char_calls++;
+
+    if (device_length == sizeof(device_data)) {
+        return FWK_E_BUSY;
+    }
+
+    device_data[device_length++] = ch;
+
+    return FWK_SUCCESS;
+}
+
+static int device_read(
+    const struct fwk_io_stream *stream,
+    char *buffer,
+    size_t size,
+    size_t *read)
+{
+    block_calls++;
+
+    if (block_status != FWK_SUCCESS) {
+        return block_status;
+    }
+
+    *read = FWK_MIN(
+        FWK_MIN(size, (size_t)DEVICE_FIFO_DEPTH), device_length - device_pos);
+    if (*read == 0) {
+        return FWK_PENDING;
+    }
+
+    memcpy(buffer, &device_data[device_pos], *read);
+    device_pos += *read;
+
+    return FWK_SUCCESS;
+}
+
+static int device_write(
+    const struct fwk_io_stream *stream,
+    const char *buffer,
+    size_t size,
+    size_t *written)
+{
+    block_calls++;
+
+    if (block_status != FWK_SUCCESS) {
+        return block_status;
+    }
+
+    if (device_busy_countdown > 0) {
+        device_busy_countdown--;
+        return FWK_E_BUSY;
+    }
+
+    device_busy_countdown = device_busy_calls;
+
+    *written = FWK_MIN(
+        FWK_MIN(size, (size_t)DEVICE_FIFO_DEPTH),
+        sizeof(device_data) - device_length);
+    if (*written == 0) {
+        return FWK_E_BUSY;
+    }
+
+    memcpy(&device_data[device_length], buffer, *written);
+    device_length += *written;
+
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_io_adapter block_adapter = {
+    .getch = device_getch,
+    .putch = device_putch,
+    .read = device_read,
+    .write = device_write,
+};
+
+static const struct fwk_io_adapter char_adapter = {
+    .getch = device_getch,
+    .putch = device_putch,
+};
+
+static struct fwk_io_stream block_stream = {
+    .adapter = &block_adapter,
+    .id = FWK_ID_NONE_INIT,
+    .mode = (enum fwk_io_mode)(FWK_IO_MODE_READ | FWK_IO_MODE_WRITE),
+};
+
+static struct fwk_io_stream char_stream = {
+    .adapter = &char_adapter,
+    .id = FWK_ID_NONE_INIT,
+    .mode = (enum fwk_io_mode)(FWK_IO_MODE_READ | FWK_IO_MODE_WRITE),
+};
+
+static const char message[] = "0123456789abcdef";
+
+static void test_case_setup(void)
+{
+    memset(device_data, 0, sizeof(device_data));
+    device_length = 0;
+    device_pos = 0;
+    device_busy_calls = 0;
+    device_busy_countdown = 0;
+    char_calls = 0;
+    block_calls = 0;
+    block_status = FWK_SUCCESS;
+}
+
+static void test_fwk_io_write_block(void)
+{
+    int status;
+    size_t written;
+
+    /* The device only accepts every other block */
+    device_busy_calls = 1;
+
+    status = fwk_io_write(&block_stream, &written, message, 2, 8);
+    assert(status == FWK_SUCCESS);
+    assert(written == 8);
+    assert(device_length == 16);
+    assert(memcmp(device_data, message, 16) == 0);
+
+    /* Four blocks of four characters, each after a busy call */
+    assert(block_calls == 7);
+    assert(char_calls == 0);
+}
+
+static void test_fwk_io_write_char_fallback(void)
+{
+    int status;
+    size_t written;
+
+    status = fwk_io_write(&char_stream, &written, message, 1, 16);
+    assert(status == FWK_SUCCESS);
+    assert(written == 16);
+    assert(memcmp(device_data, message, 16) == 0);
+    assert(char_calls == 16);
+    assert(block_calls == 0);
+}
+
+static void test_fwk_io_write_block_error(void)
+{
+    int status;
+    size_t written;
+    struct fwk_io_stream read_only_stream = block_stream;
+
+    block_status = FWK_E_DEVICE;
+    status = fwk_io_write(&block_stream, &written, message, 1, 16);
+    assert(status == FWK_E_HANDLER);
+    assert(written == 0);
+
+    read_only_stream.mode = FWK_IO_MODE_READ;
+    status = fwk_io_write(&read_only_stream, &written, message, 1, 16);
+    assert(status == FWK_E_SUPPORT);
+}
+
+static void test_fwk_io_write_nowait(void)
+{
+    int status;
+    size_t written;
+
+    /* A partial write reports how much was accepted */
+    status = fwk_io_write_nowait(&block_stream, &written, message, 10);
+    assert(status == FWK_SUCCESS);
+    assert(written == 10);
+
+    device_busy_calls = 1;
+    status = fwk_io_write_nowait(&block_stream, &written, message, 10);
+    assert(status == FWK_E_BUSY);
+    assert(written == 4);
+    assert(device_length == 14);
+
+    /* The caller retries the remainder later */
+    status = fwk_io_write_nowait(&block_stream, &written, &message[4], 6);
+    assert(status == FWK_E_BUSY);
+    assert(written == 4);
+    assert(device_length == 18);
+    assert(memcmp(&device_data[10], message, 8) == 0);
+
+    /* Adapters without block operations stop when the device is full */
+    status = fwk_io_write_nowait(&char_stream, &written, message, 16);
+    assert(status == FWK_E_BUSY);
+    assert(written == (sizeof(device_data) - 18));
+    assert(device_length == sizeof(device_data));
+
+    status = fwk_io_write_nowait(NULL, &written, message, 1);
+    assert(status == FWK_E_PARAM);
+    status = fwk_io_write_nowait(&block_stream, NULL, message, 1);
+    assert(status == FWK_E_PARAM);
+    status = fwk_io_write_nowait(&block_stream, &written, NULL, 1);
+    assert(status == FWK_E_PARAM);
+}
+
+static void test_fwk_io_read_block(void)
+{
+    int status;
+    size_t read;
+    char buffer[16];
+
+    memcpy(device_data, message, 10);
+    device_length = 10;
+
+    status = fwk_io_read(&block_stream, &read, buffer, 2, 4);
+    assert(status == FWK_SUCCESS);
+    assert(read == 4);
+    assert(memcmp(buffer, message, 8) == 0);
+    assert(block_calls == 2);
+    assert(char_calls == 0);
+
+    /* The stream runs dry part-way through */
+    status = fwk_io_read(&block_stream, &read, buffer, 1, 8);
+    assert(status == FWK_PENDING);
+    assert(read == 2);
+    assert(memcmp(buffer, &message[8], 2) == 0);
+
+    status = fwk_io_read(&block_stream, NULL, buffer, 1, 1);
+    assert(status == FWK_E_DATA);
+
+    block_status = FWK_E_DEVICE;
+    status = fwk_io_read(&block_stream, &read, buffer, 1, 1);
+    assert(status == FWK_E_HANDLER);
+}
+
+static void test_fwk_io_read_char_fallback(void)
+{
+    int status;
+    size_t read;
+    char buffer[16];
+
+    memcpy(device_data, message, 10);
+    device_length = 10;
+
+    status = fwk_io_read(&char_stream, &read, buffer, 1, 10);
+    assert(status == FWK_SUCCESS);
+    assert(read == 10);
+    assert(memcmp(buffer, message, 10) == 0);
+    assert(char_calls == 10);
+    assert(block_calls == 0);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_io_write_block),
+    FWK_TEST_CASE(test_fwk_io_write_char_fallback),
+    FWK_TEST_CASE(test_fwk_io_write_block_error),
+    FWK_TEST_CASE(test_fwk_io_write_nowait),
+    FWK_TEST_CASE(test_fwk_io_read_block),
+    FWK_TEST_CASE(test_fwk_io_read_char_fallback),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_io",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
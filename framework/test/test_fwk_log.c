@@ -0,0 +1,190 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_id.h>
+#include <fwk_io.h>
+#include <fwk_log.h>
+#include <fwk_macros.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TIMESTAMP "[    0.000000] "
+
+/* Number of messages that only fit in the buffer once deferred */
+#define DEFERRED_MESSAGE_COUNT 25
+
+static char output[4096];
+static size_t output_length;
+
+static int output_putch(const struct fwk_io_stream *stream, char ch)
+{
+    /* Buffered messages are written with their null terminator */
+    if (ch == '\0') {
+        return FWK_SUCCESS;
+    }
+
+    assert(output_length < (sizeof(output) - 1));
+    output[output_length++] = ch;
+
+    return FWK_SUCCESS;
+}
+
+static struct fwk_io_stream output_stream = {
+    .adapter =
+        &(const struct fwk_io_adapter){
+            .putch = output_putch,
+        },
+    .id = FWK_ID_NONE_INIT,
+    .mode = FWK_IO_MODE_WRITE,
+};
+
+static const char *drain(void)
+{
+    fwk_log_flush();
+
+    output[output_length] = '\0';
+
+    return output;
+}
+
+static int test_suite_setup(void)
+{
+    fwk_io_stdout = &output_stream;
+
+    return fwk_log_init();
+}
+
+static void test_case_setup(void)
+{
+    /* The first message also prints the banner */
+    fwk_log_printf("setup");
+    fwk_log_flush();
+
+    output_length = 0;
+}
+
+static void test_fwk_log_deferred_format(void)
+{
+    char expected[FMW_LOG_COLUMNS];
+    int value = -42;
+    void *pointer = &value;
+
+    fwk_log_printf(
+        "%d %5u %#x %08lx %llu %zu %c %p %%",
+        value,
+        7u,
+        0xBEEFu,
+        0x1234ul,
+        1ull << 40,
+        sizeof(value),
+        'k',
+        pointer);
+
+    snprintf(
+        expected,
+        sizeof(expected),
+        TIMESTAMP "%d %5u %#x %08lx %llu %zu %c %p %%" FMW_LOG_ENDLINE_STR,
+        value,
+        7u,
+        0xBEEFu,
+        0x1234ul,
+        1ull << 40,
+        sizeof(value),
+        'k',
+        pointer);
+
+    assert(strcmp(drain(), expected) == 0);
+}
+
+static void test_fwk_log_deferred_string(void)
+{
+    char name[] = "sensor";
+
+    /* Strings may not outlive the call, so they are formatted immediately */
+    fwk_log_printf("%s %u", name, 3u);
+    memset(name, 'x', sizeof(name) - 1);
+
+    assert(strcmp(drain(), TIMESTAMP "sensor 3" FMW_LOG_ENDLINE_STR) == 0);
+}
+
+static void test_fwk_log_deferred_too_many_args(void)
+{
+    fwk_log_printf("%u%u%u%u%u%u%u%u%u", 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u);
+
+    assert(strcmp(drain(), TIMESTAMP "123456789" FMW_LOG_ENDLINE_STR) == 0);
+}
+
+static void test_fwk_log_deferred_truncated(void)
+{
+    const char *line;
+
+    /* Wider than a line once formatted */
+    fwk_log_printf("%080u%080u", 1u, 2u);
+
+    line = drain();
+    assert(strlen(line) == (FMW_LOG_COLUMNS - 1 + strlen(FMW_LOG_ENDLINE_STR)));
+    assert(strncmp(line, TIMESTAMP "0000", strlen(TIMESTAMP "0000")) == 0);
+}
+
+static void test_fwk_log_deferred_capacity(void)
+{
+    unsigned int idx;
+    char expected[FMW_LOG_COLUMNS];
+    const char *line;
+
+    /*
+     * Formatted, these messages would overflow the buffer. As records, they
+     * all fit and none is dropped.
+     */
+
+    for (idx = 0; idx < DEFERRED_MESSAGE_COUNT; idx++) {
+        fwk_log_printf(
+            "message %u of %u, value 0x%08x",
+            idx,
+            DEFERRED_MESSAGE_COUNT,
+            idx * 0x01010101u);
+    }
+
+    line = drain();
+
+    for (idx = 0; idx < DEFERRED_MESSAGE_COUNT; idx++) {
+        snprintf(
+            expected,
+            sizeof(expected),
+            TIMESTAMP "message %u of %u, value 0x%08x" FMW_LOG_ENDLINE_STR,
+            idx,
+            DEFERRED_MESSAGE_COUNT,
+            idx * 0x01010101u);
+
+        assert(strncmp(line, expected, strlen(expected)) == 0);
+        line += strlen(expected);
+    }
+
+    assert(*line == '\0');
+    assert(DEFERRED_MESSAGE_COUNT * strlen(expected) > FMW_LOG_BUFFER_SIZE);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_log_deferred_format),
+    FWK_TEST_CASE(test_fwk_log_deferred_string),
+    FWK_TEST_CASE(test_fwk_log_deferred_too_many_args),
+    FWK_TEST_CASE(test_fwk_log_deferred_truncated),
+    FWK_TEST_CASE(test_fwk_log_deferred_capacity),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_log",
+    .test_suite_setup = test_suite_setup,
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2018-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,7 @@
 #include <internal/fwk_context.h>
 #include <internal/fwk_core.h>
 #include <internal/fwk_module.h>
+#include <internal/fwk_notification.h>
 
 #include <fwk_assert.h>
 #include <fwk_id.h>
@@ -42,18 +43,16 @@ void *__wrap_fwk_mm_calloc(size_t num, size_t size)
 }
 
 static struct fwk_module_context fake_module_ctx;
-static struct fwk_dlist fake_module_dlist_table[4];
+static struct __fwk_notification_subscribers fake_module_subscription_table[4];
 struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
 {
-    fake_module_ctx.subscription_dlist_table = fake_module_dlist_table;
     return &fake_module_ctx;
 }
 
 static struct fwk_element_ctx fake_element_ctx;
-static struct fwk_dlist fake_element_dlist_table[4];
+static struct __fwk_notification_subscribers fake_element_subscription_table[4];
 struct fwk_element_ctx *__wrap_fwk_module_get_element_ctx(fwk_id_t id)
 {
-    fake_element_ctx.subscription_dlist_table = fake_element_dlist_table;
     return &fake_element_ctx;
 }
 
@@ -85,7 +84,7 @@ bool __wrap_fwk_is_interrupt_context(void)
     return interrupt_get_current_return_val;
 }
 
-static struct fwk_event notification_event_table[4];
+static struct fwk_event notification_event_table[8];
 static unsigned int notification_event_count;
 int __wrap___fwk_put_notification(struct fwk_event *event)
 {
@@ -102,10 +101,20 @@ const struct fwk_event *__wrap___fwk_get_current_event(void)
     return get_current_event_return_val;
 }
 
-static void test_case_setup(void)
+static void reset_subscription_table(
+    struct __fwk_notification_subscribers *table,
+    size_t count)
 {
-    unsigned int i;
+    size_t i;
 
+    for (i = 0; i < count; i++) {
+        free(table[i].target_table);
+        table[i] = (struct __fwk_notification_subscribers){ 0 };
+    }
+}
+
+static void test_case_setup(void)
+{
     is_valid_entity_id_return_val = true;
     is_valid_notification_id_return_val = true;
     interrupt_get_current_return_val = false;
@@ -113,16 +122,18 @@ static void test_case_setup(void)
     get_current_event_return_val = NULL;
     notification_event_count = 0;
 
-    for (i = 0; i < FWK_ARRAY_SIZE(fake_module_dlist_table); i++)
-        fwk_list_init(&fake_module_dlist_table[i]);
-
-    for (i = 0; i < FWK_ARRAY_SIZE(fake_element_dlist_table); i++)
-        fwk_list_init(&fake_element_dlist_table[i]);
+    fake_module_ctx.subscription_table = fake_module_subscription_table;
+    fake_element_ctx.subscription_table = fake_element_subscription_table;
 }
 
 static void test_case_teardown(void)
 {
-    __fwk_notification_reset();
+    reset_subscription_table(
+        fake_module_subscription_table,
+        FWK_ARRAY_SIZE(fake_module_subscription_table));
+    reset_subscription_table(
+        fake_element_subscription_table,
+        FWK_ARRAY_SIZE(fake_element_subscription_table));
 }
 
 static void test_fwk_notification_subscribe(void)
@@ -356,10 +367,81 @@ static void test_fwk_notification_notify(void)
     notification_event_count = 0;
 }
 
+static void test_fwk_notification_subscribe_not_initialized(void)
+{
+    int result;
+    unsigned int count;
+    struct fwk_event notification_event = {
+        .source_id = FWK_ID_ELEMENT(0x2, 0x9),
+        .id = FWK_ID_NOTIFICATION(0x2, 0x1),
+    };
+
+    /* The subscription tables are only built after the bind stage */
+    fake_element_ctx.subscription_table = NULL;
+
+    result = fwk_notification_subscribe(FWK_ID_NOTIFICATION(0x2, 0x1),
+                                        FWK_ID_ELEMENT(0x2, 0x9),
+                                        FWK_ID_MODULE(0x4));
+    assert(result == FWK_E_INIT);
+
+    result = fwk_notification_unsubscribe(FWK_ID_NOTIFICATION(0x2, 0x1),
+                                          FWK_ID_ELEMENT(0x2, 0x9),
+                                          FWK_ID_MODULE(0x4));
+    assert(result == FWK_E_STATE);
+
+    result = fwk_notification_notify(&notification_event, &count);
+    assert(result == FWK_SUCCESS);
+    assert(count == 0);
+    assert(notification_event_count == 0);
+}
+
+static void test_fwk_notification_notify_order(void)
+{
+    int result;
+    unsigned int i, count;
+    struct fwk_event notification_event = {
+        .source_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_NOTIFICATION(0x2, 0x2),
+    };
+    static const unsigned int expected_targets[] = { 0x0, 0x2, 0x3, 0x4, 0x5,
+                                                     0x6 };
+
+    /* Subscribe enough targets for the target table to grow twice */
+    for (i = 0; i < 7; i++) {
+        result = fwk_notification_subscribe(FWK_ID_NOTIFICATION(0x2, 0x2),
+                                            FWK_ID_MODULE(0x2),
+                                            FWK_ID_ELEMENT(0x5, i));
+        assert(result == FWK_SUCCESS);
+    }
+
+    result = fwk_notification_unsubscribe(FWK_ID_NOTIFICATION(0x2, 0x2),
+                                          FWK_ID_MODULE(0x2),
+                                          FWK_ID_ELEMENT(0x5, 0x1));
+    assert(result == FWK_SUCCESS);
+
+    /* Other notifications of the same source are not affected */
+    assert(fake_module_subscription_table[0x1].count == 0);
+    assert(fake_module_subscription_table[0x3].count == 0);
+
+    /* The remaining targets are notified in subscription order */
+    result = fwk_notification_notify(&notification_event, &count);
+    assert(result == FWK_SUCCESS);
+    assert(count == FWK_ARRAY_SIZE(expected_targets));
+    assert(notification_event_count == FWK_ARRAY_SIZE(expected_targets));
+
+    for (i = 0; i < FWK_ARRAY_SIZE(expected_targets); i++) {
+        assert(notification_event_table[i].is_notification);
+        assert(fwk_id_is_equal(notification_event_table[i].target_id,
+                               FWK_ID_ELEMENT(0x5, expected_targets[i])));
+    }
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_fwk_notification_subscribe),
     FWK_TEST_CASE(test_fwk_notification_unsubscribe),
-    FWK_TEST_CASE(test_fwk_notification_notify)
+    FWK_TEST_CASE(test_fwk_notification_notify),
+    FWK_TEST_CASE(test_fwk_notification_subscribe_not_initialized),
+    FWK_TEST_CASE(test_fwk_notification_notify_order),
 };
 
 struct fwk_test_suite_desc test_suite = {
@@ -57,6 +57,36 @@ struct amu_api {
         fwk_id_t start_counter_id,
         uint64_t *counter_buff,
         size_t num_counter);
+
+    /*!
+     * \brief Get the same range of AMU counters for several cores at once
+     *
+     * \details The values are stored counter by counter, so that the value
+     *      of counter \b i of core \b j is at index (i * core_count) + j of
+     *      \b counter_buff. Cores whose identifier is ::FWK_ID_NONE are
+     *      skipped and their values in \b counter_buff are left untouched.
+     *
+     * \param start_counter_ids Table of \b core_count identifiers of the
+     *                          counter to start from in each core.
+     * \param core_count The number of cores.
+     * \param[out] counter_buff Pointer to a buffer to be filled with the
+     *                          counters values.
+     * \param num_counter The number of the counters requested per core.
+     *
+     * \note \b counter_buff must have space for \b core_count *
+     *       \b num_counter elements.
+     * \note This function is optional and may be NULL, in which case
+     *       \ref get_counters is used for each core instead.
+     * \retval ::FWK_E_PARAM One or more parameters were invalid.
+     * \retval ::FWK_E_RANGE Number of counters requested is out of range.
+     * \retval ::FWK_SUCCESS The request was successfully completed.
+     * \return One of the standard framework status codes.
+     */
+    int (*get_counters_batch)(
+        const fwk_id_t *start_counter_ids,
+        size_t core_count,
+        uint64_t *counter_buff,
+        size_t num_counter);
 };
 
 /*!
@@ -74,8 +74,65 @@ static int amu_mmap_get_counters(
     return FWK_SUCCESS;
 }
 
+static int amu_mmap_get_counters_batch(
+    const fwk_id_t *start_counter_ids,
+    size_t core_count,
+    uint64_t *counter_buff,
+    size_t num_counter)
+{
+    size_t core, i;
+    uint32_t core_idx;
+    uint32_t start_counter_idx;
+    uint64_t *counters_base_addr;
+    const uint32_t *offsets;
+
+    if (start_counter_ids == NULL || counter_buff == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    /* Validate the whole request before reading any counter */
+    for (core = 0; core < core_count; ++core) {
+        if (fwk_id_is_equal(start_counter_ids[core], FWK_ID_NONE)) {
+            continue;
+        }
+
+        if (!fwk_module_is_valid_sub_element_id(start_counter_ids[core])) {
+            return FWK_E_PARAM;
+        }
+
+        core_idx = start_counter_ids[core].sub_element.element_idx;
+        start_counter_idx = start_counter_ids[core].sub_element.sub_element_idx;
+
+        if (start_counter_idx + num_counter >
+            amu_mmap.core[core_idx].num_counters) {
+            return FWK_E_RANGE;
+        }
+    }
+
+    for (core = 0; core < core_count; ++core) {
+        if (fwk_id_is_equal(start_counter_ids[core], FWK_ID_NONE)) {
+            continue;
+        }
+
+        core_idx = start_counter_ids[core].sub_element.element_idx;
+        start_counter_idx = start_counter_ids[core].sub_element.sub_element_idx;
+        counters_base_addr =
+            amu_mmap.core[core_idx].core_config->counters_base_addr;
+        offsets = &amu_mmap.core[core_idx]
+                       .core_config->counters_offsets[start_counter_idx];
+
+        for (i = 0; i < num_counter; ++i) {
+            counter_buff[(i * core_count) + core] =
+                *amu_calc_counter_address(counters_base_addr, offsets[i]);
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
 struct amu_api amu_api = {
     .get_counters = amu_mmap_get_counters,
+    .get_counters_batch = amu_mmap_get_counters_batch,
 };
 
 /*
@@ -260,6 +260,102 @@ void test_amu_mmap_get_counters_success(void)
     }
 }
 
+static bool id_is_equal_callback(fwk_id_t left, fwk_id_t right, int num_calls)
+{
+    return left.value == right.value;
+}
+
+void test_amu_mmap_get_counters_batch_bad_params_fail(void)
+{
+    int status = FWK_E_PANIC;
+    struct amu_api *api = &amu_api;
+    uint64_t amu_value[CORE_COUNT] = { 0 };
+    fwk_id_t counters_ids[CORE_COUNT] = {
+        FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_AMU_MMAP, CORE0_IDX, COREA_AUX0),
+        FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_AMU_MMAP, CORE1_IDX, COREB_AUX0),
+    };
+
+    fwk_id_is_equal_Stub(id_is_equal_callback);
+
+    /* Bad buffers */
+    status = api->get_counters_batch(NULL, CORE_COUNT, amu_value, 1);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = api->get_counters_batch(counters_ids, CORE_COUNT, NULL, 1);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    /* Bad ID of the second core */
+    fwk_module_is_valid_sub_element_id_ExpectAndReturn(counters_ids[0], true);
+    fwk_module_is_valid_sub_element_id_ExpectAndReturn(counters_ids[1], false);
+    status = api->get_counters_batch(counters_ids, CORE_COUNT, amu_value, 1);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_amu_mmap_get_counters_batch_count_exceeds_available(void)
+{
+    int status = FWK_E_PANIC;
+    struct amu_api *api = &amu_api;
+    uint64_t amu_value[CORE_COUNT * 2] = { 0 };
+    fwk_id_t counters_ids[CORE_COUNT] = {
+        FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_AMU_MMAP, CORE0_IDX, COREA_AUX4),
+        FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_AMU_MMAP, CORE1_IDX, COREB_AUX3),
+    };
+
+    fwk_id_is_equal_Stub(id_is_equal_callback);
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+
+    /* Only the second core does not have enough counters */
+    status = api->get_counters_batch(counters_ids, CORE_COUNT, amu_value, 2);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+
+    /* No counter has been read */
+    for (unsigned int i = 0; i < FWK_ARRAY_SIZE(amu_value); ++i) {
+        TEST_ASSERT_EQUAL_UINT64(0, amu_value[i]);
+    }
+}
+
+void test_amu_mmap_get_counters_batch_success(void)
+{
+    int status = FWK_E_PANIC;
+    struct amu_api *api = &amu_api;
+    uint64_t test_value = 0xDEADBEEFC0FFEE00;
+    const size_t core_count = 3;
+    const size_t num_counter = 4;
+    uint64_t amu_value[3 * 4];
+    fwk_id_t counters_ids[3] = {
+        FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_AMU_MMAP, CORE1_IDX, COREB_AUX0),
+        FWK_ID_NONE,
+        FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_AMU_MMAP, CORE0_IDX, COREA_AUX2),
+    };
+
+    for (unsigned int i = 0; i < CORE_COUNT; ++i) {
+        for (unsigned int j = 0; j < element_table[i].sub_element_count; ++j) {
+            amu_counters[i][j] = test_value++;
+        }
+    }
+
+    memset(amu_value, 0xA5, sizeof(amu_value));
+
+    fwk_id_is_equal_Stub(id_is_equal_callback);
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+
+    status = api->get_counters_batch(
+        counters_ids, core_count, amu_value, num_counter);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Counters are stored counter by counter, skipped cores are untouched */
+    for (size_t i = 0; i < num_counter; ++i) {
+        TEST_ASSERT_EQUAL_HEX64(
+            amu_counters[CORE1_IDX][COREB_AUX0 + i],
+            amu_value[(i * core_count) + 0]);
+        TEST_ASSERT_EQUAL_HEX64(
+            UINT64_C(0xA5A5A5A5A5A5A5A5), amu_value[(i * core_count) + 1]);
+        TEST_ASSERT_EQUAL_HEX64(
+            amu_counters[CORE0_IDX][COREA_AUX2 + i],
+            amu_value[(i * core_count) + 2]);
+    }
+}
+
 int amu_mmap_test_main(void)
 {
     UNITY_BEGIN();
@@ -275,6 +371,9 @@ int amu_mmap_test_main(void)
     RUN_TEST(test_amu_mmap_get_counters_bad_params_fail);
     RUN_TEST(test_amu_mmap_get_counters_count_exceeds_available);
     RUN_TEST(test_amu_mmap_get_counters_success);
+    RUN_TEST(test_amu_mmap_get_counters_batch_bad_params_fail);
+    RUN_TEST(test_amu_mmap_get_counters_batch_count_exceeds_available);
+    RUN_TEST(test_amu_mmap_get_counters_batch_success);
 
     return UNITY_END();
 }
@@ -163,6 +163,15 @@ struct mod_dvfs_domain_ctx {
     /* Number of operating points */
     size_t opp_count;
 
+    /* Index from level to operating point position */
+    uint16_t *level_index;
+
+    /* Index from voltage to operating point position */
+    uint16_t *voltage_index;
+
+    /* Number of slots of each index, a power of two */
+    size_t opp_index_slot_count;
+
     /* Current operating point */
     struct mod_dvfs_opp current_opp;
 
@@ -242,6 +251,22 @@ struct mod_dvfs_domain_api {
      */
     int (*get_level_id)(fwk_id_t domain_id, uint32_t level, size_t *level_id);
 
+    /*!
+     * \brief Get the level id of the operating point nearest to a level.
+     *
+     * \details The operating point selected is the lowest one whose level is
+     *      greater than or equal to the requested level, or the highest one
+     *      when the requested level is above all of them.
+     *
+     * \param domain_id Element identifier of the domain.
+     * \param level Requested level.
+     * \param [out] level_id Level id inside the OPP table.
+     */
+    int (*get_nearest_level_id)(
+        fwk_id_t domain_id,
+        uint32_t level,
+        size_t *level_id);
+
     /*!
      * \brief Get the worst-case transition latency of a domain.
      *
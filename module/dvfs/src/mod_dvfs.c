@@ -20,18 +20,25 @@
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
 #include <fwk_log.h>
+#include <fwk_math.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 #include <fwk_status.h>
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /*
  * Maximum number of attempts to complete a request
  */
 #define DVFS_MAX_RETRIES 4
 
+/*
+ * Marks an unused slot of an operating point index
+ */
+#define DVFS_OPP_INDEX_SLOT_FREE UINT16_MAX
+
 enum mod_dvfs_internal_event_idx {
     /* retry request */
     MOD_DVFS_INTERNAL_EVENT_IDX_RETRY = MOD_DVFS_EVENT_IDX_COUNT,
@@ -81,44 +88,148 @@ static size_t count_opps(const struct mod_dvfs_opp *opps)
     return (size_t)(opp - &opps[0]);
 }
 
-static const struct mod_dvfs_opp *get_opp_for_level(
+/*
+ * Operating point indices
+ *
+ * Each domain has two open-addressing hash indices mapping a level and a
+ * voltage to the position of the operating point in the configuration table,
+ * so that requests do not have to scan the table.
+ */
+
+static uint32_t opp_level(const struct mod_dvfs_opp *opp)
+{
+    return opp->level;
+}
+
+static uint32_t opp_voltage(const struct mod_dvfs_opp *opp)
+{
+    return opp->voltage;
+}
+
+static size_t opp_index_probe(
     const struct mod_dvfs_domain_ctx *ctx,
-    uint32_t level)
+    const uint16_t *index,
+    uint32_t (*get_key)(const struct mod_dvfs_opp *opp),
+    uint32_t key)
 {
-    const struct mod_dvfs_opp *opp;
-    size_t opp_idx;
+    uint32_t hash = key * UINT32_C(0x9E3779B1);
+    size_t slot;
+
+    hash ^= hash >> 16;
+    slot = (size_t)hash & (ctx->opp_index_slot_count - 1u);
+
+    /* Stop on the slot holding the key or on the first free slot */
+    while ((index[slot] != DVFS_OPP_INDEX_SLOT_FREE) &&
+           (get_key(&ctx->config->opps[index[slot]]) != key)) {
+        slot = (slot + 1u) & (ctx->opp_index_slot_count - 1u);
+    }
+
+    return slot;
+}
+
+static void opp_index_build(
+    const struct mod_dvfs_domain_ctx *ctx,
+    uint16_t *index,
+    uint32_t (*get_key)(const struct mod_dvfs_opp *opp))
+{
+    size_t opp_idx, slot;
+
+    for (slot = 0; slot < ctx->opp_index_slot_count; slot++) {
+        index[slot] = DVFS_OPP_INDEX_SLOT_FREE;
+    }
 
     for (opp_idx = 0; opp_idx < ctx->opp_count; opp_idx++) {
-        opp = &ctx->config->opps[opp_idx];
+        slot = opp_index_probe(
+            ctx, index, get_key, get_key(&ctx->config->opps[opp_idx]));
 
-        if (opp->level != level) {
-            continue;
+        /* Keep the first operating point when a key is shared */
+        if (index[slot] == DVFS_OPP_INDEX_SLOT_FREE) {
+            index[slot] = (uint16_t)opp_idx;
         }
+    }
+}
 
-        return opp;
+static const struct mod_dvfs_opp *opp_index_lookup(
+    const struct mod_dvfs_domain_ctx *ctx,
+    const uint16_t *index,
+    uint32_t (*get_key)(const struct mod_dvfs_opp *opp),
+    uint32_t key)
+{
+    size_t slot = opp_index_probe(ctx, index, get_key, key);
+
+    if (index[slot] == DVFS_OPP_INDEX_SLOT_FREE) {
+        return NULL;
     }
 
-    return NULL;
+    return &ctx->config->opps[index[slot]];
+}
+
+static void dvfs_build_opp_indices(struct mod_dvfs_domain_ctx *ctx)
+{
+    size_t opp_idx;
+
+    fwk_assert(ctx->opp_count < DVFS_OPP_INDEX_SLOT_FREE);
+
+    /* The nearest level search relies on the levels being sorted */
+    for (opp_idx = 1; opp_idx < ctx->opp_count; opp_idx++) {
+        fwk_assert(
+            ctx->config->opps[opp_idx].level >
+            ctx->config->opps[opp_idx - 1].level);
+    }
+
+    /*
+     * The indices have at least twice as many slots as there are operating
+     * points so that probe sequences stay short.
+     */
+    ctx->opp_index_slot_count = 2u
+        << fwk_math_log2(2u * (unsigned int)ctx->opp_count - 1u);
+
+    ctx->level_index =
+        fwk_mm_alloc(ctx->opp_index_slot_count, sizeof(ctx->level_index[0]));
+    ctx->voltage_index =
+        fwk_mm_alloc(ctx->opp_index_slot_count, sizeof(ctx->voltage_index[0]));
+
+    opp_index_build(ctx, ctx->level_index, opp_level);
+    opp_index_build(ctx, ctx->voltage_index, opp_voltage);
+}
+
+static const struct mod_dvfs_opp *get_opp_for_level(
+    const struct mod_dvfs_domain_ctx *ctx,
+    uint32_t level)
+{
+    return opp_index_lookup(ctx, ctx->level_index, opp_level, level);
 }
 
 static const struct mod_dvfs_opp *get_opp_for_voltage(
     const struct mod_dvfs_domain_ctx *ctx,
     uint32_t voltage)
 {
-    size_t opp_idx;
-    const struct mod_dvfs_opp *opp;
+    return opp_index_lookup(ctx, ctx->voltage_index, opp_voltage, voltage);
+}
 
-    for (opp_idx = 0; opp_idx < ctx->opp_count; opp_idx++) {
-        opp = &ctx->config->opps[opp_idx];
+/*
+ * Bisect the sorted operating points for the lowest one whose level is greater
+ * than or equal to the requested level, falling back to the highest one.
+ */
+static size_t get_nearest_opp_idx(
+    const struct mod_dvfs_domain_ctx *ctx,
+    uint32_t level)
+{
+    size_t low = 0;
+    size_t high = ctx->opp_count - 1;
+    size_t mid;
 
-        if (opp->voltage != voltage) {
-            continue;
-        }
+    while (low < high) {
+        mid = low + ((high - low) / 2);
 
-        return opp;
+        if (ctx->config->opps[mid].level < level) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
     }
 
-    return NULL;
+    return low;
 }
 
 /*
@@ -342,27 +453,42 @@ static int dvfs_get_level_id(
     size_t *level_id)
 {
     const struct mod_dvfs_domain_ctx *ctx;
-    size_t idx;
+    const struct mod_dvfs_opp *opp;
 
     ctx = get_domain_ctx(domain_id);
     if (ctx == NULL) {
         return FWK_E_PARAM;
     }
 
-    /*
-     * When the setup code forces platform to provide frequency array
-     * sorted, then this code can be changed to bisect search in order
-     * to speed-up.
-     */
-    for (idx = 0; idx < ctx->opp_count; idx++) {
-        const struct mod_dvfs_opp *opp = &ctx->config->opps[idx];
-        if (opp->level == level) {
-            *level_id = idx;
-            return FWK_SUCCESS;
-        }
+    opp = get_opp_for_level(ctx, level);
+    if (opp == NULL) {
+        return FWK_E_PARAM;
     }
 
-    return FWK_E_PARAM;
+    *level_id = (size_t)(opp - &ctx->config->opps[0]);
+
+    return FWK_SUCCESS;
+}
+
+static int dvfs_get_nearest_level_id(
+    fwk_id_t domain_id,
+    uint32_t level,
+    size_t *level_id)
+{
+    const struct mod_dvfs_domain_ctx *ctx;
+
+    if (level_id == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = get_domain_ctx(domain_id);
+    if (ctx == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    *level_id = get_nearest_opp_idx(ctx, level);
+
+    return FWK_SUCCESS;
 }
 
 static int dvfs_get_opp_count(fwk_id_t domain_id, size_t *opp_count)
@@ -486,6 +612,7 @@ static const struct mod_dvfs_domain_api dvfs_domain_api = {
     .get_sustained_opp = dvfs_get_sustained_opp,
     .get_nth_opp = dvfs_get_nth_opp,
     .get_level_id = dvfs_get_level_id,
+    .get_nearest_level_id = dvfs_get_nearest_level_id,
     .get_opp_count = dvfs_get_opp_count,
     .get_latency = dvfs_get_latency,
     .set_level = dvfs_set_level,
@@ -1045,6 +1172,8 @@ static int dvfs_element_init(
     ctx->opp_count = count_opps(ctx->config->opps);
     fwk_assert(ctx->opp_count > 0);
 
+    dvfs_build_opp_indices(ctx);
+
     return FWK_SUCCESS;
 }
 
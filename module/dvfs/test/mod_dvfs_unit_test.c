@@ -112,6 +112,7 @@ void utest_dvfs_get_opp_for_level_with_existing_level(void)
     opps.level = 50;
     config.opps = &opps;
     dvfs_domain_ctx.config = &config;
+    dvfs_build_opp_indices(&dvfs_domain_ctx);
 
     return_opp = get_opp_for_level(&dvfs_domain_ctx, level);
     TEST_ASSERT_EQUAL(&opps, return_opp);
@@ -132,6 +133,7 @@ void utest_dvfs_get_opp_for_level_with_non_existing_level(void)
     opps.level = 50;
     config.opps = &opps;
     dvfs_domain_ctx.config = &config;
+    dvfs_build_opp_indices(&dvfs_domain_ctx);
 
     return_opp = get_opp_for_level(&dvfs_domain_ctx, level);
 
@@ -153,6 +155,7 @@ void utest_dvfs_get_opp_for_voltage_with_existing_voltage(void)
     opps.voltage = 50;
     config.opps = &opps;
     dvfs_domain_ctx.config = &config;
+    dvfs_build_opp_indices(&dvfs_domain_ctx);
 
     return_opp = get_opp_for_voltage(&dvfs_domain_ctx, voltage);
 
@@ -174,6 +177,7 @@ void utest_dvfs_get_opp_for_voltage_with_none_existing_voltage(void)
     opps.voltage = 50;
     config.opps = &opps;
     dvfs_domain_ctx.config = &config;
+    dvfs_build_opp_indices(&dvfs_domain_ctx);
 
     return_opp = get_opp_for_voltage(&dvfs_domain_ctx, voltage);
 
@@ -451,6 +455,7 @@ void utest_dvfs_get_level_id_opp_level_matches_level(void)
     config.opps = &opps[0];
 
     dvfs_domain_ctx[0].config = &config;
+    dvfs_build_opp_indices(&dvfs_domain_ctx[0]);
 
     return_level_id = dvfs_get_level_id(dvfs_id, level, &level_id);
 
@@ -486,11 +491,109 @@ void utest_dvfs_get_level_id_level_not_found(void)
     config.opps = &opps[0];
 
     dvfs_domain_ctx[0].config = &config;
+    dvfs_build_opp_indices(&dvfs_domain_ctx[0]);
 
     return_level_id = dvfs_get_level_id(dvfs_id, level, &level_id);
     TEST_ASSERT_EQUAL(FWK_E_PARAM, return_level_id);
 }
 
+static struct mod_dvfs_opp indexed_opps[] = {
+    { .level = 100, .voltage = 800, .frequency = 100 },
+    { .level = 200, .voltage = 800, .frequency = 200 },
+    { .level = 300, .voltage = 850, .frequency = 300 },
+    { .level = 400, .voltage = 900, .frequency = 400 },
+    { .level = 500, .voltage = 950, .frequency = 500 },
+    { 0 },
+};
+
+static void setup_indexed_domain(
+    struct mod_dvfs_domain_ctx *dvfs_domain_ctx,
+    struct mod_dvfs_domain_config *config)
+{
+    *dvfs_domain_ctx = (struct mod_dvfs_domain_ctx){ 0 };
+    *config = (struct mod_dvfs_domain_config){ .opps = indexed_opps };
+
+    dvfs_domain_ctx->config = config;
+    dvfs_domain_ctx->opp_count = count_opps(indexed_opps);
+    dvfs_build_opp_indices(dvfs_domain_ctx);
+}
+
+void utest_dvfs_opp_indices(void)
+{
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx;
+    struct mod_dvfs_domain_config config;
+    size_t opp_idx;
+
+    setup_indexed_domain(&dvfs_domain_ctx, &config);
+
+    TEST_ASSERT_EQUAL(16, dvfs_domain_ctx.opp_index_slot_count);
+
+    for (opp_idx = 0; opp_idx < dvfs_domain_ctx.opp_count; opp_idx++) {
+        TEST_ASSERT_EQUAL_PTR(
+            &indexed_opps[opp_idx],
+            get_opp_for_level(&dvfs_domain_ctx, indexed_opps[opp_idx].level));
+    }
+
+    TEST_ASSERT_NULL(get_opp_for_level(&dvfs_domain_ctx, 0));
+    TEST_ASSERT_NULL(get_opp_for_level(&dvfs_domain_ctx, 250));
+
+    /* Operating points sharing a voltage resolve to the first one */
+    TEST_ASSERT_EQUAL_PTR(
+        &indexed_opps[0], get_opp_for_voltage(&dvfs_domain_ctx, 800));
+    TEST_ASSERT_EQUAL_PTR(
+        &indexed_opps[4], get_opp_for_voltage(&dvfs_domain_ctx, 950));
+    TEST_ASSERT_NULL(get_opp_for_voltage(&dvfs_domain_ctx, 825));
+}
+
+void utest_dvfs_get_nearest_level_id(void)
+{
+    fwk_id_t dvfs_id;
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[1];
+    struct mod_dvfs_domain_config config;
+    size_t level_id;
+    unsigned int i;
+    int status;
+
+    static const struct {
+        uint32_t level;
+        size_t level_id;
+    } cases[] = {
+        { 0, 0 },   { 100, 0 }, { 101, 1 }, { 250, 2 },
+        { 300, 2 }, { 499, 4 }, { 500, 4 }, { UINT32_MAX, 4 },
+    };
+
+    setup_indexed_domain(&dvfs_domain_ctx[0], &config);
+    dvfs_ctx.dvfs_domain_element_count = 1;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+
+    for (i = 0; i < FWK_ARRAY_SIZE(cases); i++) {
+        fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+
+        status = dvfs_get_nearest_level_id(dvfs_id, cases[i].level, &level_id);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+        TEST_ASSERT_EQUAL(cases[i].level_id, level_id);
+    }
+}
+
+void utest_dvfs_get_nearest_level_id_invalid_param(void)
+{
+    fwk_id_t dvfs_id;
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[1];
+    size_t level_id;
+    int status;
+
+    status = dvfs_get_nearest_level_id(dvfs_id, 100, NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    dvfs_ctx.dvfs_domain_element_count = 1;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 2);
+
+    status = dvfs_get_nearest_level_id(dvfs_id, 100, &level_id);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
 void utest_dvfs_get_opp_count_null_opp_count(void)
 {
     fwk_id_t dvfs_id;
@@ -694,6 +797,10 @@ int dvfs_test_main(void)
     RUN_TEST(utest_dvfs_get_level_id_opp_level_matches_level);
     RUN_TEST(utest_dvfs_get_level_id_level_not_found);
 
+    RUN_TEST(utest_dvfs_opp_indices);
+    RUN_TEST(utest_dvfs_get_nearest_level_id);
+    RUN_TEST(utest_dvfs_get_nearest_level_id_invalid_param);
+
     RUN_TEST(utest_dvfs_get_opp_count_null_opp_count);
     RUN_TEST(utest_dvfs_get_opp_count_invalid_dvfs_id);
     RUN_TEST(utest_dvfs_get_opp_count);
@@ -23,6 +23,47 @@ typedef struct mctp mctp_t;
 typedef struct mctp_bus mctp_bus_t;
 typedef struct mctp_binding mctp_binding_t;
 
+/* Configuration of a fixed-size block pool used for libmctp allocations */
+struct mod_mctp_pool_config {
+    /* Size in bytes of each block */
+    size_t block_size;
+
+    /* Number of blocks in the pool */
+    unsigned int block_count;
+};
+
+/*
+ * MCTP module configuration.
+ *
+ * When provided, libmctp packet buffers are served from the packet pools and
+ * message reassembly buffers from the reassembly pool instead of the heap.
+ * Allocations never wait: when a pool is exhausted the allocation fails and
+ * the failure is counted, so libmctp drops the packet or message. A message
+ * that cannot be queued for transmission is counted as a drop, and
+ * mctp_message_tx() returns the libmctp error to the caller. Configure
+ * one packet pool per binding, with a block size large enough for that
+ * binding's packet buffers (see MOD_MCTP_PKTBUF_SIZE()). Pools are searched
+ * in order for the first with a large enough block, so list them by
+ * increasing block size.
+ */
+struct mod_mctp_config {
+    /* Packet buffer pools */
+    const struct mod_mctp_pool_config *packet_pools;
+
+    /* Number of packet buffer pools */
+    unsigned int packet_pool_count;
+
+    /* Message reassembly buffer pool */
+    struct mod_mctp_pool_config reassembly_pool;
+};
+
+/*
+ * Size of a libmctp packet buffer for a binding with the given packet size
+ * and per-packet framing overhead (binding header plus trailer).
+ */
+#define MOD_MCTP_PKTBUF_SIZE(PKT_SIZE, FRAMING_SIZE) \
+    (sizeof(struct mctp_pktbuf) + (PKT_SIZE) + (FRAMING_SIZE))
+
 /* MCTP api index */
 enum mod_mctp_api_idx {
     MCTP_BIND_REQ_API_IDX,
@@ -7,14 +7,70 @@
 
 #include <mod_mctp.h>
 
+#ifdef BUILD_HAS_DEBUGGER
+#    include <cli.h>
+#endif
+
 #include <fwk_id.h>
+#include <fwk_interrupt.h>
+#include <fwk_list.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
+#include <fwk_slist.h>
 #include <fwk_status.h>
 
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 
+/* Fixed-size block pool */
+struct mctp_pool {
+    /* Block size rounded up to keep every block suitably aligned */
+    size_t block_size;
+
+    /* Number of blocks in the pool */
+    unsigned int block_count;
+
+    /* Start of the pool storage */
+    uint8_t *base;
+
+    /* Free blocks */
+    struct fwk_slist free_list;
+
+    /* Number of blocks currently allocated */
+    unsigned int in_use;
+
+    /* Highest number of blocks allocated at once */
+    unsigned int high_water;
+
+    /* Number of allocations that could not be satisfied */
+    unsigned int alloc_failures;
+};
+
+static struct mod_mctp_ctx {
+    /* Packet buffer pools, as configured */
+    struct mctp_pool *packet_pools;
+
+    /* Number of packet buffer pools */
+    unsigned int packet_pool_count;
+
+    /* Message reassembly buffer pool */
+    struct mctp_pool reassembly_pool;
+
+    /* Number of messages libmctp could not queue for transmission */
+    unsigned int tx_drops;
+
+    /*
+     * Set while libmctp allocates its long-lived state (context, buses and
+     * bindings), which is served from the heap rather than the pools.
+     */
+    bool setup_alloc;
+} mctp_ctx;
+
 /* Dummy function to make libmctp compile success */
 size_t write(int fd, void *buf, size_t len)
 {
@@ -38,6 +94,234 @@ static void *mm_realloc(void *ptr, size_t size)
     return realloc(ptr, size);
 }
 
+static void mctp_pool_init(
+    struct mctp_pool *pool,
+    const struct mod_mctp_pool_config *config)
+{
+    unsigned int idx;
+
+    pool->block_size = FWK_ALIGN_NEXT(
+        FWK_MAX(config->block_size, sizeof(struct fwk_slist_node)),
+        alignof(max_align_t));
+    pool->block_count = config->block_count;
+
+    fwk_list_init(&pool->free_list);
+    if (pool->block_count == 0) {
+        return;
+    }
+
+    pool->base = fwk_mm_alloc(pool->block_count, pool->block_size);
+    for (idx = 0; idx < pool->block_count; idx++) {
+        fwk_list_push_tail(
+            &pool->free_list,
+            (struct fwk_slist_node *)(pool->base + idx * pool->block_size));
+    }
+}
+
+static bool mctp_pool_owns(const struct mctp_pool *pool, const void *ptr)
+{
+    const uint8_t *block = ptr;
+
+    return (block >= pool->base) &&
+        (block < (pool->base + pool->block_count * pool->block_size));
+}
+
+static void *mctp_pool_alloc(struct mctp_pool *pool)
+{
+    void *block;
+    unsigned int flags;
+
+    flags = fwk_interrupt_global_disable();
+
+    block = fwk_list_pop_head(&pool->free_list);
+    if (block == NULL) {
+        pool->alloc_failures++;
+    } else {
+        pool->in_use++;
+        if (pool->in_use > pool->high_water) {
+            pool->high_water = pool->in_use;
+        }
+    }
+
+    fwk_interrupt_global_enable(flags);
+
+    return block;
+}
+
+static void mctp_pool_free(struct mctp_pool *pool, void *ptr)
+{
+    unsigned int flags;
+
+    flags = fwk_interrupt_global_disable();
+
+    fwk_list_push_head(&pool->free_list, (struct fwk_slist_node *)ptr);
+    pool->in_use--;
+
+    fwk_interrupt_global_enable(flags);
+}
+
+static struct mctp_pool *mctp_pool_find_owner(const void *ptr)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < mctp_ctx.packet_pool_count; idx++) {
+        if (mctp_pool_owns(&mctp_ctx.packet_pools[idx], ptr)) {
+            return &mctp_ctx.packet_pools[idx];
+        }
+    }
+
+    if (mctp_pool_owns(&mctp_ctx.reassembly_pool, ptr)) {
+        return &mctp_ctx.reassembly_pool;
+    }
+
+    return NULL;
+}
+
+/* Packet buffers: first pool with blocks large enough for the request */
+static void *pool_alloc(size_t size)
+{
+    unsigned int idx;
+    struct mctp_pool *pool;
+
+    if (mctp_ctx.setup_alloc) {
+        return mm_alloc(size);
+    }
+
+    for (idx = 0; idx < mctp_ctx.packet_pool_count; idx++) {
+        pool = &mctp_ctx.packet_pools[idx];
+        if (size <= pool->block_size) {
+            return mctp_pool_alloc(pool);
+        }
+    }
+
+    /* No pool has blocks this large, count it against the largest one */
+    if (mctp_ctx.packet_pool_count > 0) {
+        mctp_ctx.packet_pools[mctp_ctx.packet_pool_count - 1].alloc_failures++;
+    }
+
+    return NULL;
+}
+
+static void pool_free(void *ptr)
+{
+    struct mctp_pool *pool;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    pool = mctp_pool_find_owner(ptr);
+    if (pool == NULL) {
+        fwk_mm_free(ptr);
+    } else {
+        mctp_pool_free(pool, ptr);
+    }
+}
+
+/*
+ * libmctp only reallocates message reassembly buffers, growing them as
+ * packets arrive. Blocks are never resized; a request that does not fit in
+ * a reassembly block fails and libmctp drops the message.
+ */
+static void *pool_realloc(void *ptr, size_t size)
+{
+    struct mctp_pool *pool = &mctp_ctx.reassembly_pool;
+
+    if (mctp_ctx.setup_alloc) {
+        return mm_realloc(ptr, size);
+    }
+
+    if (ptr == NULL) {
+        if (size > pool->block_size) {
+            pool->alloc_failures++;
+            return NULL;
+        }
+
+        return mctp_pool_alloc(pool);
+    }
+
+    if (!mctp_pool_owns(pool, ptr) || (size > pool->block_size)) {
+        pool->alloc_failures++;
+        return NULL;
+    }
+
+    return ptr;
+}
+
+/*
+ * Wrappers for the libmctp calls that allocate long-lived state, so that it
+ * does not consume pool blocks.
+ */
+static mctp_t *mod_mctp_ctx_init(void)
+{
+    mctp_t *mctp;
+
+    mctp_ctx.setup_alloc = true;
+    mctp = mctp_init();
+    mctp_ctx.setup_alloc = false;
+
+    return mctp;
+}
+
+static int mod_mctp_register_bus(
+    mctp_t *mctp,
+    mctp_binding_t *binding,
+    mctp_eid_t eid)
+{
+    int status;
+
+    mctp_ctx.setup_alloc = true;
+    status = mctp_register_bus(mctp, binding, eid);
+    mctp_ctx.setup_alloc = false;
+
+    return status;
+}
+
+static mctp_binding_serial_t *mod_mctp_serial_init(void)
+{
+    mctp_binding_serial_t *serial;
+
+    mctp_ctx.setup_alloc = true;
+    serial = mctp_serial_init();
+    mctp_ctx.setup_alloc = false;
+
+    return serial;
+}
+
+static mctp_binding_pcc_t *mod_mctp_pcc_init(void)
+{
+    mctp_binding_pcc_t *pcc;
+
+    mctp_ctx.setup_alloc = true;
+    pcc = mctp_pcc_init();
+    mctp_ctx.setup_alloc = false;
+
+    return pcc;
+}
+
+/*
+ * libmctp gives up on a message when a packet buffer cannot be allocated, for
+ * instance when its pool is exhausted. Count the message as dropped and pass
+ * the libmctp error on to the caller.
+ */
+static int mod_mctp_message_tx(
+    mctp_t *mctp,
+    mctp_eid_t eid,
+    bool tag_owner,
+    uint8_t msg_tag,
+    void *msg,
+    size_t msg_len)
+{
+    int rc;
+
+    rc = mctp_message_tx(mctp, eid, tag_owner, msg_tag, msg, msg_len);
+    if (rc != 0) {
+        mctp_ctx.tx_drops++;
+    }
+
+    return rc;
+}
+
 static void debug_print(int level, const char *fmt, va_list args)
 {
 #if FWK_LOG_LEVEL < FWK_LOG_LEVEL_INFO
@@ -52,41 +336,119 @@ static void debug_print(int level, const char *fmt, va_list args)
 /* mctp function pointer which gets passed during bind request*/
 static const mctp_api_t mod_mctp_api = {
     /* mctp base apis */
-    .mctp_ctx_init = mctp_init,
+    .mctp_ctx_init = mod_mctp_ctx_init,
     .mctp_set_rx_all = mctp_set_rx_all,
-    .mctp_register_bus = mctp_register_bus,
+    .mctp_register_bus = mod_mctp_register_bus,
     .mctp_unregister_bus = mctp_unregister_bus,
     .mctp_bus_rx = mctp_bus_rx,
     .mctp_binding_set_tx_enabled = mctp_binding_set_tx_enabled,
-    .mctp_message_tx = mctp_message_tx,
+    .mctp_message_tx = mod_mctp_message_tx,
 
     /* mctp binding serial apis */
-    .mctp_serial_init = mctp_serial_init,
+    .mctp_serial_init = mod_mctp_serial_init,
     .mctp_serial_destroy = mctp_serial_destroy,
     .mctp_binding_serial_core = mctp_binding_serial_core,
     .mctp_serial_set_tx_fn = mctp_serial_set_tx_fn,
     .mctp_serial_rx = mctp_serial_rx,
 
     ///* mctp binding pcc apis */
-    .mctp_pcc_init = mctp_pcc_init,
+    .mctp_pcc_init = mod_mctp_pcc_init,
     .mctp_pcc_destroy = mctp_pcc_destroy,
     .mctp_binding_pcc_core = mctp_binding_pcc_core,
     .mctp_pcc_set_tx_fn = mctp_pcc_set_tx_fn,
     .mctp_pcc_rx = mctp_pcc_rx,
 };
 
+#ifdef BUILD_HAS_DEBUGGER
+static const char mctp_call[] = "mctp";
+static const char mctp_help[] =
+    "  Show MCTP buffer pool statistics\n"
+    "    Usage: mctp pools\n";
+
+static void mctp_pool_print(const char *name, const struct mctp_pool *pool)
+{
+    cli_printf(
+        NONE,
+        "%-12s %6u %6u %6u %6u %8u\n",
+        name,
+        (unsigned int)pool->block_size,
+        pool->block_count,
+        pool->in_use,
+        pool->high_water,
+        pool->alloc_failures);
+}
+
+static int32_t mctp_f(int32_t argc, char **argv)
+{
+    unsigned int idx;
+    char name[16];
+
+    if ((argc != 2) || (cli_strncmp(argv[1], "pools", 5) != 0)) {
+        cli_printf(NONE, "%s\n", mctp_help);
+        return FWK_E_PARAM;
+    }
+
+    cli_printf(
+        NONE,
+        "%-12s %6s %6s %6s %6s %8s\n",
+        "pool",
+        "size",
+        "count",
+        "used",
+        "max",
+        "failures");
+
+    for (idx = 0; idx < mctp_ctx.packet_pool_count; idx++) {
+        (void)snprintf(name, sizeof(name), "packet%u", idx);
+        mctp_pool_print(name, &mctp_ctx.packet_pools[idx]);
+    }
+    mctp_pool_print("reassembly", &mctp_ctx.reassembly_pool);
+
+    cli_printf(NONE, "tx drops: %u\n", mctp_ctx.tx_drops);
+
+    return FWK_SUCCESS;
+}
+
+static cli_command_st cli_commands[] = {
+    { mctp_call, mctp_help, &mctp_f, false },
+    { 0, 0, 0, 0 }
+};
+#endif
+
 /* init */
 static int mod_mctp_init(
     fwk_id_t module_id,
     unsigned int element_count,
     const void *data)
 {
+    const struct mod_mctp_config *config = data;
+    unsigned int idx;
+
     /* Module does not support elements */
     if (element_count > 0)
         return FWK_E_DATA;
 
     /* set dynamic memory management api's*/
-    mctp_set_alloc_ops(mm_alloc, fwk_mm_free, mm_realloc);
+    if (config == NULL) {
+        mctp_set_alloc_ops(mm_alloc, fwk_mm_free, mm_realloc);
+    } else {
+        if ((config->packet_pool_count > 0) && (config->packet_pools == NULL))
+            return FWK_E_DATA;
+
+        mctp_ctx.packet_pool_count = config->packet_pool_count;
+        if (mctp_ctx.packet_pool_count > 0) {
+            mctp_ctx.packet_pools = fwk_mm_calloc(
+                mctp_ctx.packet_pool_count, sizeof(struct mctp_pool));
+        }
+
+        for (idx = 0; idx < mctp_ctx.packet_pool_count; idx++) {
+            mctp_pool_init(
+                &mctp_ctx.packet_pools[idx], &config->packet_pools[idx]);
+        }
+        mctp_pool_init(&mctp_ctx.reassembly_pool, &config->reassembly_pool);
+
+        mctp_set_alloc_ops(pool_alloc, pool_free, pool_realloc);
+    }
 
     /* set debug log */
     mctp_set_log_custom(debug_print);
@@ -94,6 +456,28 @@ static int mod_mctp_init(
     return FWK_SUCCESS;
 }
 
+/* start */
+static int mod_mctp_start(fwk_id_t id)
+{
+#ifdef BUILD_HAS_DEBUGGER
+    unsigned int index;
+    int status;
+
+    if (fwk_module_get_data(id) == NULL)
+        return FWK_SUCCESS;
+
+    for (index = 0; cli_commands[index].command != 0; index++) {
+        status = cli_command_register(cli_commands[index]);
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_ERR("[MCTP] Debugger command register failed.");
+            return status;
+        }
+    }
+#endif
+
+    return FWK_SUCCESS;
+}
+
 /* bind request */
 static int mctp_process_bind_request(
     fwk_id_t source_id,
@@ -117,5 +501,6 @@ const struct fwk_module module_mctp = {
     .type = FWK_MODULE_TYPE_SERVICE,
     .api_count = MCTP_BIND_REQ_API_IDX_COUNT,
     .init = mod_mctp_init,
+    .start = mod_mctp_start,
     .process_bind_request = mctp_process_bind_request,
 };
@@ -12,8 +12,6 @@
 #include "libmctp-pcc.h"
 #include "container_of.h"
 
-#include "fwk_log.h"
-
 struct mctp_binding_pcc {
 	struct mctp_binding binding;
 
@@ -51,14 +49,19 @@ void mctp_pcc_set_tx_fn(struct mctp_binding_pcc *pcc,
 int mctp_pcc_rx(struct mctp_binding_pcc *pcc, const void *buf,
 		   size_t len)
 {
-	pcc->rx_pkt = mctp_pktbuf_alloc(&pcc->binding, 0);
+	struct mctp_pktbuf *pkt;
 
-	mctp_pktbuf_push(pcc->rx_pkt, (void *) buf, len);
+	pkt = mctp_pktbuf_alloc(&pcc->binding, 0);
+	if (!pkt)
+		return -ENOMEM;
 
-	struct mctp_pktbuf *pkt = pcc->rx_pkt;
-	assert(pkt);
+	pcc->rx_pkt = pkt;
 
-  FWK_LOG_ERR("john ===============");
+	if (mctp_pktbuf_push(pkt, (void *) buf, len)) {
+		mctp_pktbuf_free(pkt);
+		pcc->rx_pkt = NULL;
+		return -EMSGSIZE;
+	}
 
 	mctp_bus_rx(&pcc->binding, pkt);
 
@@ -14,6 +14,12 @@
 
 #define PLDM_MSG_TYPE 1
 
+/*
+ * number of writable bytes callers of mctp_fw_send_from_headroom must reserve
+ * in front of the message for the MCTP message type
+ */
+#define MCTP_FW_MSG_HEADROOM 1
+
 /*
  * mctp_fw binds with the following modules inorder to use thier apis and other
  * types
@@ -47,11 +53,24 @@ typedef struct mctp_fw_elem_config {
     uint8_t bus_policy;
 } mctp_fw_elem_config_t;
 
-/* type for exposing mctp_fw apis to be used by other modules */
+/*
+ * type for exposing mctp_fw apis to be used by other modules. The send apis
+ * return FWK_E_PARAM for an unknown bus and FWK_E_DEVICE when mctp could not
+ * queue the message, which is then dropped.
+ */
 typedef struct mctp_fw_api_t {
-    void (*mctp_fw_receive_from_app_layer)(
+    int (*mctp_fw_receive_from_app_layer)(
         uint32_t bus, bool tag_owner, uint8_t msg_tag,
         void *data, void *msg, size_t len);
+
+    /*
+     * same as mctp_fw_receive_from_app_layer, except that msg must be preceded
+     * by MCTP_FW_MSG_HEADROOM writable bytes. The message type is written
+     * there and the message is handed to mctp without being copied.
+     */
+    int (*mctp_fw_send_from_headroom)(
+        uint32_t bus, bool tag_owner, uint8_t msg_tag,
+        uint8_t msg_type, void *msg, size_t len);
 } mctp_fw_api_t;
 
 typedef struct mod_mctp_fw_config {
@@ -24,6 +24,7 @@ static int process_mctp_fw_tx(
 {
     mctp_api_t *mctp_api = mctp_fw_ctx.mctp_api;
     mctp_t *mctp = NULL;
+    int rc;
 
     switch(bus) {
 #ifdef BUILD_HAS_MOD_MCTP_SERIAL
@@ -39,40 +40,72 @@ static int process_mctp_fw_tx(
         break;
 #endif
       default:
-        FWK_LOG_ERR(MOD_NAME "Unknown MCTP bus - %ld ", bus);
-        break;
+        FWK_LOG_ERR(MOD_NAME "Unknown MCTP bus - %lu ", (unsigned long)bus);
+        return FWK_E_PARAM;
     }
 
-    if (mctp == NULL) FWK_LOG_ERR(MOD_NAME "No mctp ... ");
+    if (mctp == NULL) {
+        FWK_LOG_ERR(MOD_NAME "No mctp ... ");
+        return FWK_E_STATE;
+    }
 
-    return mctp_api->mctp_message_tx(mctp, dst, tag_owner, msg_tag, msg, len);
+    rc = mctp_api->mctp_message_tx(mctp, dst, tag_owner, msg_tag, msg, len);
+    if (rc != 0) {
+        /* The message could not be queued, mctp has counted the drop */
+        FWK_LOG_ERR(MOD_NAME "Tx message dropped (%d)", rc);
+        return FWK_E_DEVICE;
+    }
+
+    return FWK_SUCCESS;
 }
 
 /* data from application layer moves via this api */
-static void mctp_fw_receive_from_app_layer(
+static int mctp_fw_receive_from_app_layer(
       uint32_t bus, bool tag_owner, uint8_t msg_tag,
       void *data, void *msg, size_t len)
 {
     size_t buffer_size = len + 1;
-    uint8_t *buffer = fwk_mm_calloc(buffer_size, sizeof(uint8_t));
+    uint8_t *buffer;
     uint8_t *type = data;
+    int status;
+
+    if (bus >= MCTP_FW_BIND_API_IDX_COUNT) {
+        FWK_LOG_ERR(MOD_NAME "Unknown MCTP bus - %lu ", (unsigned long)bus);
+        return FWK_E_PARAM;
+    }
+
+    buffer = fwk_mm_calloc(buffer_size, sizeof(uint8_t));
 
     // Data -> MCTP_MSG_TYPE
     buffer[0] = *type;
     memcpy(&buffer[1], msg, len);
 
-    if (bus >= MCTP_FW_BIND_API_IDX_COUNT) {
-      fwk_assert("Unknow MCTP Bus medium.");
-    }
-    int rc = process_mctp_fw_tx(
+    status = process_mctp_fw_tx(
                 bus, tag_owner, msg_tag, buffer, buffer_size,
                 mctp_fw_ctx.elem_ctx_table[bus].remote_eid);
 
-    if (rc != 0) {
-        assert(false);
+    fwk_mm_free(buffer);
+
+    return status;
+}
+
+/* data from application layer, with room for the type byte, moves via this */
+static int mctp_fw_send_from_headroom(
+      uint32_t bus, bool tag_owner, uint8_t msg_tag,
+      uint8_t msg_type, void *msg, size_t len)
+{
+    uint8_t *buffer = (uint8_t *)msg - MCTP_FW_MSG_HEADROOM;
+
+    if (bus >= MCTP_FW_BIND_API_IDX_COUNT) {
+        FWK_LOG_ERR(MOD_NAME "Unknown MCTP bus - %lu ", (unsigned long)bus);
+        return FWK_E_PARAM;
     }
 
-    fwk_mm_free(buffer);
+    buffer[0] = msg_type;
+
+    return process_mctp_fw_tx(
+                bus, tag_owner, msg_tag, buffer, len + MCTP_FW_MSG_HEADROOM,
+                mctp_fw_ctx.elem_ctx_table[bus].remote_eid);
 }
 
 /*
@@ -81,6 +114,7 @@ static void mctp_fw_receive_from_app_layer(
  */
 static const mctp_fw_api_t mctp_fw_api = {
     .mctp_fw_receive_from_app_layer = mctp_fw_receive_from_app_layer,
+    .mctp_fw_send_from_headroom = mctp_fw_send_from_headroom,
 };
 
 /* sends packet from transport layer to app layer */
@@ -104,7 +138,8 @@ static void mctp_fw_receive_from_mctp(
 
         rc = mctp_ctrl_cmd_handle(*bus, mctp_fw_ctx.txbuf, eid, msg, len);
         if (rc > 0) {
-            process_mctp_fw_tx(*bus, 0, 0, (void *)mctp_fw_ctx.txbuf, rc, eid);
+            (void)process_mctp_fw_tx(
+                *bus, 0, 0, (void *)mctp_fw_ctx.txbuf, rc, eid);
         }
         return;
     }
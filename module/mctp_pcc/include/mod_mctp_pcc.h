@@ -7,8 +7,6 @@
 #define PCC_SUBSPACE_1      0x50434301
 #define PCC_MCTP_COMMAND    0x5054434D // PTCM
 
-#define PCC_TX_BUFFER_SIZE  128
-
 struct mod_mctp_pcc_config {
   fwk_id_t driver_id;
   fwk_id_t driver_api_id;
@@ -18,12 +18,14 @@
 
 #include "mod_mctp_pcc.h"
 
+#include <errno.h>
+
 #define MOD_NAME "[MCTP_PCC] "
 
 struct mctp_pcc_ctx {
     struct mod_mctp_pcc_config *config;
 
-    const struct mod_transport_mctp_pcc_api *transport_api;
+    const struct mod_transport_firmware_api *transport_api;
     const mctp_api_t *mctp_api;
 
     fwk_id_t channel_id;
@@ -32,43 +34,50 @@ struct mctp_pcc_ctx {
 static struct mctp_pcc_ctx ctx;
 static mctp_binding_pcc_t *pcc;
 
+/*
+ * Called by libmctp with a complete packet. Errors are reported to libmctp as
+ * negative errno values: -EBUSY while the mailbox is in use, so that the
+ * packet stays queued, -EMSGSIZE for a packet that can never fit in the
+ * mailbox and -EIO when the transport fails.
+ */
 static int mod_mctp_pcc_tx_fn(void *data, void *buf, size_t len)
 {
-    uint32_t message_header = 0;
-    int status;
-    uint8_t tx_buf[PCC_TX_BUFFER_SIZE] = { 0 };
     struct mctp_pcc_pkt *pcc_pkt;
-    uint32_t tx_buf_size = 0;
+    size_t mailbox_size;
+    int status;
 
+    /*
+     * Build the PCC packet directly in the shared mailbox so that the only
+     * copy of the MCTP packet is the one from the libmctp packet buffer.
+     */
+    status = ctx.transport_api->get_transmit_payload(
+        ctx.channel_id, (void **)&pcc_pkt, &mailbox_size);
+    if (status == FWK_E_BUSY) {
+        return -EBUSY;
+    } else if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "Tx mailbox unavailable.");
+        return -EIO;
+    }
+
+    if ((sizeof(struct mctp_pcc_pkt) + len) > mailbox_size) {
+        FWK_LOG_ERR(MOD_NAME "Tx packet too large for mailbox.");
+        return -EMSGSIZE;
+    }
 
-    pcc_pkt = (struct mctp_pcc_pkt *) tx_buf;
     pcc_pkt->signature = PCC_SUBSPACE_1;
     pcc_pkt->flags = 0;
     pcc_pkt->length = len + sizeof(pcc_pkt->command);
     pcc_pkt->command = PCC_MCTP_COMMAND;
-
-    tx_buf_size = len + sizeof(struct mctp_pcc_pkt);
-
-    if (tx_buf_size > sizeof(tx_buf)) {
-        FWK_LOG_ERR(MOD_NAME "Tx Buffer size not enough");
-        return FWK_E_NOMEM;
-    }
-
-    memcpy(pcc_pkt->mctp_payload, buf, len);
-
-#if FWK_LOG_LEVEL < FWK_LOG_LEVEL_INFO
-    size_t idx;
-    uint8_t *c = (uint8_t *) tx_buf;
-
-    for (idx = 0; idx < tx_buf_size; idx++) {
-        FWK_LOG_INFO(MOD_NAME "TX : 0x%02x", *(c + idx));
-    }
-#endif
-
-    status = ctx.transport_api->transmit(ctx.channel_id, message_header, tx_buf, tx_buf_size, false);
-    if (status != FWK_SUCCESS) {
-        FWK_LOG_ERR(MOD_NAME "Send messagae failed.");
-        return FWK_E_BUSY;
+    fwk_str_memcpy(pcc_pkt->mctp_payload, buf, len);
+
+    /* The payload is already in place, so transmit only rings the doorbell */
+    status = ctx.transport_api->transmit(
+        ctx.channel_id, 0, NULL, sizeof(struct mctp_pcc_pkt) + len, false);
+    if (status == FWK_E_BUSY) {
+        return -EBUSY;
+    } else if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "Send message failed.");
+        return -EIO;
     }
 
     return FWK_SUCCESS;
@@ -130,6 +139,7 @@ static int mod_mctp_pcc_bind(fwk_id_t id, unsigned int round)
             if ((ctx.transport_api->get_max_payload_size == NULL) ||
                 (ctx.transport_api->get_payload == NULL) ||
                 (ctx.transport_api->transmit == NULL) ||
+                (ctx.transport_api->get_transmit_payload == NULL) ||
                 (ctx.transport_api->release_transport_channel_lock == NULL)) {
                 FWK_LOG_ERR(MOD_NAME "Transport APIs Not Implemented.");
                 return FWK_E_DATA;
@@ -219,7 +229,7 @@ static int mctp_pcc_signal_message(fwk_id_t channel_id)
     return FWK_SUCCESS;
 }
 
-struct mod_transport_mctp_pcc_signal_api mctp_pcc_signal_api = {
+struct mod_transport_firmware_signal_api mctp_pcc_signal_api = {
     .signal_error = mctp_pcc_signal_error,
     .signal_message = mctp_pcc_signal_message,
 };
@@ -12,6 +12,10 @@
 
 #include <fwk_id.h>
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #define PL011_ELEMENT_IDX_MCP_UART 1
 
 #define PL011_ELEMENT_ID_MCP_UART \
@@ -29,6 +33,27 @@ enum {
     MCTP_SERIAL_BIND_REQ_API_IDX_COUNT,
 };
 
+/* mctp_serial events */
+enum mod_mctp_serial_event_idx {
+    /* Received bytes are waiting to be handed to the MCTP serial binding */
+    MOD_MCTP_SERIAL_EVENT_IDX_RX,
+    /* The transmit buffer has drained and the binding can send again */
+    MOD_MCTP_SERIAL_EVENT_IDX_TX,
+    MOD_MCTP_SERIAL_EVENT_IDX_COUNT,
+};
+
+/*!
+ * \brief Size of the receive buffer used when the module configuration does
+ *      not provide one.
+ */
+#define MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE 1024
+
+/*!
+ * \brief Size of the transmit buffer used when the module configuration does
+ *      not provide one.
+ */
+#define MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE 1024
+
 /* basic type for mctp_serial elements */
 typedef struct mctp_serial_elem_config {
     fwk_id_t driver_id;
@@ -45,7 +70,8 @@ typedef struct mctp_serial_api {
  */
 struct mod_mctp_serial_module_config {
     /*!
-     * Element identifier of the alarm used for polling the UART
+     * Element identifier of the alarm used for polling the UART, and for
+     * retrying to resume the binding when that could not be queued
      */
     fwk_id_t alarm_id;
 
@@ -53,6 +79,57 @@ struct mod_mctp_serial_module_config {
      * Time period to set for the poll alarm delay (milliseconds)
      */
     uint32_t poll_period;
+
+    /*!
+     * Whether the UART is drained from ::mod_mctp_serial_module_config::rx_irq.
+     * When false, the UART is drained from the poll alarm instead, so a
+     * configuration that does not mention the receive interrupt polls.
+     */
+    bool rx_irq_enabled;
+
+    /*!
+     * Interrupt raised by the UART when its receive FIFO reaches the trigger
+     * level or when the receive timeout expires. The FIFO is drained in bursts
+     * from the interrupt handler. Only used when
+     * ::mod_mctp_serial_module_config::rx_irq_enabled is true.
+     */
+    unsigned int rx_irq;
+
+    /*!
+     * Size in bytes of the buffer holding received data until it is handed to
+     * the MCTP serial binding. When set to 0,
+     * ::MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE is used.
+     */
+    size_t rx_buffer_size;
+
+    /*!
+     * Whether the transmit buffer is drained from
+     * ::mod_mctp_serial_module_config::tx_irq. When false, the transmit buffer
+     * is drained from the poll alarm instead.
+     */
+    bool tx_irq_enabled;
+
+    /*!
+     * Dedicated transmit interrupt of the UART, raised when its transmit FIFO
+     * drains below the trigger level. Frames are queued in a transmit buffer
+     * and fed to the UART from this interrupt. Only used when
+     * ::mod_mctp_serial_module_config::tx_irq_enabled is true.
+     */
+    unsigned int tx_irq;
+
+    /*!
+     * Size in bytes of the buffer holding framed packets until the UART
+     * accepts them. Frames are queued whole: while the buffer is short of
+     * space the binding holds packets back, and a frame larger than the buffer
+     * is dropped. When set to 0, ::MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE is used.
+     */
+    size_t tx_buffer_size;
+
+    /*!
+     * Optional hook called once for every framed packet queued for
+     * transmission, with the complete frame. May be NULL.
+     */
+    void (*tx_trace)(const void *frame, size_t len);
 };
 
 #endif /* MOD_MCTP_SERIAL_H */
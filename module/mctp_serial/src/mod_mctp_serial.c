@@ -11,12 +11,27 @@
 #include <mod_mctp_serial.h>
 #include <mod_timer.h>
 
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_interrupt.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_ring.h>
+#include <fwk_status.h>
+
+#include <errno.h>
 
 #define MOD_NAME "[MCTP_SERIAL]: "
 
+/* Number of received bytes moved between UART, ring and libmctp at once */
+#define MCTP_SERIAL_RX_CHUNK_SIZE 64
+
+/* Number of bytes fed to the UART at once, the depth of the PL011 FIFO */
+#define MCTP_SERIAL_TX_CHUNK_SIZE 32
+
 /* mctp elem type - part of mctp_serial elem ctx*/
 typedef struct mctp_elem_ctx {
     mctp_api_t *mctp_api;
@@ -39,6 +54,30 @@ typedef struct mctp_serial_ctx {
     mctp_serial_elem_ctx_t *elem_ctx_table;
     /* Number of channels */
     unsigned int elem_count;
+
+    /* Module configuration */
+    const struct mod_mctp_serial_module_config *config;
+
+    /* Bytes drained from the UART, waiting to be handed to the binding */
+    struct fwk_ring rx_ring;
+
+    /* Whether a receive event has been queued and not yet processed */
+    volatile bool rx_event_pending;
+
+    /* Whether the receive interrupt is masked because the ring is full */
+    volatile bool rx_irq_masked;
+
+    /* Framed packets waiting to be accepted by the UART */
+    struct fwk_ring tx_ring;
+
+    /* Whether a context is currently feeding the UART from the ring */
+    volatile bool tx_draining;
+
+    /* Whether the binding is paused until the transmit ring has drained */
+    volatile bool tx_blocked;
+
+    /* Number of frames dropped because they can never fit in the ring */
+    unsigned int tx_dropped;
 } mctp_serial_ctx_t;
 
 static mctp_serial_ctx_t mctp_serial_ctx;
@@ -46,28 +85,161 @@ static mctp_binding_serial_t *serial;
 static struct mod_timer_alarm_api *alarm_api;
 static struct fwk_io_stream *fwk_io_mctp;
 
+static mctp_api_t *get_mctp_api()
+{
+    mctp_serial_elem_ctx_t *mctp_elem_ctx;
+
+    mctp_elem_ctx =
+        &mctp_serial_ctx.elem_ctx_table[MCTP_SERIAL_BIND_MCTP_API_IDX];
+
+    return mctp_elem_ctx->mctp_serial_elem.mctp_elem.mctp_api;
+}
+
+/*
+ * Ask for the binding to be resumed once the transmit ring has drained. The
+ * binding is resumed from the event handler as libmctp must not be entered
+ * from interrupt context.
+ */
+static void mctp_serial_tx_request_resume(void)
+{
+    struct fwk_event_light event = {
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_MCTP_SERIAL, MOD_MCTP_SERIAL_EVENT_IDX_TX),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_MCTP_SERIAL),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_MCTP_SERIAL),
+    };
+
+    if (fwk_put_event(&event) != FWK_SUCCESS) {
+        /*
+         * Try again the next time the ring is drained, or from the poll alarm
+         * when the transmit interrupt has already been masked.
+         */
+        mctp_serial_ctx.tx_blocked = true;
+    }
+}
+
+/*
+ * Feed the UART from the transmit ring until either the ring is empty or the
+ * UART transmit FIFO is full. Only one context feeds the UART at a time, so
+ * interrupts are only masked while the ring indices are updated.
+ */
+static void mctp_serial_tx_drain_uart(void)
+{
+    char chunk[MCTP_SERIAL_TX_CHUNK_SIZE];
+    size_t len;
+    size_t sent;
+    bool resume = false;
+    unsigned int flags;
+
+    flags = fwk_interrupt_global_disable();
+
+    if (mctp_serial_ctx.tx_draining) {
+        /* The context we interrupted is already feeding the UART */
+        fwk_interrupt_global_enable(flags);
+
+        return;
+    }
+
+    mctp_serial_ctx.tx_draining = true;
+
+    fwk_interrupt_global_enable(flags);
+
+    do {
+        len = fwk_ring_peek(&mctp_serial_ctx.tx_ring, chunk, sizeof(chunk));
+
+        (void)fwk_io_write_nowait(fwk_io_mctp, &sent, chunk, len);
+
+        flags = fwk_interrupt_global_disable();
+        (void)fwk_ring_pop(&mctp_serial_ctx.tx_ring, NULL, sent);
+        fwk_interrupt_global_enable(flags);
+    } while ((len > 0) && (sent == len));
+
+    flags = fwk_interrupt_global_disable();
+
+    if (mctp_serial_ctx.tx_blocked &&
+        fwk_ring_is_empty(&mctp_serial_ctx.tx_ring)) {
+        mctp_serial_ctx.tx_blocked = false;
+        resume = true;
+    }
+
+    mctp_serial_ctx.tx_draining = false;
+
+    fwk_interrupt_global_enable(flags);
+
+    if (resume) {
+        mctp_serial_tx_request_resume();
+    }
+}
+
+/*
+ * Called by libmctp with a complete frame. Frames are queued whole in the
+ * transmit ring and the UART is fed from the transmit interrupt, or from the
+ * poll alarm. When the ring is short of space the frame is refused with
+ * -EBUSY and the binding is paused, so that libmctp keeps the packet queued
+ * until the ring has drained. A frame larger than the ring is dropped.
+ */
 static int mod_mctp_serial_tx_fn(void *data, void *buf, size_t len)
 {
-    size_t idx;
-    char *ch = (char *)buf;
+    const struct mod_mctp_serial_module_config *config = mctp_serial_ctx.config;
+    mctp_api_t *mctp_api;
+    bool queued;
+    unsigned int flags;
+
+    if (len > fwk_ring_get_capacity(&mctp_serial_ctx.tx_ring)) {
+        mctp_serial_ctx.tx_dropped++;
+        FWK_LOG_ERR(
+            MOD_NAME "Dropped %u byte frame, larger than the Tx buffer",
+            (unsigned int)len);
+
+        return -EMSGSIZE;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    queued = (fwk_ring_get_free(&mctp_serial_ctx.tx_ring) >= len);
+    if (queued) {
+        (void)fwk_ring_push(
+            &mctp_serial_ctx.tx_ring, (const char *)buf, len);
+    } else {
+        mctp_serial_ctx.tx_blocked = true;
+    }
+
+    fwk_interrupt_global_enable(flags);
+
+    if (!queued) {
+        mctp_api = get_mctp_api();
+        mctp_api->mctp_binding_set_tx_enabled(
+            mctp_api->mctp_binding_serial_core(serial), false);
 
-    FWK_LOG_DEBUG("[MCTP Serial] Sending packet ... ");
-    for (idx = 0; idx < len; idx++) {
-        FWK_LOG_DEBUG("Tx : 0x%02x", (char)ch[idx]);
-        fwk_io_putch(fwk_io_mctp, ch[idx]);
+        return -EBUSY;
     }
 
-    return len;
+    FWK_LOG_DEBUG(MOD_NAME "Sending packet (%u bytes)", (unsigned int)len);
+
+    if (config->tx_trace != NULL) {
+        config->tx_trace(buf, len);
+    }
+
+    if (config->tx_irq_enabled) {
+        /* The interrupt fires straight away while the UART FIFO has room */
+        (void)fwk_interrupt_enable(config->tx_irq);
+    } else {
+        /* Prime the UART FIFO, the rest is sent from the poll alarm */
+        mctp_serial_tx_drain_uart();
+    }
+
+    return (int)len;
 }
 
-static mctp_api_t *get_mctp_api()
+/* Let libmctp send the packets it held back while the ring was full */
+static int mctp_serial_tx_resume(void)
 {
-    mctp_serial_elem_ctx_t *mctp_elem_ctx;
+    mctp_api_t *mctp_api = get_mctp_api();
 
-    mctp_elem_ctx =
-        &mctp_serial_ctx.elem_ctx_table[MCTP_SERIAL_BIND_MCTP_API_IDX];
+    mctp_api->mctp_binding_set_tx_enabled(
+        mctp_api->mctp_binding_serial_core(serial), true);
 
-    return mctp_elem_ctx->mctp_serial_elem.mctp_elem.mctp_api;
+    return FWK_SUCCESS;
 }
 
 /*
@@ -92,6 +264,13 @@ static int mod_mctp_serial_init(
     unsigned int elem_count,
     const void *config)
 {
+    size_t rx_buffer_size;
+    size_t tx_buffer_size;
+
+    if (config == NULL) {
+        return FWK_E_DATA;
+    }
+
     mctp_serial_ctx.elem_ctx_table =
         fwk_mm_calloc(elem_count, sizeof(mctp_serial_ctx.elem_ctx_table[0]));
 
@@ -100,6 +279,27 @@ static int mod_mctp_serial_init(
     }
 
     mctp_serial_ctx.elem_count = elem_count;
+    mctp_serial_ctx.config = config;
+
+    rx_buffer_size = mctp_serial_ctx.config->rx_buffer_size;
+    if (rx_buffer_size == 0) {
+        rx_buffer_size = MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE;
+    }
+
+    fwk_ring_init(
+        &mctp_serial_ctx.rx_ring,
+        fwk_mm_alloc(rx_buffer_size, sizeof(char)),
+        rx_buffer_size);
+
+    tx_buffer_size = mctp_serial_ctx.config->tx_buffer_size;
+    if (tx_buffer_size == 0) {
+        tx_buffer_size = MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE;
+    }
+
+    fwk_ring_init(
+        &mctp_serial_ctx.tx_ring,
+        fwk_mm_alloc(tx_buffer_size, sizeof(char)),
+        tx_buffer_size);
 
     /* Initialize mctp serial uart */
     static struct fwk_io_stream mctp_stream;
@@ -210,19 +410,174 @@ static int mctp_serial_bind_request(
     return FWK_SUCCESS;
 }
 
+/*
+ * Move everything the UART has received into the receive ring and make sure an
+ * event is queued to hand it over to the binding. Called from interrupt
+ * context, either by the UART receive interrupt or by the poll alarm.
+ */
+static void mctp_serial_rx_drain_uart(void)
+{
+    int status = FWK_SUCCESS;
+    char chunk[MCTP_SERIAL_RX_CHUNK_SIZE];
+    size_t free_space;
+    size_t len;
+    struct fwk_event_light event;
+
+    while (status == FWK_SUCCESS) {
+        free_space = fwk_ring_get_free(&mctp_serial_ctx.rx_ring);
+        if (free_space > sizeof(chunk)) {
+            free_space = sizeof(chunk);
+        }
+
+        status = fwk_io_read(fwk_io_mctp, &len, chunk, 1, free_space);
+        if (len == 0) {
+            break;
+        }
+
+        (void)fwk_ring_push(&mctp_serial_ctx.rx_ring, chunk, len);
+    }
+
+    if (fwk_ring_is_full(&mctp_serial_ctx.rx_ring) &&
+        mctp_serial_ctx.config->rx_irq_enabled) {
+        /*
+         * The data left in the FIFO keeps the interrupt asserted, so mask it
+         * until the ring has been drained.
+         */
+        (void)fwk_interrupt_disable(mctp_serial_ctx.config->rx_irq);
+        mctp_serial_ctx.rx_irq_masked = true;
+    }
+
+    if (fwk_ring_is_empty(&mctp_serial_ctx.rx_ring) ||
+        mctp_serial_ctx.rx_event_pending) {
+        return;
+    }
+
+    event = (struct fwk_event_light){
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_MCTP_SERIAL, MOD_MCTP_SERIAL_EVENT_IDX_RX),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_MCTP_SERIAL),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_MCTP_SERIAL),
+    };
+
+    mctp_serial_ctx.rx_event_pending = true;
+
+    if (fwk_put_event(&event) != FWK_SUCCESS) {
+        mctp_serial_ctx.rx_event_pending = false;
+    }
+}
+
+static void rx_isr(void)
+{
+    mctp_serial_rx_drain_uart();
+}
+
+static void tx_isr(void)
+{
+    mctp_serial_tx_drain_uart();
+
+    if (fwk_ring_is_empty(&mctp_serial_ctx.tx_ring)) {
+        /* Nothing left to send, the interrupt stays asserted until then */
+        (void)fwk_interrupt_disable(mctp_serial_ctx.config->tx_irq);
+    }
+}
+
 static void alarm_callback(uintptr_t module_idx)
 {
-    int status;
-    char ch = 0;
+    if (!mctp_serial_ctx.config->rx_irq_enabled) {
+        mctp_serial_rx_drain_uart();
+    }
+
+    /*
+     * With the transmit interrupt, the ring is only drained from here when
+     * the binding is still waiting to be resumed.
+     */
+    if (!mctp_serial_ctx.config->tx_irq_enabled ||
+        mctp_serial_ctx.tx_blocked) {
+        mctp_serial_tx_drain_uart();
+    }
+}
+
+/* Hand everything held in the receive ring to the binding in chunks */
+static int mctp_serial_rx_process(void)
+{
+    char chunk[MCTP_SERIAL_RX_CHUNK_SIZE];
+    size_t len;
+    unsigned int flags;
     mctp_api_t *mctp_api;
 
-    /* Get the pending character (if any) from the UART without blocking */
-    status = fwk_io_getch(fwk_io_mctp, &ch);
+    mctp_api = get_mctp_api();
+
+    do {
+        flags = fwk_interrupt_global_disable();
 
-    if (status == FWK_SUCCESS) {
-        mctp_api = get_mctp_api();
-        mctp_api->mctp_serial_rx(serial, (const void *)&ch, 1);
+        len = fwk_ring_pop(&mctp_serial_ctx.rx_ring, chunk, sizeof(chunk));
+        if (len == 0) {
+            /* Anything received from now on needs a new event */
+            mctp_serial_ctx.rx_event_pending = false;
+        }
+
+        fwk_interrupt_global_enable(flags);
+
+        if (len > 0) {
+            mctp_api->mctp_serial_rx(serial, (const void *)chunk, len);
+        }
+    } while (len > 0);
+
+    if (mctp_serial_ctx.rx_irq_masked) {
+        mctp_serial_ctx.rx_irq_masked = false;
+
+        return fwk_interrupt_enable(mctp_serial_ctx.config->rx_irq);
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int mctp_serial_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    switch (fwk_id_get_event_idx(event->id)) {
+    case MOD_MCTP_SERIAL_EVENT_IDX_RX:
+        return mctp_serial_rx_process();
+
+    case MOD_MCTP_SERIAL_EVENT_IDX_TX:
+        return mctp_serial_tx_resume();
+
+    default:
+        return FWK_E_PARAM;
+    }
+}
+
+static int start_rx_irq(void)
+{
+    int status;
+    unsigned int rx_irq = mctp_serial_ctx.config->rx_irq;
+
+    status = fwk_interrupt_set_isr(rx_irq, rx_isr);
+    if (status != FWK_SUCCESS) {
+        return status;
     }
+
+    status = fwk_interrupt_clear_pending(rx_irq);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    return fwk_interrupt_enable(rx_irq);
+}
+
+static int start_tx_irq(void)
+{
+    int status;
+    unsigned int tx_irq = mctp_serial_ctx.config->tx_irq;
+
+    status = fwk_interrupt_set_isr(tx_irq, tx_isr);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* The interrupt is only enabled while there is data to send */
+    return fwk_interrupt_disable(tx_irq);
 }
 
 static int start_alarm(fwk_id_t id)
@@ -247,7 +602,9 @@ static int start_alarm(fwk_id_t id)
 
 static int mctp_serial_start(fwk_id_t id)
 {
+    int status;
     mctp_api_t *mctp_api;
+    const struct mod_mctp_serial_module_config *config;
 
     if (!fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
         return FWK_SUCCESS;
@@ -261,6 +618,26 @@ static int mctp_serial_start(fwk_id_t id)
 
     mctp_api->mctp_serial_set_tx_fn(serial, mod_mctp_serial_tx_fn, 0);
 
+    config = mctp_serial_ctx.config;
+
+    if (config->rx_irq_enabled) {
+        status = start_rx_irq();
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
+    if (config->tx_irq_enabled) {
+        status = start_tx_irq();
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
+    /*
+     * Fall back to polling the UART for whichever direction lacks an IRQ. The
+     * alarm also retries resuming the binding when the event queue was full.
+     */
     return start_alarm(id);
 }
 
@@ -268,10 +645,12 @@ static int mctp_serial_start(fwk_id_t id)
 const struct fwk_module module_mctp_serial = {
     .type = FWK_MODULE_TYPE_SERVICE,
     .api_count = MCTP_SERIAL_BIND_REQ_API_IDX_COUNT,
-    .event_count = 1,
+    .event_count = (unsigned int)MOD_MCTP_SERIAL_EVENT_IDX_COUNT,
+    .event_priority = FWK_EVENT_PRIORITY_HIGH,
     .init = mod_mctp_serial_init,
     .element_init = mctp_serial_elem_init,
     .bind = mctp_serial_bind,
     .start = mctp_serial_start,
     .process_bind_request = mctp_serial_bind_request,
+    .process_event = mctp_serial_process_event,
 };
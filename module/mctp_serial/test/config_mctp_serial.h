@@ -0,0 +1,49 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_mctp_serial.h>
+
+#include <fwk_interrupt.h>
+
+#define FAKE_UART_RX_IRQ 42
+#define FAKE_UART_TX_IRQ 43
+
+/* Ring large enough for a full UART FIFO, but not for two */
+#define SMALL_RX_BUFFER_SIZE 48
+#define SMALL_TX_BUFFER_SIZE 48
+
+void fake_tx_trace(const void *frame, size_t len);
+
+static const struct mod_mctp_serial_module_config config_mctp_serial_poll = {
+    .poll_period = 1,
+    .rx_buffer_size = MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE,
+    .tx_buffer_size = MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE,
+    .tx_trace = fake_tx_trace,
+};
+
+static const struct mod_mctp_serial_module_config config_mctp_serial_irq = {
+    .poll_period = 1,
+    .rx_irq_enabled = true,
+    .rx_irq = FAKE_UART_RX_IRQ,
+    .rx_buffer_size = MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE,
+    .tx_irq_enabled = true,
+    .tx_irq = FAKE_UART_TX_IRQ,
+    .tx_buffer_size = MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE,
+    .tx_trace = fake_tx_trace,
+};
+
+static const struct mod_mctp_serial_module_config
+    config_mctp_serial_irq_small_ring = {
+        .poll_period = 1,
+        .rx_irq_enabled = true,
+        .rx_irq = FAKE_UART_RX_IRQ,
+        .rx_buffer_size = SMALL_RX_BUFFER_SIZE,
+        .tx_irq_enabled = true,
+        .tx_irq = FAKE_UART_TX_IRQ,
+        .tx_buffer_size = SMALL_TX_BUFFER_SIZE,
+        .tx_trace = fake_tx_trace,
+    };
@@ -0,0 +1,260 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_interrupt.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_mctp_serial.h>
+
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_io.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_ring.h>
+#include <fwk_status.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include UNIT_TEST_SRC
+
+/* Depth of the PL011 receive FIFO */
+#define UART_FIFO_DEPTH 32
+
+/* Size of a PLDM message pushed through the binding */
+#define PLDM_MESSAGE_SIZE (4 * 1024)
+
+/* Number of PLDM messages used for the throughput measurement */
+#define PLDM_MESSAGE_COUNT 64
+
+/* Endpoints of the sending and receiving MCTP stacks */
+#define SENDER_EID   9
+#define RECEIVER_EID 8
+
+/* Worst case wire size of one PLDM message once framed and escaped */
+#define WIRE_BUFFER_SIZE (4 * PLDM_MESSAGE_SIZE)
+
+static const struct mod_mctp_serial_module_config config_benchmark = {
+    .poll_period = 1,
+    .rx_irq_enabled = true,
+    .rx_irq = 42,
+    .rx_buffer_size = MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE,
+    .tx_buffer_size = MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE,
+};
+
+static char wire[WIRE_BUFFER_SIZE];
+static size_t wire_len;
+static size_t wire_pos;
+static size_t fifo_level;
+
+static uint8_t message[PLDM_MESSAGE_SIZE];
+static unsigned int messages_received;
+static unsigned int put_event_calls;
+
+static char rx_ring_storage[MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE];
+static char tx_ring_storage[MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE];
+
+/* MCTP stack framing the messages onto the wire */
+static mctp_t *sender;
+static mctp_binding_serial_t *sender_serial;
+
+/* MCTP stack behind the module, fed from the fake UART */
+static mctp_t *receiver;
+
+static int fake_uart_getch(const struct fwk_io_stream *stream, char *ch)
+{
+    if (fifo_level == 0) {
+        return FWK_PENDING;
+    }
+
+    *ch = wire[wire_pos++];
+    fifo_level--;
+
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_io_adapter fake_uart_adapter = {
+    .getch = fake_uart_getch,
+};
+
+static struct fwk_io_stream fake_uart_stream = {
+    .adapter = &fake_uart_adapter,
+    .mode = FWK_IO_MODE_READ,
+};
+
+/* Capture the frames produced by the sending binding */
+static int sender_tx(void *data, void *buf, size_t len)
+{
+    TEST_ASSERT_TRUE((wire_len + len) <= sizeof(wire));
+
+    memcpy(&wire[wire_len], buf, len);
+    wire_len += len;
+
+    return (int)len;
+}
+
+static void receiver_rx(
+    uint8_t eid,
+    bool tag_owner,
+    uint8_t msg_tag,
+    void *data,
+    void *msg,
+    size_t len)
+{
+    TEST_ASSERT_EQUAL(SENDER_EID, eid);
+    TEST_ASSERT_EQUAL(PLDM_MESSAGE_SIZE, len);
+    TEST_ASSERT_EQUAL_MEMORY(message, msg, len);
+
+    messages_received++;
+}
+
+static mctp_api_t libmctp_api = {
+    .mctp_serial_rx = mctp_serial_rx,
+};
+
+static mctp_serial_elem_ctx_t benchmark_elem_ctx_table[1];
+
+static int put_event_callback(struct fwk_event_light *event, int num_calls)
+{
+    put_event_calls++;
+
+    return FWK_SUCCESS;
+}
+
+/* Frame one PLDM message with the sending stack */
+static void build_pldm_wire_image(unsigned int seed)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(message); i++) {
+        message[i] = (uint8_t)(i * 31 + seed);
+    }
+
+    wire_len = 0;
+    wire_pos = 0;
+    fifo_level = 0;
+
+    TEST_ASSERT_EQUAL(
+        0,
+        mctp_message_tx(
+            sender, RECEIVER_EID, true, 0, message, sizeof(message)));
+}
+
+/*
+ * Run the receive path until the whole wire image has been consumed. The UART
+ * FIFO is refilled before every interrupt, and the event loop only runs once
+ * an event has been queued, as it would on the target.
+ */
+static void run_rx_until_idle(void)
+{
+    unsigned int events_processed = 0;
+
+    while ((wire_pos < wire_len) || mctp_serial_ctx.rx_event_pending) {
+        fifo_level = FWK_MIN(wire_len - wire_pos, (size_t)UART_FIFO_DEPTH);
+        rx_isr();
+
+        if (put_event_calls > events_processed) {
+            events_processed++;
+            TEST_ASSERT_EQUAL(FWK_SUCCESS, mctp_serial_rx_process());
+        }
+    }
+}
+
+void setUp(void)
+{
+    memset(&mctp_serial_ctx, 0, sizeof(mctp_serial_ctx));
+    memset(benchmark_elem_ctx_table, 0, sizeof(benchmark_elem_ctx_table));
+
+    benchmark_elem_ctx_table[MCTP_SERIAL_BIND_MCTP_API_IDX]
+        .mctp_serial_elem.mctp_elem.mctp_api = &libmctp_api;
+    mctp_serial_ctx.elem_ctx_table = benchmark_elem_ctx_table;
+    mctp_serial_ctx.elem_count = FWK_ARRAY_SIZE(benchmark_elem_ctx_table);
+    mctp_serial_ctx.config = &config_benchmark;
+    fwk_ring_init(
+        &mctp_serial_ctx.rx_ring, rx_ring_storage, sizeof(rx_ring_storage));
+    fwk_ring_init(
+        &mctp_serial_ctx.tx_ring, tx_ring_storage, sizeof(tx_ring_storage));
+
+    fwk_io_mctp = &fake_uart_stream;
+
+    mctp_set_alloc_ops(malloc, free, realloc);
+
+    sender = mctp_init();
+    sender_serial = mctp_serial_init();
+    mctp_serial_set_tx_fn(sender_serial, sender_tx, NULL);
+    mctp_register_bus(
+        sender, mctp_binding_serial_core(sender_serial), SENDER_EID);
+
+    receiver = mctp_init();
+    serial = mctp_serial_init();
+    mctp_register_bus(
+        receiver, mctp_binding_serial_core(serial), RECEIVER_EID);
+    mctp_set_rx_all(receiver, receiver_rx, NULL);
+
+    messages_received = 0;
+    put_event_calls = 0;
+
+    __fwk_put_event_light_Stub(put_event_callback);
+}
+
+void tearDown(void)
+{
+    mctp_destroy(receiver);
+    mctp_serial_destroy(serial);
+    mctp_destroy(sender);
+    mctp_serial_destroy(sender_serial);
+}
+
+void benchmark_mctp_serial_rx_throughput(void)
+{
+    unsigned int msg;
+    size_t total_bytes = 0;
+    clock_t start;
+    clock_t elapsed = 0;
+    double seconds;
+
+    for (msg = 0; msg < PLDM_MESSAGE_COUNT; msg++) {
+        build_pldm_wire_image(msg);
+
+        start = clock();
+        run_rx_until_idle();
+        elapsed += clock() - start;
+
+        TEST_ASSERT_EQUAL(msg + 1, messages_received);
+        total_bytes += wire_len;
+    }
+
+    seconds = (double)elapsed / CLOCKS_PER_SEC;
+    if (seconds > 0) {
+        printf(
+            "mctp_serial rx: %zu bytes (%u x %u byte PLDM messages) at %.0f "
+            "bytes/s, %u events\n",
+            total_bytes,
+            PLDM_MESSAGE_COUNT,
+            PLDM_MESSAGE_SIZE,
+            (double)total_bytes / seconds,
+            put_event_calls);
+    }
+}
+
+int mctp_serial_benchmark_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(benchmark_mctp_serial_rx_throughput);
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return mctp_serial_benchmark_main();
+}
@@ -0,0 +1,581 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_interrupt.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_mctp_serial.h>
+
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_io.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_ring.h>
+#include <fwk_status.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#include "config_mctp_serial.h"
+
+/* Depth of the PL011 receive FIFO */
+#define UART_FIFO_DEPTH 32
+
+/* Size of a PLDM message pushed through the binding */
+#define PLDM_MESSAGE_SIZE (4 * 1024)
+
+/* MCTP baseline transmission unit and header size */
+#define MCTP_BTU      64
+#define MCTP_HDR_SIZE 4
+
+/* MCTP serial framing */
+#define MCTP_SERIAL_FRAME_FLAG 0x7E
+#define MCTP_SERIAL_ESCAPE     0x7D
+#define MCTP_SERIAL_REVISION   0x01
+
+/* Worst case wire size of one PLDM message once framed and escaped */
+#define WIRE_BUFFER_SIZE (4 * PLDM_MESSAGE_SIZE)
+
+static char wire[WIRE_BUFFER_SIZE];
+static size_t wire_len;
+static size_t wire_pos;
+static size_t fifo_level;
+
+static char received[WIRE_BUFFER_SIZE];
+static size_t received_len;
+static unsigned int serial_rx_calls;
+
+static unsigned int put_event_calls;
+static unsigned int tx_event_calls;
+static int tx_event_status;
+
+static char transmitted[WIRE_BUFFER_SIZE];
+static size_t transmitted_len;
+static size_t tx_fifo_level;
+static unsigned int tx_trace_calls;
+
+static char rx_ring_storage[MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE];
+static char tx_ring_storage[MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE];
+static char fake_binding;
+static char fake_binding_core;
+static int binding_tx_enabled;
+
+static int fake_uart_getch(const struct fwk_io_stream *stream, char *ch)
+{
+    if (fifo_level == 0) {
+        return FWK_PENDING;
+    }
+
+    *ch = wire[wire_pos++];
+    fifo_level--;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_uart_putch(const struct fwk_io_stream *stream, char ch)
+{
+    if (tx_fifo_level == UART_FIFO_DEPTH) {
+        return FWK_E_BUSY;
+    }
+
+    transmitted[transmitted_len++] = ch;
+    tx_fifo_level++;
+
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_io_adapter fake_uart_adapter = {
+    .getch = fake_uart_getch,
+    .putch = fake_uart_putch,
+};
+
+static struct fwk_io_stream fake_uart_stream = {
+    .adapter = &fake_uart_adapter,
+    .mode = (enum fwk_io_mode)(FWK_IO_MODE_READ | FWK_IO_MODE_WRITE),
+};
+
+void fake_tx_trace(const void *frame, size_t len)
+{
+    tx_trace_calls++;
+}
+
+static int fake_mctp_serial_rx(
+    mctp_binding_serial_t *binding,
+    const void *buf,
+    size_t len)
+{
+    TEST_ASSERT_TRUE((received_len + len) <= sizeof(received));
+
+    memcpy(&received[received_len], buf, len);
+    received_len += len;
+    serial_rx_calls++;
+
+    return 0;
+}
+
+static mctp_binding_t *fake_mctp_binding_serial_core(
+    mctp_binding_serial_t *binding)
+{
+    TEST_ASSERT_EQUAL_PTR(&fake_binding, binding);
+
+    return (mctp_binding_t *)&fake_binding_core;
+}
+
+static void fake_mctp_binding_set_tx_enabled(
+    mctp_binding_t *binding,
+    bool enable)
+{
+    TEST_ASSERT_EQUAL_PTR(&fake_binding_core, binding);
+
+    binding_tx_enabled = enable;
+}
+
+static mctp_api_t fake_mctp_api = {
+    .mctp_binding_set_tx_enabled = fake_mctp_binding_set_tx_enabled,
+    .mctp_binding_serial_core = fake_mctp_binding_serial_core,
+    .mctp_serial_rx = fake_mctp_serial_rx,
+};
+
+static mctp_serial_elem_ctx_t fake_elem_ctx_table[1];
+
+static int put_event_callback(struct fwk_event_light *event, int num_calls)
+{
+    if (fwk_id_get_event_idx(event->id) == MOD_MCTP_SERIAL_EVENT_IDX_TX) {
+        tx_event_calls++;
+
+        return tx_event_status;
+    } else {
+        TEST_ASSERT_EQUAL(
+            MOD_MCTP_SERIAL_EVENT_IDX_RX, fwk_id_get_event_idx(event->id));
+        put_event_calls++;
+    }
+
+    return FWK_SUCCESS;
+}
+
+/* Move up to a FIFO worth of wire data into the fake UART */
+static void fake_uart_fill_fifo(void)
+{
+    size_t remaining = wire_len - wire_pos;
+
+    fifo_level = FWK_MIN(remaining, (size_t)UART_FIFO_DEPTH);
+}
+
+static size_t frame_append_byte(size_t pos, uint8_t byte)
+{
+    if ((byte == MCTP_SERIAL_FRAME_FLAG) || (byte == MCTP_SERIAL_ESCAPE)) {
+        wire[pos++] = (char)MCTP_SERIAL_ESCAPE;
+        byte ^= 0x20;
+    }
+
+    wire[pos++] = (char)byte;
+
+    return pos;
+}
+
+/*
+ * Build the serial wire image of a PLDM message split into MCTP packets. The
+ * FCS is left at zero as the binding is stubbed and does not verify it.
+ */
+static void build_pldm_wire_image(unsigned int seed)
+{
+    size_t payload_per_packet = MCTP_BTU;
+    size_t offset;
+    size_t chunk;
+    size_t pos = 0;
+    size_t i;
+
+    for (offset = 0; offset < PLDM_MESSAGE_SIZE; offset += chunk) {
+        chunk = FWK_MIN(payload_per_packet, PLDM_MESSAGE_SIZE - offset);
+
+        wire[pos++] = (char)MCTP_SERIAL_FRAME_FLAG;
+        wire[pos++] = (char)MCTP_SERIAL_REVISION;
+        pos = frame_append_byte(pos, (uint8_t)(chunk + MCTP_HDR_SIZE));
+
+        /* MCTP header: version, destination, source, flags and tag */
+        pos = frame_append_byte(pos, 0x01);
+        pos = frame_append_byte(pos, 0x08);
+        pos = frame_append_byte(pos, 0x09);
+        pos = frame_append_byte(
+            pos,
+            (uint8_t)(((offset == 0) ? 0x80 : 0) |
+                      ((offset + chunk == PLDM_MESSAGE_SIZE) ? 0x40 : 0)));
+
+        for (i = 0; i < chunk; i++) {
+            pos = frame_append_byte(pos, (uint8_t)((offset + i) * 31 + seed));
+        }
+
+        wire[pos++] = 0;
+        wire[pos++] = 0;
+        wire[pos++] = (char)MCTP_SERIAL_FRAME_FLAG;
+    }
+
+    wire_len = pos;
+    wire_pos = 0;
+    fifo_level = 0;
+}
+
+static void set_config(const struct mod_mctp_serial_module_config *config)
+{
+    mctp_serial_ctx.config = config;
+    fwk_ring_init(
+        &mctp_serial_ctx.rx_ring, rx_ring_storage, config->rx_buffer_size);
+    fwk_ring_init(
+        &mctp_serial_ctx.tx_ring, tx_ring_storage, config->tx_buffer_size);
+}
+
+/*
+ * Run the receive path until the whole wire image has been consumed. The UART
+ * FIFO is refilled before every interrupt, and the event loop only runs once
+ * an event has been queued, as it would on the target.
+ */
+static void run_rx_until_idle(void (*isr)(void))
+{
+    unsigned int events_processed = 0;
+    int status;
+
+    while ((wire_pos < wire_len) || mctp_serial_ctx.rx_event_pending) {
+        fake_uart_fill_fifo();
+        isr();
+
+        if (put_event_calls > events_processed) {
+            events_processed++;
+            status = mctp_serial_rx_process();
+            TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+        }
+    }
+}
+
+/*
+ * Take transmit interrupts until the ring is empty. The UART FIFO drains
+ * completely between interrupts, and the interrupt that empties the ring masks
+ * the line.
+ */
+static void run_tx_isr_until_idle(void)
+{
+    while (!fwk_ring_is_empty(&mctp_serial_ctx.tx_ring)) {
+        tx_fifo_level = 0;
+
+        if (fwk_ring_get_length(&mctp_serial_ctx.tx_ring) <= UART_FIFO_DEPTH) {
+            fwk_interrupt_disable_ExpectAndReturn(
+                FAKE_UART_TX_IRQ, FWK_SUCCESS);
+        }
+
+        tx_isr();
+    }
+}
+
+static void poll_isr(void)
+{
+    alarm_callback(FWK_MODULE_IDX_MCTP_SERIAL);
+}
+
+void setUp(void)
+{
+    memset(&mctp_serial_ctx, 0, sizeof(mctp_serial_ctx));
+    memset(fake_elem_ctx_table, 0, sizeof(fake_elem_ctx_table));
+
+    fake_elem_ctx_table[MCTP_SERIAL_BIND_MCTP_API_IDX]
+        .mctp_serial_elem.mctp_elem.mctp_api = &fake_mctp_api;
+    mctp_serial_ctx.elem_ctx_table = fake_elem_ctx_table;
+    mctp_serial_ctx.elem_count = FWK_ARRAY_SIZE(fake_elem_ctx_table);
+
+    serial = (mctp_binding_serial_t *)&fake_binding;
+    fwk_io_mctp = &fake_uart_stream;
+
+    received_len = 0;
+    serial_rx_calls = 0;
+    put_event_calls = 0;
+    tx_event_calls = 0;
+    tx_event_status = FWK_SUCCESS;
+    binding_tx_enabled = -1;
+
+    transmitted_len = 0;
+    tx_fifo_level = 0;
+    tx_trace_calls = 0;
+
+    __fwk_put_event_light_Stub(put_event_callback);
+}
+
+void tearDown(void)
+{
+}
+
+void test_mctp_serial_rx_poll_burst(void)
+{
+    set_config(&config_mctp_serial_poll);
+    build_pldm_wire_image(1);
+
+    run_rx_until_idle(poll_isr);
+
+    TEST_ASSERT_EQUAL(wire_len, received_len);
+    TEST_ASSERT_EQUAL_MEMORY(wire, received, wire_len);
+
+    /* Every poll delivers a whole FIFO instead of a single byte */
+    TEST_ASSERT_TRUE(
+        serial_rx_calls <= ((wire_len + UART_FIFO_DEPTH - 1) / UART_FIFO_DEPTH));
+}
+
+void test_mctp_serial_rx_irq_burst(void)
+{
+    set_config(&config_mctp_serial_irq);
+    build_pldm_wire_image(2);
+
+    run_rx_until_idle(rx_isr);
+
+    TEST_ASSERT_EQUAL(wire_len, received_len);
+    TEST_ASSERT_EQUAL_MEMORY(wire, received, wire_len);
+    TEST_ASSERT_FALSE(mctp_serial_ctx.rx_irq_masked);
+}
+
+void test_mctp_serial_rx_single_event_per_batch(void)
+{
+    set_config(&config_mctp_serial_irq);
+    build_pldm_wire_image(3);
+
+    fake_uart_fill_fifo();
+    rx_isr();
+    fake_uart_fill_fifo();
+    rx_isr();
+
+    /* The second interrupt finds an event already queued */
+    TEST_ASSERT_EQUAL(1, put_event_calls);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, mctp_serial_rx_process());
+    TEST_ASSERT_EQUAL(2 * UART_FIFO_DEPTH, received_len);
+    TEST_ASSERT_EQUAL(
+        (2 * UART_FIFO_DEPTH) / MCTP_SERIAL_RX_CHUNK_SIZE, serial_rx_calls);
+    TEST_ASSERT_FALSE(mctp_serial_ctx.rx_event_pending);
+}
+
+void test_mctp_serial_rx_nothing_received(void)
+{
+    set_config(&config_mctp_serial_irq);
+    build_pldm_wire_image(4);
+
+    rx_isr();
+
+    TEST_ASSERT_EQUAL(0, put_event_calls);
+    TEST_ASSERT_FALSE(mctp_serial_ctx.rx_event_pending);
+}
+
+void test_mctp_serial_rx_ring_full_masks_irq(void)
+{
+    int status;
+
+    set_config(&config_mctp_serial_irq_small_ring);
+    build_pldm_wire_image(5);
+
+    fake_uart_fill_fifo();
+    rx_isr();
+    TEST_ASSERT_FALSE(mctp_serial_ctx.rx_irq_masked);
+
+    fwk_interrupt_disable_ExpectAndReturn(FAKE_UART_RX_IRQ, FWK_SUCCESS);
+    fake_uart_fill_fifo();
+    rx_isr();
+    TEST_ASSERT_TRUE(mctp_serial_ctx.rx_irq_masked);
+
+    /* What did not fit in the ring is left in the FIFO */
+    TEST_ASSERT_EQUAL(2 * UART_FIFO_DEPTH - SMALL_RX_BUFFER_SIZE, fifo_level);
+
+    fwk_interrupt_enable_ExpectAndReturn(FAKE_UART_RX_IRQ, FWK_SUCCESS);
+    status = mctp_serial_rx_process();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(mctp_serial_ctx.rx_irq_masked);
+    TEST_ASSERT_EQUAL(SMALL_RX_BUFFER_SIZE, received_len);
+}
+
+void test_mctp_serial_process_event_invalid(void)
+{
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_MCTP_SERIAL, MOD_MCTP_SERIAL_EVENT_IDX_COUNT),
+    };
+    struct fwk_event resp_event;
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_PARAM, mctp_serial_process_event(&event, &resp_event));
+}
+
+void test_mctp_serial_tx_poll_queues_frame(void)
+{
+    int queued;
+
+    set_config(&config_mctp_serial_poll);
+    build_pldm_wire_image(6);
+
+    queued = mod_mctp_serial_tx_fn(NULL, wire, 200);
+    TEST_ASSERT_EQUAL(200, queued);
+    TEST_ASSERT_EQUAL(1, tx_trace_calls);
+
+    /* Only what fits in the UART FIFO is written straight away */
+    TEST_ASSERT_EQUAL(UART_FIFO_DEPTH, transmitted_len);
+
+    while (!fwk_ring_is_empty(&mctp_serial_ctx.tx_ring)) {
+        tx_fifo_level = 0;
+        alarm_callback(FWK_MODULE_IDX_MCTP_SERIAL);
+    }
+
+    TEST_ASSERT_EQUAL(200, transmitted_len);
+    TEST_ASSERT_EQUAL_MEMORY(wire, transmitted, 200);
+}
+
+void test_mctp_serial_tx_ring_full_holds_back_frame(void)
+{
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_MCTP_SERIAL, MOD_MCTP_SERIAL_EVENT_IDX_TX),
+    };
+    struct fwk_event resp_event;
+    int queued;
+
+    set_config(&config_mctp_serial_irq_small_ring);
+    build_pldm_wire_image(7);
+
+    fwk_interrupt_enable_ExpectAndReturn(FAKE_UART_TX_IRQ, FWK_SUCCESS);
+    queued = mod_mctp_serial_tx_fn(NULL, wire, 40);
+    TEST_ASSERT_EQUAL(40, queued);
+
+    /* The second frame does not fit, so libmctp has to keep it queued */
+    queued = mod_mctp_serial_tx_fn(NULL, &wire[40], 40);
+    TEST_ASSERT_EQUAL(-EBUSY, queued);
+    TEST_ASSERT_EQUAL(false, binding_tx_enabled);
+    TEST_ASSERT_EQUAL(1, tx_trace_calls);
+    TEST_ASSERT_EQUAL(40, fwk_ring_get_length(&mctp_serial_ctx.tx_ring));
+
+    /* Once the ring has drained, the binding is resumed from the event */
+    run_tx_isr_until_idle();
+    TEST_ASSERT_EQUAL(1, tx_event_calls);
+    TEST_ASSERT_FALSE(mctp_serial_ctx.tx_blocked);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, mctp_serial_process_event(&event, &resp_event));
+    TEST_ASSERT_EQUAL(true, binding_tx_enabled);
+
+    TEST_ASSERT_EQUAL(40, transmitted_len);
+    TEST_ASSERT_EQUAL_MEMORY(wire, transmitted, 40);
+}
+
+void test_mctp_serial_tx_irq_resume_retried_from_alarm(void)
+{
+    int queued;
+
+    set_config(&config_mctp_serial_irq_small_ring);
+    build_pldm_wire_image(11);
+
+    fwk_interrupt_enable_ExpectAndReturn(FAKE_UART_TX_IRQ, FWK_SUCCESS);
+    queued = mod_mctp_serial_tx_fn(NULL, wire, 40);
+    TEST_ASSERT_EQUAL(40, queued);
+
+    queued = mod_mctp_serial_tx_fn(NULL, &wire[40], 40);
+    TEST_ASSERT_EQUAL(-EBUSY, queued);
+
+    /* The event queue is full when the ring drains and the line is masked */
+    tx_event_status = FWK_E_NOMEM;
+    run_tx_isr_until_idle();
+    TEST_ASSERT_EQUAL(1, tx_event_calls);
+    TEST_ASSERT_TRUE(mctp_serial_ctx.tx_blocked);
+
+    /* The poll alarm asks for the resume again */
+    tx_event_status = FWK_SUCCESS;
+    poll_isr();
+    TEST_ASSERT_EQUAL(2, tx_event_calls);
+    TEST_ASSERT_FALSE(mctp_serial_ctx.tx_blocked);
+
+    /* Nothing is left to retry */
+    poll_isr();
+    TEST_ASSERT_EQUAL(2, tx_event_calls);
+}
+
+void test_mctp_serial_tx_frame_too_large(void)
+{
+    int queued;
+
+    set_config(&config_mctp_serial_irq_small_ring);
+    build_pldm_wire_image(9);
+
+    queued = mod_mctp_serial_tx_fn(NULL, wire, SMALL_TX_BUFFER_SIZE + 1);
+    TEST_ASSERT_EQUAL(-EMSGSIZE, queued);
+    TEST_ASSERT_EQUAL(1, mctp_serial_ctx.tx_dropped);
+    TEST_ASSERT_EQUAL(0, tx_trace_calls);
+    TEST_ASSERT_TRUE(fwk_ring_is_empty(&mctp_serial_ctx.tx_ring));
+    TEST_ASSERT_FALSE(mctp_serial_ctx.tx_blocked);
+}
+
+void test_mctp_serial_tx_drain_not_reentered(void)
+{
+    int queued;
+
+    set_config(&config_mctp_serial_poll);
+    build_pldm_wire_image(10);
+
+    /* Interrupt a context that is already feeding the UART */
+    mctp_serial_ctx.tx_draining = true;
+
+    queued = mod_mctp_serial_tx_fn(NULL, wire, 100);
+    TEST_ASSERT_EQUAL(100, queued);
+    poll_isr();
+    TEST_ASSERT_EQUAL(0, transmitted_len);
+
+    mctp_serial_ctx.tx_draining = false;
+
+    poll_isr();
+    TEST_ASSERT_EQUAL(UART_FIFO_DEPTH, transmitted_len);
+}
+
+void test_mctp_serial_tx_irq_drains_ring(void)
+{
+    int queued;
+    unsigned int frames;
+
+    set_config(&config_mctp_serial_irq);
+    build_pldm_wire_image(8);
+
+    for (frames = 0; frames < 3; frames++) {
+        fwk_interrupt_enable_ExpectAndReturn(FAKE_UART_TX_IRQ, FWK_SUCCESS);
+        queued = mod_mctp_serial_tx_fn(NULL, &wire[frames * 100], 100);
+        TEST_ASSERT_EQUAL(100, queued);
+    }
+
+    TEST_ASSERT_EQUAL(3, tx_trace_calls);
+
+    run_tx_isr_until_idle();
+
+    TEST_ASSERT_EQUAL(300, transmitted_len);
+    TEST_ASSERT_EQUAL_MEMORY(wire, transmitted, 300);
+}
+
+int mctp_serial_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_mctp_serial_rx_poll_burst);
+    RUN_TEST(test_mctp_serial_rx_irq_burst);
+    RUN_TEST(test_mctp_serial_rx_single_event_per_batch);
+    RUN_TEST(test_mctp_serial_rx_nothing_received);
+    RUN_TEST(test_mctp_serial_rx_ring_full_masks_irq);
+    RUN_TEST(test_mctp_serial_process_event_invalid);
+    RUN_TEST(test_mctp_serial_tx_poll_queues_frame);
+    RUN_TEST(test_mctp_serial_tx_ring_full_holds_back_frame);
+    RUN_TEST(test_mctp_serial_tx_irq_resume_retried_from_alarm);
+    RUN_TEST(test_mctp_serial_tx_frame_too_large);
+    RUN_TEST(test_mctp_serial_tx_drain_not_reentered);
+    RUN_TEST(test_mctp_serial_tx_irq_drains_ring);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return mctp_serial_test_main();
+}
+#endif
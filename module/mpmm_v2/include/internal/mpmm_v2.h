@@ -33,6 +33,9 @@ struct mpmm_reg {
 #define MPMM_MPMMCR_EN_POS    0
 #define MPMM_MPMMCR_GEAR_POS  1
 
+/* Number of gear updates between two reports of the gear changes */
+#define MPMM_V2_GEAR_LOG_INTERVAL 32
+
 struct mod_mpmm_v2_core_ctx {
     /* Core Identifier */
     fwk_id_t core_id;
@@ -90,6 +93,22 @@ struct mod_mpmm_v2_domain_ctx {
     /* Core context */
     struct mod_mpmm_v2_core_ctx core_ctx[MPMM_MAX_NUM_CORES_IN_DOMAIN];
 
+    /*
+     * Counters of all the cores, read in one batch. They are stored gear by
+     * gear: the counter of gear g for core c is at [(g * num_cores) + c].
+     */
+    uint64_t counters[MPMM_MAX_GEAR_COUNT * MPMM_MAX_NUM_CORES_IN_DOMAIN];
+
+    /* Cached counters of all the cores, in the same layout as counters */
+    uint64_t cached_counters
+        [MPMM_MAX_GEAR_COUNT * MPMM_MAX_NUM_CORES_IN_DOMAIN];
+
+    /* Gear changes since they were last reported */
+    uint32_t gear_change_count;
+
+    /* Gear updates left before the gear changes can be reported again */
+    uint32_t gear_log_countdown;
+
     /* Domain configuration */
     const struct mod_mpmm_v2_domain_config *domain_config;
 };
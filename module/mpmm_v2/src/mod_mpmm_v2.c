@@ -163,14 +163,28 @@ static void mpmm_v2_domain_set_gears(struct mod_mpmm_v2_domain_ctx *ctx)
     for (core_idx = 0; core_idx < ctx->num_cores; core_idx++) {
         core_ctx = &ctx->core_ctx[core_idx];
         if (core_ctx->online && core_ctx->needs_gear_update) {
-            FWK_LOG_INFO(
-                "domain %d: core %d: setting gear to %d\n",
-                ctx->domain_id.element.element_idx,
-                core_ctx->core_id.sub_element.sub_element_idx,
-                core_ctx->selected_gear & MPMM_MPMMCR_GEAR_MASK);
             mpmm_v2_core_set_gear(core_ctx);
+            ctx->gear_change_count++;
         }
     }
+
+    /*
+     * Gears may change every control period, so the changes are reported as
+     * a single summary at most once every MPMM_V2_GEAR_LOG_INTERVAL updates.
+     */
+    if (ctx->gear_log_countdown > 0) {
+        ctx->gear_log_countdown--;
+        return;
+    }
+
+    if (ctx->gear_change_count != 0) {
+        FWK_LOG_INFO(
+            "[MPMM_V2] domain %u: %u gear changes",
+            (unsigned int)ctx->domain_id.element.element_idx,
+            (unsigned int)ctx->gear_change_count);
+        ctx->gear_change_count = 0;
+        ctx->gear_log_countdown = MPMM_V2_GEAR_LOG_INTERVAL;
+    }
 }
 
 static void mpmm_v2_core_evaluate_gear(
@@ -200,6 +214,129 @@ static void mpmm_v2_core_evaluate_gear(
     return;
 }
 
+/*
+ * Compute the counter deltas and select the gear of every core of a domain in
+ * one pass over the counters.
+ *
+ * The loop has no branches, so the gear selection does not depend on the
+ * branch predictor and the compiler is free to vectorize it across cores.
+ * It gives the same result as mpmm_v2_core_counters_delta() followed by
+ * mpmm_v2_core_gear_policy() for each core. Only the cached counters of the
+ * cores with a mask of all ones are updated.
+ */
+static void mpmm_v2_domain_gear_kernel(
+    const uint64_t *counters,
+    uint64_t *cached_counters,
+    const uint64_t *masks,
+    uint32_t *gears,
+    uint32_t num_cores,
+    uint32_t num_of_gears,
+    uint64_t base_throtl_count)
+{
+    uint32_t core, gear, idx, selected_gear;
+    uint64_t sample, cached, delta;
+
+    for (core = 0; core < num_cores; core++) {
+        selected_gear = num_of_gears - 1;
+
+        /*
+         * Walk the gears from the least to the most aggressive one so that
+         * the core ends up with the lowest gear whose delta is below the
+         * threshold.
+         */
+        for (gear = num_of_gears; gear-- > 0;) {
+            idx = (gear * num_cores) + core;
+            sample = counters[idx];
+            cached = cached_counters[idx];
+
+            /* Same result as the counter wraparound case of the core path */
+            delta = (sample - cached) - (uint64_t)(sample < cached);
+
+            selected_gear = (delta <= base_throtl_count) ? gear : selected_gear;
+            cached_counters[idx] = cached ^ ((sample ^ cached) & masks[core]);
+        }
+
+        gears[core] = selected_gear;
+    }
+}
+
+/* Read the counters of all the cores at once and select their gears */
+static void mpmm_v2_domain_evaluate_gears(
+    struct mod_mpmm_v2_domain_ctx *domain_ctx)
+{
+    int status;
+    uint32_t core_idx;
+    uint32_t const num_of_gears = domain_ctx->domain_config->num_of_gears;
+    struct mod_mpmm_v2_core_ctx *core_ctx;
+    fwk_id_t counter_ids[MPMM_MAX_NUM_CORES_IN_DOMAIN];
+    uint64_t masks[MPMM_MAX_NUM_CORES_IN_DOMAIN];
+    uint32_t gears[MPMM_MAX_NUM_CORES_IN_DOMAIN];
+
+    for (core_idx = 0; core_idx < domain_ctx->num_cores; core_idx++) {
+        core_ctx = &domain_ctx->core_ctx[core_idx];
+
+        counter_ids[core_idx] = FWK_ID_NONE;
+        masks[core_idx] = 0;
+
+        if (!core_ctx->online) {
+            continue;
+        }
+
+        /* If counters are not enabled the core is left out */
+        if (!mpmm_v2_core_check_enabled(core_ctx)) {
+            core_ctx->selected_gear = num_of_gears;
+            continue;
+        }
+
+        counter_ids[core_idx] = core_ctx->base_aux_counter_id;
+        masks[core_idx] = UINT64_MAX;
+    }
+
+    status = mpmm_v2_ctx.amu_driver_api->get_counters_batch(
+        counter_ids,
+        domain_ctx->num_cores,
+        domain_ctx->counters,
+        num_of_gears);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG(
+            "[MPMM_V2] %s @%d: AMU counter read fail, error=%d",
+            __func__,
+            __LINE__,
+            status);
+
+        /* Keep the current gears */
+        for (core_idx = 0; core_idx < domain_ctx->num_cores; core_idx++) {
+            if (masks[core_idx] != 0) {
+                domain_ctx->core_ctx[core_idx].needs_gear_update = false;
+            }
+        }
+        return;
+    }
+
+    mpmm_v2_domain_gear_kernel(
+        domain_ctx->counters,
+        domain_ctx->cached_counters,
+        masks,
+        gears,
+        domain_ctx->num_cores,
+        num_of_gears,
+        domain_ctx->domain_config->base_throtl_count);
+
+    for (core_idx = 0; core_idx < domain_ctx->num_cores; core_idx++) {
+        if (masks[core_idx] == 0) {
+            continue;
+        }
+
+        core_ctx = &domain_ctx->core_ctx[core_idx];
+        if (gears[core_idx] != core_ctx->selected_gear) {
+            core_ctx->selected_gear = gears[core_idx];
+            core_ctx->needs_gear_update = true;
+        } else {
+            core_ctx->needs_gear_update = false;
+        }
+    }
+}
+
 static uint32_t mpmm_v2_evaluate_power_limit(
     struct mod_mpmm_v2_domain_ctx *domain_ctx)
 {
@@ -253,15 +390,20 @@ static void mpmm_v2_monitor_and_control(
         return;
     }
 
-    /* Core level algorithm */
-    for (core_idx = 0; core_idx < domain_ctx->num_cores; core_idx++) {
-        core_ctx = &domain_ctx->core_ctx[core_idx];
+    if (mpmm_v2_ctx.amu_driver_api->get_counters_batch != NULL) {
+        /* Domain level algorithm */
+        mpmm_v2_domain_evaluate_gears(domain_ctx);
+    } else {
+        /* Core level algorithm */
+        for (core_idx = 0; core_idx < domain_ctx->num_cores; core_idx++) {
+            core_ctx = &domain_ctx->core_ctx[core_idx];
 
-        if (!core_ctx->online) {
-            continue;
-        }
+            if (!core_ctx->online) {
+                continue;
+            }
 
-        mpmm_v2_core_evaluate_gear(domain_ctx, core_ctx);
+            mpmm_v2_core_evaluate_gear(domain_ctx, core_ctx);
+        }
     }
 
     /* Cache the last value */
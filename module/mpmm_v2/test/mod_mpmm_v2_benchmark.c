@@ -0,0 +1,241 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_notification.h>
+#include <Mockmod_mpmm_v2_extra.h>
+#include <config_mpmm_v2.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include UNIT_TEST_SRC
+
+/*
+ * Synthetic AMU counter banks, read through an offset table as amu_mmap does,
+ * for a domain with all cores in use.
+ */
+#define BANK_CORE_COUNT      MPMM_MAX_NUM_CORES_IN_DOMAIN
+#define BANK_GEAR_COUNT      4
+#define BANK_COUNTER_COUNT   (AMU_AUX0 + BANK_GEAR_COUNT)
+#define BANK_OFFLINE_CORE    2
+#define BANK_DISABLED_CORE   5
+#define BANK_THROTL_COUNT    1000
+#define BENCHMARK_ITERATIONS 20000
+
+static uint64_t bank[BANK_CORE_COUNT][BANK_COUNTER_COUNT];
+static uint32_t bank_offsets[BANK_COUNTER_COUNT];
+static uint64_t bank_cached_counters[BANK_CORE_COUNT][BANK_GEAR_COUNT];
+static uint64_t bank_delta[BANK_CORE_COUNT][BANK_GEAR_COUNT];
+static struct mpmm_reg bank_mpmm_reg[BANK_CORE_COUNT];
+static struct mod_mpmm_v2_domain_ctx bank_domain_ctx;
+static uint32_t bank_random_state;
+
+static struct amu_api bank_amu_api;
+
+static const struct mod_mpmm_v2_domain_config bank_dom_conf = {
+    .max_power = DEFAULT_MAX_POWER_LIMIT,
+    .min_power = DEFAULT_MIN_POWER_LIMIT,
+    .gear_weights = (uint32_t[]){ 100, 90, 75, 60 },
+    .base_throtl_count = BANK_THROTL_COUNT,
+    .num_of_gears = BANK_GEAR_COUNT,
+    .perf_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_PERF_CONTROLLER, 0),
+};
+
+static uint32_t bank_random(void)
+{
+    /* xorshift32 */
+    bank_random_state ^= bank_random_state << 13;
+    bank_random_state ^= bank_random_state >> 17;
+    bank_random_state ^= bank_random_state << 5;
+
+    return bank_random_state;
+}
+
+static uint64_t *bank_counter(fwk_id_t counter_id, size_t idx)
+{
+    unsigned int core_idx = counter_id.sub_element.element_idx;
+    unsigned int counter_idx = counter_id.sub_element.sub_element_idx + idx;
+
+    return (uint64_t *)((uintptr_t)bank[core_idx] + bank_offsets[counter_idx]);
+}
+
+static int bank_get_counters(
+    fwk_id_t start_counter_id,
+    uint64_t *counter_buff,
+    size_t num_counter)
+{
+    size_t i;
+
+    for (i = 0; i < num_counter; i++) {
+        counter_buff[i] = *bank_counter(start_counter_id, i);
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int bank_get_counters_batch(
+    const fwk_id_t *start_counter_ids,
+    size_t core_count,
+    uint64_t *counter_buff,
+    size_t num_counter)
+{
+    size_t core, i;
+
+    for (core = 0; core < core_count; core++) {
+        if (start_counter_ids[core].value == FWK_ID_NONE.value) {
+            continue;
+        }
+
+        for (i = 0; i < num_counter; i++) {
+            counter_buff[(i * core_count) + core] =
+                *bank_counter(start_counter_ids[core], i);
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+/* Advance every counter by up to twice the throttling threshold */
+static void bank_advance(void)
+{
+    unsigned int core, counter;
+
+    for (core = 0; core < BANK_CORE_COUNT; core++) {
+        for (counter = AMU_AUX0; counter < BANK_COUNTER_COUNT; counter++) {
+            bank[core][counter] += bank_random() % (2 * BANK_THROTL_COUNT);
+        }
+    }
+}
+
+static void bank_setup(void)
+{
+    unsigned int core, counter;
+    struct mod_mpmm_v2_core_ctx *core_ctx;
+
+    bank_random_state = 0x2545F491;
+
+    for (counter = 0; counter < BANK_COUNTER_COUNT; counter++) {
+        bank_offsets[counter] = counter * sizeof(uint64_t);
+    }
+
+    for (core = 0; core < BANK_CORE_COUNT; core++) {
+        for (counter = 0; counter < BANK_COUNTER_COUNT; counter++) {
+            bank[core][counter] = bank_random();
+        }
+
+        bank_mpmm_reg[core].MPMMCR =
+            (core == BANK_DISABLED_CORE) ? 0 : MPMM_MPMMCR_EN_MASK;
+    }
+
+    memset(bank_cached_counters, 0, sizeof(bank_cached_counters));
+    memset(bank_delta, 0, sizeof(bank_delta));
+
+    memset(&bank_domain_ctx, 0, sizeof(bank_domain_ctx));
+    bank_domain_ctx.domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_MPMM_V2, 0);
+    bank_domain_ctx.domain_config = &bank_dom_conf;
+    bank_domain_ctx.num_cores = BANK_CORE_COUNT;
+    bank_domain_ctx.num_cores_online = BANK_CORE_COUNT - 1;
+
+    for (core = 0; core < BANK_CORE_COUNT; core++) {
+        core_ctx = &bank_domain_ctx.core_ctx[core];
+        core_ctx->mpmm_v2 = &bank_mpmm_reg[core];
+        core_ctx->online = (core != BANK_OFFLINE_CORE);
+        core_ctx->base_aux_counter_id =
+            FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_AMU_MMAP, core, AMU_AUX0);
+        core_ctx->cached_counters = bank_cached_counters[core];
+        core_ctx->delta = bank_delta[core];
+        core_ctx->initialized = true;
+    }
+}
+
+void setUp(void)
+{
+    mpmm_v2_ctx.mpmm_v2_domain_count = 1;
+    mpmm_v2_ctx.domain_ctx = &bank_domain_ctx;
+    mpmm_v2_ctx.amu_driver_api = &bank_amu_api;
+    mpmm_v2_ctx.amu_driver_api_id =
+        FWK_ID_API(FWK_MODULE_IDX_AMU_MMAP, MOD_AMU_MMAP_API_IDX_AMU);
+
+    bank_amu_api.get_counters = bank_get_counters;
+    bank_setup();
+}
+
+void tearDown(void)
+{
+    mpmm_v2_ctx.mpmm_v2_domain_count = 0;
+    mpmm_v2_ctx.domain_ctx = NULL;
+    mpmm_v2_ctx.amu_driver_api = NULL;
+    mpmm_v2_ctx.amu_driver_api_id = FWK_ID_NONE;
+}
+
+/* Average cost of one monitoring round, in nanoseconds */
+static double monitor_and_control_cost(void)
+{
+    unsigned int iteration;
+    clock_t start;
+
+    /* Both paths see the same counter values */
+    bank_random_state = 0x2545F491;
+
+    start = clock();
+    for (iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        bank_advance();
+        mpmm_v2_monitor_and_control(&bank_domain_ctx);
+    }
+
+    return ((double)(clock() - start) * 1e9) /
+        ((double)CLOCKS_PER_SEC * BENCHMARK_ITERATIONS);
+}
+
+/*
+ * Compare reading the counters core by core with reading the counters of the
+ * whole domain through get_counters_batch.
+ */
+void benchmark_mpmm_v2_domain_evaluate_gears(void)
+{
+    double core_path_ns, domain_path_ns;
+
+    bank_amu_api.get_counters_batch = NULL;
+    core_path_ns = monitor_and_control_cost();
+
+    bank_amu_api.get_counters_batch = bank_get_counters_batch;
+    domain_path_ns = monitor_and_control_cost();
+
+    printf(
+        "mpmm_v2 gear evaluation, %d cores x %d gears: "
+        "per core %.0f ns, per domain %.0f ns\n",
+        BANK_CORE_COUNT,
+        BANK_GEAR_COUNT,
+        core_path_ns,
+        domain_path_ns);
+}
+
+int mpmm_v2_benchmark_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(benchmark_mpmm_v2_domain_evaluate_gears);
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return mpmm_v2_benchmark_main();
+}
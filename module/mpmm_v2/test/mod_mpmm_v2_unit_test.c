@@ -25,6 +25,8 @@
 #include <fwk_module_idx.h>
 #include <fwk_notification.h>
 
+#include <string.h>
+
 #include UNIT_TEST_SRC
 
 #define CLAMP_VAL(val, lo, hi) FWK_MIN((typeof(val))FWK_MAX(val, lo), hi)
@@ -60,6 +62,7 @@ void tearDown(void)
     mpmm_v2_ctx.domain_ctx = NULL;
     mpmm_v2_ctx.amu_driver_api = NULL;
     mpmm_v2_ctx.amu_driver_api_id = FWK_ID_NONE;
+    test_amu_api.get_counters_batch = NULL;
 }
 
 void utest_mpmm_v2_start_mod_id_success(void)
@@ -1202,6 +1205,250 @@ void utest_mpmm_v2_core_counters_delta_read_fail(void)
     TEST_ASSERT_EQUAL(UINT64_MAX, *core_ctx.delta);
 }
 
+/*
+ * Synthetic AMU counter banks, read through an offset table as amu_mmap does,
+ * for a domain with all cores in use.
+ */
+#define BANK_CORE_COUNT      MPMM_MAX_NUM_CORES_IN_DOMAIN
+#define BANK_GEAR_COUNT      4
+#define BANK_COUNTER_COUNT   (AMU_AUX0 + BANK_GEAR_COUNT)
+#define BANK_OFFLINE_CORE    2
+#define BANK_DISABLED_CORE   5
+#define BANK_THROTL_COUNT    1000
+#define EQUIVALENCE_ROUNDS   200
+
+static uint64_t bank[BANK_CORE_COUNT][BANK_COUNTER_COUNT];
+static uint32_t bank_offsets[BANK_COUNTER_COUNT];
+static uint64_t bank_cached_counters[BANK_CORE_COUNT][BANK_GEAR_COUNT];
+static uint64_t bank_delta[BANK_CORE_COUNT][BANK_GEAR_COUNT];
+static struct mpmm_reg bank_mpmm_reg[BANK_CORE_COUNT];
+static struct mod_mpmm_v2_domain_ctx bank_domain_ctx[2];
+static uint32_t bank_random_state;
+
+static const struct mod_mpmm_v2_domain_config bank_dom_conf = {
+    .max_power = DEFAULT_MAX_POWER_LIMIT,
+    .min_power = DEFAULT_MIN_POWER_LIMIT,
+    .gear_weights = (uint32_t[]){ 100, 90, 75, 60 },
+    .base_throtl_count = BANK_THROTL_COUNT,
+    .num_of_gears = BANK_GEAR_COUNT,
+    .perf_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_PERF_CONTROLLER, 0),
+};
+
+static uint32_t bank_random(void)
+{
+    /* xorshift32 */
+    bank_random_state ^= bank_random_state << 13;
+    bank_random_state ^= bank_random_state >> 17;
+    bank_random_state ^= bank_random_state << 5;
+
+    return bank_random_state;
+}
+
+static uint64_t *bank_counter(fwk_id_t counter_id, size_t idx)
+{
+    unsigned int core_idx = counter_id.sub_element.element_idx;
+    unsigned int counter_idx = counter_id.sub_element.sub_element_idx + idx;
+
+    return (uint64_t *)((uintptr_t)bank[core_idx] + bank_offsets[counter_idx]);
+}
+
+static int bank_get_counters(
+    fwk_id_t start_counter_id,
+    uint64_t *counter_buff,
+    size_t num_counter)
+{
+    size_t i;
+
+    for (i = 0; i < num_counter; i++) {
+        counter_buff[i] = *bank_counter(start_counter_id, i);
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int bank_get_counters_batch(
+    const fwk_id_t *start_counter_ids,
+    size_t core_count,
+    uint64_t *counter_buff,
+    size_t num_counter)
+{
+    size_t core, i;
+
+    for (core = 0; core < core_count; core++) {
+        if (start_counter_ids[core].value == FWK_ID_NONE.value) {
+            continue;
+        }
+
+        for (i = 0; i < num_counter; i++) {
+            counter_buff[(i * core_count) + core] =
+                *bank_counter(start_counter_ids[core], i);
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int bank_get_counters_batch_fail(
+    const fwk_id_t *start_counter_ids,
+    size_t core_count,
+    uint64_t *counter_buff,
+    size_t num_counter)
+{
+    return FWK_E_RANGE;
+}
+
+/* Advance every counter by up to twice the throttling threshold */
+static void bank_advance(void)
+{
+    unsigned int core, counter;
+
+    for (core = 0; core < BANK_CORE_COUNT; core++) {
+        for (counter = AMU_AUX0; counter < BANK_COUNTER_COUNT; counter++) {
+            bank[core][counter] += bank_random() % (2 * BANK_THROTL_COUNT);
+        }
+    }
+}
+
+static void bank_setup(void)
+{
+    unsigned int core, counter;
+
+    bank_random_state = 0x2545F491;
+
+    for (counter = 0; counter < BANK_COUNTER_COUNT; counter++) {
+        bank_offsets[counter] = counter * sizeof(uint64_t);
+    }
+
+    for (core = 0; core < BANK_CORE_COUNT; core++) {
+        for (counter = 0; counter < BANK_COUNTER_COUNT; counter++) {
+            /* Half of the cores wrap around during the first rounds */
+            bank[core][counter] = (core & 1) ?
+                (UINT64_MAX - (bank_random() % (4 * BANK_THROTL_COUNT))) :
+                bank_random();
+        }
+
+        bank_mpmm_reg[core].MPMMCR =
+            (core == BANK_DISABLED_CORE) ? 0 : MPMM_MPMMCR_EN_MASK;
+    }
+
+    memset(bank_cached_counters, 0, sizeof(bank_cached_counters));
+    memset(bank_delta, 0, sizeof(bank_delta));
+}
+
+static void bank_domain_setup(struct mod_mpmm_v2_domain_ctx *domain_ctx)
+{
+    unsigned int core;
+    struct mod_mpmm_v2_core_ctx *core_ctx;
+
+    memset(domain_ctx, 0, sizeof(*domain_ctx));
+    domain_ctx->domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_MPMM_V2, 0);
+    domain_ctx->domain_config = &bank_dom_conf;
+    domain_ctx->num_cores = BANK_CORE_COUNT;
+    domain_ctx->num_cores_online = BANK_CORE_COUNT - 1;
+
+    for (core = 0; core < BANK_CORE_COUNT; core++) {
+        core_ctx = &domain_ctx->core_ctx[core];
+        core_ctx->mpmm_v2 = &bank_mpmm_reg[core];
+        core_ctx->online = (core != BANK_OFFLINE_CORE);
+        core_ctx->base_aux_counter_id =
+            FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_AMU_MMAP, core, AMU_AUX0);
+        core_ctx->cached_counters = bank_cached_counters[core];
+        core_ctx->delta = bank_delta[core];
+        core_ctx->initialized = true;
+    }
+}
+
+void utest_mpmm_v2_domain_evaluate_gears_matches_core_path(void)
+{
+    unsigned int round, core, gear;
+    struct mod_mpmm_v2_domain_ctx *core_path = &bank_domain_ctx[0];
+    struct mod_mpmm_v2_domain_ctx *domain_path = &bank_domain_ctx[1];
+
+    bank_setup();
+    bank_domain_setup(core_path);
+    bank_domain_setup(domain_path);
+    test_amu_api.get_counters = bank_get_counters;
+
+    for (round = 0; round < EQUIVALENCE_ROUNDS; round++) {
+        bank_advance();
+
+        test_amu_api.get_counters_batch = NULL;
+        mpmm_v2_monitor_and_control(core_path);
+
+        test_amu_api.get_counters_batch = bank_get_counters_batch;
+        mpmm_v2_monitor_and_control(domain_path);
+
+        for (core = 0; core < BANK_CORE_COUNT; core++) {
+            TEST_ASSERT_EQUAL(
+                core_path->core_ctx[core].selected_gear,
+                domain_path->core_ctx[core].selected_gear);
+            TEST_ASSERT_EQUAL(
+                core_path->core_ctx[core].needs_gear_update,
+                domain_path->core_ctx[core].needs_gear_update);
+
+            for (gear = 0; gear < BANK_GEAR_COUNT; gear++) {
+                TEST_ASSERT_EQUAL_UINT64(
+                    bank_cached_counters[core][gear],
+                    domain_path
+                        ->cached_counters[(gear * BANK_CORE_COUNT) + core]);
+            }
+        }
+
+        TEST_ASSERT_EQUAL(core_path->power_limit, domain_path->power_limit);
+    }
+
+    TEST_ASSERT_EQUAL(
+        BANK_GEAR_COUNT,
+        domain_path->core_ctx[BANK_DISABLED_CORE].selected_gear);
+}
+
+void utest_mpmm_v2_domain_evaluate_gears_read_fail(void)
+{
+    struct mod_mpmm_v2_domain_ctx *domain_ctx = &bank_domain_ctx[0];
+
+    bank_setup();
+    bank_domain_setup(domain_ctx);
+    domain_ctx->core_ctx[0].selected_gear = 1;
+    domain_ctx->core_ctx[0].needs_gear_update = true;
+    domain_ctx->cached_counters[0] = UINT64_MAX;
+
+    test_amu_api.get_counters_batch = bank_get_counters_batch_fail;
+    mpmm_v2_domain_evaluate_gears(domain_ctx);
+
+    /* The gear and the cached counters are left as they were */
+    TEST_ASSERT_EQUAL(1, domain_ctx->core_ctx[0].selected_gear);
+    TEST_ASSERT_FALSE(domain_ctx->core_ctx[0].needs_gear_update);
+    TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, domain_ctx->cached_counters[0]);
+}
+
+void utest_mpmm_v2_domain_set_gears_log_rate_limited(void)
+{
+    unsigned int update;
+    struct mod_mpmm_v2_domain_ctx *domain_ctx = &bank_domain_ctx[0];
+
+    bank_setup();
+    bank_domain_setup(domain_ctx);
+    domain_ctx->core_ctx[0].needs_gear_update = true;
+    domain_ctx->core_ctx[1].needs_gear_update = true;
+
+    /* The first changes are reported straight away */
+    mpmm_v2_domain_set_gears(domain_ctx);
+    TEST_ASSERT_EQUAL(0, domain_ctx->gear_change_count);
+    TEST_ASSERT_EQUAL(
+        MPMM_V2_GEAR_LOG_INTERVAL, domain_ctx->gear_log_countdown);
+
+    /* The next ones are accumulated until the interval has elapsed */
+    for (update = 0; update < MPMM_V2_GEAR_LOG_INTERVAL; update++) {
+        mpmm_v2_domain_set_gears(domain_ctx);
+        TEST_ASSERT_EQUAL(2 * (update + 1), domain_ctx->gear_change_count);
+    }
+
+    mpmm_v2_domain_set_gears(domain_ctx);
+    TEST_ASSERT_EQUAL(0, domain_ctx->gear_change_count);
+    TEST_ASSERT_EQUAL(
+        MPMM_V2_GEAR_LOG_INTERVAL, domain_ctx->gear_log_countdown);
+}
+
 int mod_mpmm_v2_test_main(void)
 {
     UNITY_BEGIN();
@@ -1272,6 +1519,10 @@ int mod_mpmm_v2_test_main(void)
     RUN_TEST(utest_mpmm_v2_core_counters_delta_wraparound);
     RUN_TEST(utest_mpmm_v2_core_counters_delta_read_fail);
 
+    RUN_TEST(utest_mpmm_v2_domain_evaluate_gears_matches_core_path);
+    RUN_TEST(utest_mpmm_v2_domain_evaluate_gears_read_fail);
+    RUN_TEST(utest_mpmm_v2_domain_set_gears_log_rate_limited);
+
     return UNITY_END();
 }
 
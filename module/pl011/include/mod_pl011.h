@@ -11,6 +11,7 @@
 
 #include <fwk_id.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*!
@@ -45,6 +46,25 @@ struct mod_pl011_element_cfg {
      */
     uint64_t clock_rate_hz;
 
+    /*!
+     * \brief Enable the receive and receive timeout interrupts.
+     *
+     * \details When set, the device raises its interrupt once the receive FIFO
+     *      is half full, or when it holds data and the line has been idle for
+     *      32 bit periods. Both conditions are cleared by reading the FIFO
+     *      empty through the stream interface.
+     */
+    bool rx_interrupt_enable;
+
+    /*!
+     * \brief Enable the transmit interrupt.
+     *
+     * \details When set, the device raises its interrupt once the transmit
+     *      FIFO drains to half full. The condition is cleared by writing data
+     *      to the FIFO through the stream interface.
+     */
+    bool tx_interrupt_enable;
+
 #ifdef BUILD_HAS_MOD_CLOCK
     /*!
      * \brief Identifier of the clock that this device depends on.
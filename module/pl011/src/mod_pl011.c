@@ -205,6 +205,20 @@ static void mod_pl011_enable(fwk_id_t id)
     reg->ECR = PL011_ECR_CLR;
     reg->LCR_H = PL011_LCR_H_WLEN_8BITS | PL011_LCR_H_FEN;
     reg->CR = PL011_CR_UARTEN | PL011_CR_RXE | PL011_CR_TXE;
+
+    if (cfg->rx_interrupt_enable) {
+        reg->IFLS = (uint16_t)(reg->IFLS & ~PL011_IFLS_RXIFLSEL) |
+            PL011_IFLS_RXIFLSEL_1_2;
+        reg->ICR = PL011_ICR_RXIC | PL011_ICR_RTIC;
+        reg->IMSC |= PL011_IMSC_RXIM | PL011_IMSC_RTIM;
+    }
+
+    if (cfg->tx_interrupt_enable) {
+        reg->IFLS = (uint16_t)(reg->IFLS & ~PL011_IFLS_TXIFLSEL) |
+            PL011_IFLS_TXIFLSEL_1_2;
+        reg->ICR = PL011_ICR_TXIC;
+        reg->IMSC |= PL011_IMSC_TXIM;
+    }
 }
 
 static bool mod_pl011_putch(fwk_id_t id, char ch)
@@ -248,6 +262,54 @@ static bool mod_pl011_getch(fwk_id_t id, char *ch)
     return true;
 }
 
+static size_t mod_pl011_write(fwk_id_t id, const char *buffer, size_t size)
+{
+    const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(id)];
+
+    struct pl011_reg *reg = (void *)cfg->reg_base;
+    size_t written;
+
+    fwk_assert(ctx->powered);
+    fwk_assert(ctx->clocked);
+
+    /* Fill the transmit FIFO until it is full or the block is exhausted */
+    for (written = 0; written < size; written++) {
+        if ((reg->FR & PL011_FR_TXFF) > 0) {
+            break;
+        }
+
+        reg->DR = (uint16_t)buffer[written];
+    }
+
+    return written;
+}
+
+static size_t mod_pl011_read(fwk_id_t id, char *buffer, size_t size)
+{
+    const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(id)];
+
+    struct pl011_reg *reg = (void *)cfg->reg_base;
+    size_t read;
+
+    fwk_assert(ctx->powered);
+    fwk_assert(ctx->clocked);
+
+    /* Drain the receive FIFO until it is empty or the block is full */
+    for (read = 0; read < size; read++) {
+        if (reg->FR & PL011_FR_RXFE) {
+            break;
+        }
+
+        buffer[read] = (char)reg->DR;
+    }
+
+    return read;
+}
+
 static void mod_pl011_flush(fwk_id_t id)
 {
     const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
@@ -720,6 +782,52 @@ static int io_putch_initalised(const struct fwk_io_stream *stream, char ch)
     return FWK_SUCCESS;
 }
 
+static int io_read_initalised(
+    const struct fwk_io_stream *stream,
+    char *buffer,
+    size_t size,
+    size_t *read)
+{
+    const struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(stream->id)];
+
+    fwk_assert(ctx->open);
+
+    if (!ctx->powered || !ctx->clocked) {
+        return FWK_E_PWRSTATE;
+    }
+
+    *read = mod_pl011_read(stream->id, buffer, size);
+    if (*read == 0) {
+        return FWK_PENDING;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int io_write_initalised(
+    const struct fwk_io_stream *stream,
+    const char *buffer,
+    size_t size,
+    size_t *written)
+{
+    const struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(stream->id)];
+
+    fwk_assert(ctx->open);
+
+    if (!ctx->powered || !ctx->clocked) {
+        return FWK_E_PWRSTATE;
+    }
+
+    *written = mod_pl011_write(stream->id, buffer, size);
+    if (*written == 0) {
+        return FWK_E_BUSY;
+    }
+
+    return FWK_SUCCESS;
+}
+
 struct fwk_module module_pl011 = {
     .type = FWK_MODULE_TYPE_DRIVER,
 
@@ -743,4 +851,6 @@ static void update_adapter_pointers(void)
     /* Now the module is properly initalised, point at genuine putch/getch */
     module_pl011.adapter.getch = io_getch_initalised;
     module_pl011.adapter.putch = io_putch_initalised;
+    module_pl011.adapter.read = io_read_initalised;
+    module_pl011.adapter.write = io_write_initalised;
 }
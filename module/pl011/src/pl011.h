@@ -106,6 +106,9 @@ struct pl011_reg {
 #define PL011_IFLS_TXIFLSEL (uint16_t)0x0007
 #define PL011_IFLS_RXIFLSEL (uint16_t)0x0038
 
+#define PL011_IFLS_TXIFLSEL_1_2 (uint16_t)0x0002
+#define PL011_IFLS_RXIFLSEL_1_2 (uint16_t)0x0010
+
 #define PL011_IMSC_RIMIM  (uint16_t)0x0001
 #define PL011_IMSC_CTSMIM (uint16_t)0x0002
 #define PL011_IMSC_DCDMIM (uint16_t)0x0004
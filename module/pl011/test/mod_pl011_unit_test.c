@@ -23,6 +23,12 @@
 struct fwk_io_stream stream;
 struct mod_pl011_element_cfg *cfg_ut;
 
+/* The flag register is read-only for the driver */
+static void set_flags(uint16_t flags)
+{
+    *(uint16_t *)&mod_reg.FR = flags;
+}
+
 void setUp(void)
 {
     memset(&pl011_ctx, 0, sizeof(pl011_ctx));
@@ -347,6 +353,77 @@ void test_mod_pl011_io_getch(void)
     TEST_ASSERT_EQUAL(ch, 64);
 }
 
+void test_mod_pl011_io_write(void)
+{
+    int status;
+    size_t written;
+    const char buffer[] = { 'a', 'b', 'c' };
+
+    update_adapter_pointers();
+
+    pl011_ctx.elements[0].open = true;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status = module_pl011.adapter.write(
+        &stream, buffer, sizeof(buffer), &written);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(buffer), written);
+    TEST_ASSERT_EQUAL('c', mod_reg.DR);
+
+    /* Nothing is written while the transmit FIFO is full */
+    set_flags(PL011_FR_TXFF);
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status = module_pl011.adapter.write(
+        &stream, buffer, sizeof(buffer), &written);
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+    TEST_ASSERT_EQUAL(0, written);
+
+    set_flags(0);
+}
+
+void test_mod_pl011_io_read(void)
+{
+    int status;
+    size_t read;
+    char buffer[3] = { 0 };
+
+    update_adapter_pointers();
+
+    pl011_ctx.elements[0].open = true;
+    mod_reg.DR = 64;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status =
+        module_pl011.adapter.read(&stream, buffer, sizeof(buffer), &read);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(buffer), read);
+    TEST_ASSERT_EQUAL(64, buffer[2]);
+
+    /* Nothing is read while the receive FIFO is empty */
+    set_flags(PL011_FR_RXFE);
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status =
+        module_pl011.adapter.read(&stream, buffer, sizeof(buffer), &read);
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    TEST_ASSERT_EQUAL(0, read);
+
+    set_flags(0);
+}
+
 void test_mod_pl011_flush(void)
 {
     fwk_id_t id;
@@ -401,6 +478,8 @@ int pl011_test_main(void)
     RUN_TEST(test_mod_pl011_io_open_support);
     RUN_TEST(test_mod_pl011_io_open_success);
     RUN_TEST(test_mod_pl011_io_getch);
+    RUN_TEST(test_mod_pl011_io_write);
+    RUN_TEST(test_mod_pl011_io_read);
     RUN_TEST(test_mod_pl011_flush);
     RUN_TEST(test_init_element_ctx_table_fail);
     RUN_TEST(test_init_element_ctx_table);
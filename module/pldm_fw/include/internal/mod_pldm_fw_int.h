@@ -15,6 +15,8 @@
 #include <mod_pldm_fw.h>
 
 #include <fwk_assert.h>
+#include <fwk_event.h>
+#include <fwk_time.h>
 
 /*
  * pldm_fw uses quite a bit of memory allocations throughout its lifecycle. This
@@ -22,26 +24,71 @@
  */
 #define MM_ASSERT(x) assert(NULL != x)
 
-#define PLDM_MAX_PDR 5U
+/*
+ * size of the per-bus buffer responses to incoming requests are encoded into,
+ * not including the headroom reserved for the mctp layer
+ */
+#define PLDM_FW_RESP_ARENA_SIZE 512
+
+/*
+ * largest slice of a pdr carried by one GetPDR response. The fixed response
+ * fields and the transfer crc must fit in the response arena alongside it.
+ */
+#define PLDM_FW_PDR_XFER_SIZE \
+    (PLDM_FW_RESP_ARENA_SIZE - sizeof(struct pldm_msg_hdr) - \
+     PLDM_GET_PDR_MIN_RESP_BYTES - 1)
 
-#define EVENT_MAX_SIZE        256
-#define EVENT_QUEUE_SIZE      5
 #define EVENT_MAX_BUFFER_SIZE 32
 
-/* Platform Event Message Data */
-struct event {
-    uint32_t size;
+/* size of the event queue arena when the module is not given a config */
+#define PLDM_FW_EVENT_QUEUE_DEFAULT_SIZE 1024
+
+/* Platform Event Message Data, followed in the event queue by its data */
+struct pldm_event {
+    uint16_t size;
     uint16_t id;
     uint8_t class;
+    /* set once the producer has finished writing the event */
+    volatile uint8_t ready;
     uint32_t checksum;
-    uint8_t data[EVENT_MAX_SIZE];
+    fwk_timestamp_t timestamp;
+    uint8_t data[];
 };
 
+/*
+ * events are stored back to back in one arena, oldest first, so they can be
+ * transferred straight from the queue. An event that does not fit before the
+ * end of the arena starts back at offset 0, and wrap marks where the events
+ * stored before it end. Producers may run in interrupt context. Events are
+ * consumed either by the PollForPlatformEventMessage handler or, once the
+ * event receiver enabled asynchronous events, by the push of the oldest event.
+ */
 struct pldm_event_queue {
-    int head;
-    int tail;
-    int length;
-    struct event events[EVENT_QUEUE_SIZE];
+    uint8_t *arena;
+    uint32_t capacity;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t wrap;
+    uint32_t length;
+    uint16_t next_id;
+    /* event being transferred to the event receiver, until acknowledged */
+    struct pldm_event *in_flight;
+
+    /* events discarded to make room for newer ones */
+    uint32_t dropped_oldest;
+    /* events discarded because no room could be made for them */
+    uint32_t dropped;
+    uint32_t peak_length;
+};
+
+/* snapshot of the event queue state */
+struct pldm_event_queue_stats {
+    uint32_t length;
+    uint32_t peak_length;
+    uint32_t dropped_oldest;
+    uint32_t dropped;
+    /* time spent in the queue by the oldest event */
+    fwk_duration_ns_t oldest_age;
 };
 
 struct _pldm_cper_event_data_firmware_error_record_reference {
@@ -78,12 +125,17 @@ typedef struct _pldm_event_data_numeric_sensor_state_uint8
 typedef struct _pldm_event_data_state_sensor_state
     pldm_event_data_state_sensor_state;
 
-/* each pdr would be represented by a pointer to hold the base address and a
- * size_t object to hold the size of that pdr */
-typedef struct pdr {
-    uint8_t *p;
-    size_t sz;
-} pdr_t;
+/*
+ * each pdr is represented by its record handle, its offset and size within the
+ * serialised pdr blob and the crc8 of its data, sent along with the last part
+ * of a multi-part transfer.
+ */
+typedef struct pdr_index {
+    uint32_t record_handle;
+    uint32_t offset;
+    uint16_t size;
+    uint8_t crc;
+} pdr_index_t;
 
 /* representation of a pldm pdr object */
 typedef struct pdr_info {
@@ -94,12 +146,20 @@ typedef struct pdr_info {
      * should not be accessed. For safety it is recommended that the owner of
      * such an object should set this pointer to zero */
     pldm_pdr_t *repo;
-    /* index to keep track of pdr updates */
-    uint8_t idx;
-    /* an array of pdr elements pointers. For simplicity, the maximum pdrs have
-     * been limited to PLDM_MAX_PDR */
-    pdr_t pdr[PLDM_MAX_PDR];
-    /**/
+    /* pdr data stored back to back, in ascending record handle order */
+    uint8_t *blob;
+    size_t blob_size;
+    uint32_t blob_capacity;
+    /* one entry per pdr in the blob, sorted by record handle */
+    pdr_index_t *index;
+    uint32_t count;
+    uint32_t index_capacity;
+    /* requester side state of the GetPDR transfer in progress */
+    uint32_t xfer_record_hndl;
+    uint32_t xfer_data_transfer_hndl;
+    uint32_t xfer_offset;
+    uint8_t xfer_op_flag;
+    bool xfer_done;
 } pdr_info_t;
 
 /*
@@ -136,6 +196,8 @@ typedef struct receiver_ev_state {
     uint8_t receiver_addr;
     uint8_t heartbeat_timer;
     uint8_t transport_protocol_type;
+    /* mctp_fw bus the event receiver registered from */
+    uint32_t bus;
 } receiver_ev_state_t;
 
 /*
@@ -172,6 +234,12 @@ void bmc_init();
  */
 void mcp_init(pldm_pdr_api_t *api);
 
+/*
+ * Serialises the pdr repository held by pdr_info into its handle indexed blob.
+ * Must be called once all the pdrs have been added to the repository.
+ */
+int pldm_fw_pdr_serialise(pdr_info_t *pdr_info, pldm_pdr_api_t *api);
+
 /*
  * Implements discovery state machine. Any terminus which needs to do a
  * discovery on one of the other terminus should invoke this function,
@@ -181,18 +249,80 @@ void pldm_fw_discovery(pldm_fw_terminus_ctx_t *ctx);
 /* Prints the ctx object onto the terminal */
 void pldm_fw_terminus_info(pldm_fw_terminus_ctx_t *ctx);
 
+/* allocates an event queue arena of the given size in bytes */
+int event_queue_init(size_t size);
+
+/*
+ * Queues a copy of an event. The oldest events are discarded when there is no
+ * room left for it. Can be called from interrupt context.
+ */
 int event_queue_put(
-    uint8_t *event_data,
+    const uint8_t *event_data,
     uint32_t event_size,
     uint8_t event_class,
     uint32_t checksum);
 
-int event_queue_get(
-    uint8_t *event_data,
-    uint32_t *event_size,
-    uint16_t *event_id,
-    uint8_t *event_class,
-    uint32_t *checksum);
+/*
+ * Returns the oldest event, which stays in the queue and is not discarded
+ * until acknowledged, or NULL if the queue is empty.
+ */
+const struct pldm_event *event_queue_get(void);
+
+/* Removes the event returned by event_queue_get() if its id matches */
+int event_queue_ack(uint16_t event_id);
+
+/*
+ * Returns true if a newer sensor event reporting on the same sensor follows
+ * the event in the queue, which makes the event stale.
+ */
+bool event_queue_is_superseded(const struct pldm_event *event);
+
+/* Returns the number of events in the queue */
+uint32_t event_queue_length(void);
+
+void event_queue_get_stats(struct pldm_event_queue_stats *stats);
+
+/* cached reading of a sensor served to the event receiver */
+struct pldm_fw_sensor_reading {
+    int32_t value;
+    /* enum pldm_sensor_operational_state */
+    uint8_t op_state;
+    /* enum pldm_sensor_present_state */
+    uint8_t present_state;
+    uint8_t previous_state;
+};
+
+/* allocates the reading cache of the sensors listed in the configuration */
+int pldm_fw_sensor_init(const pldm_fw_config_t *config);
+
+/* binds to the sensor api and to the alarm refreshing the cache */
+int pldm_fw_sensor_bind(void);
+
+/*
+ * Collects the sensor information the pdrs are generated from and starts the
+ * refresh alarm.
+ */
+int pldm_fw_sensor_start(fwk_id_t module_id);
+
+/* reads the sensors whose update interval has elapsed since the last read */
+void pldm_fw_sensor_refresh(void);
+
+/*
+ * Stores a reading completed asynchronously by the sensor module. Returns false
+ * if the event is not a sensor reading response.
+ */
+bool pldm_fw_sensor_read_complete(const struct fwk_event *event);
+
+/* Returns the cached reading of a numeric sensor, NULL if it is unknown */
+const struct pldm_fw_sensor_reading *pldm_fw_sensor_get_reading(
+    uint16_t pldm_sensor_id);
+
+/* Returns the cached reading behind a health state sensor */
+const struct pldm_fw_sensor_reading *pldm_fw_sensor_get_state_reading(
+    uint16_t pldm_state_sensor_id);
+
+/* adds the numeric and state sensor pdrs of the configured sensors to repo */
+void pldm_fw_sensor_add_pdrs(pldm_pdr_t *repo, pldm_pdr_api_t *api);
 
 int get_fru_record_table_size();
 const uint8_t *get_fru_record_table_data();
@@ -10,6 +10,9 @@
 
 #include <fwk_id.h>
 
+#include <stddef.h>
+#include <stdint.h>
+
 enum {
     PLDM_FW_BIND_BASE_API_IDX,
     PLDM_FW_BIND_MCTP_FW_API_IDX,
@@ -22,6 +25,8 @@ enum {
 
 enum mod_pldm_fw_event_idx {
     PLDM_FW_EVENT_IDX_PLDM_EVENT_MESSAGE,
+    PLDM_FW_EVENT_IDX_SENSOR_REFRESH,
+    PLDM_FW_EVENT_IDX_EVENT_PUSH,
     PLDM_FW_EVENT_IDX_COUNT,
 };
 
@@ -35,6 +40,77 @@ typedef struct pldm_fw_elem_config {
     fwk_id_t driver_api_id;
 } pldm_fw_elem_config_t;
 
+/*
+ * a sensor module element exposed to the event receiver as a pldm numeric
+ * sensor. Its pdrs are generated from the sensor information at start.
+ */
+typedef struct pldm_fw_sensor_config {
+    /* sensor module element the readings are taken from */
+    fwk_id_t sensor_id;
+    /* pldm sensor id, unique within the terminus */
+    uint16_t pldm_sensor_id;
+    /*
+     * pldm id of a health state sensor reporting whether readings are
+     * available, 0 if there is none
+     */
+    uint16_t pldm_state_sensor_id;
+    /* pldm entity (DSP0249) the sensor monitors */
+    uint16_t entity_type;
+    uint16_t entity_instance;
+} pldm_fw_sensor_config_t;
+
+/* pldm_fw module configuration */
+typedef struct pldm_fw_config {
+    /*
+     * size in bytes of the arena platform events are queued in until the event
+     * receiver polls for them. Each event takes its size plus a small header.
+     */
+    size_t event_queue_size;
+
+    /*
+     * alarm timing the pushes of platform events to the event receiver, once
+     * it enables asynchronous events with SetEventReceiver. Asynchronous events
+     * are refused when it is FWK_ID_NONE or the timer module is missing.
+     */
+    fwk_id_t event_alarm_id;
+
+    /*
+     * time in milliseconds queued events are held for before being pushed, so
+     * that a burst is sent together and the sensor events superseded by a
+     * newer one are dropped. 0 pushes each event as soon as it is queued.
+     */
+    unsigned int event_coalesce_window_ms;
+
+    /*
+     * time in milliseconds a pushed event waits for its response before it is
+     * sent again. The wait doubles on every retry.
+     */
+    unsigned int event_retry_timeout_ms;
+
+    /*
+     * number of times an event is sent again before it is left in the queue
+     * for the event receiver to poll
+     */
+    unsigned int event_retry_count;
+
+    /*
+     * sensors served to the event receiver. Requests are answered from a
+     * per-sensor reading cache, which is refreshed in the background at each
+     * sensor update interval. Requires the sensor and timer modules.
+     */
+    const pldm_fw_sensor_config_t *sensors;
+    unsigned int sensor_count;
+
+    /* alarm ticking the refresh of the sensor reading cache */
+    fwk_id_t sensor_alarm_id;
+
+    /*
+     * period of the alarm in milliseconds, which bounds the update interval
+     * of the fastest sensor
+     */
+    unsigned int sensor_tick_ms;
+} pldm_fw_config_t;
+
 typedef struct pldm_fw_fw_api {
     void (*pldm_fw_receive_from_transport_layer)(
         void *data,
@@ -50,8 +50,15 @@ void bmc_init_ctx(pldm_fw_terminus_ctx_t *ctx)
      */
     ev_state->heartbeat_timer = 0;
 
+    /* Discovery requests go out on the first mctp_fw bus */
+    ev_state->bus = 0;
+
     ctx->pdr_info.pdr_owner = 0;
     ctx->pdr_info.repo = 0x0;
+
+    /* pdrs are fetched starting from the first one in the repository */
+    ctx->pdr_info.xfer_record_hndl = 0;
+    ctx->pdr_info.xfer_op_flag = PLDM_GET_FIRSTPART;
 }
 
 /*
@@ -10,8 +10,15 @@
 #include <mod_pldm.h>
 #include <mod_pldm_fw.h>
 
+#include <fwk_interrupt.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
+#include <fwk_status.h>
+#include <fwk_time.h>
+
+#include <stdbool.h>
+#include <string.h>
 
 #define MOD_NAME "[MCP]: "
 #define MCP_TID  0
@@ -104,79 +111,289 @@ const uint8_t *get_fru_record_table_data()
     return fru_record_table;
 }
 
+/* bytes taken in the arena by an event carrying size bytes of data */
+static uint32_t event_queue_slot_size(uint32_t size)
+{
+    return FWK_ALIGN_NEXT(
+        sizeof(struct pldm_event) + size, _Alignof(struct pldm_event));
+}
+
+/*
+ * finds room for a slot of the given size after the newest event. Must be
+ * called with interrupts disabled.
+ */
+static bool event_queue_reserve(
+    struct pldm_event_queue *queue,
+    uint32_t slot_size,
+    uint32_t *offset)
+{
+    if (queue->length == 0) {
+        queue->head = 0;
+        queue->tail = 0;
+        queue->wrap = queue->capacity;
+    }
+
+    if ((queue->length > 0) && (queue->tail <= queue->head)) {
+        /* wrapped, the free space lies between the newest and oldest events */
+        if (slot_size > (queue->head - queue->tail)) {
+            return false;
+        }
+        *offset = queue->tail;
+    } else if (slot_size <= (queue->capacity - queue->tail)) {
+        *offset = queue->tail;
+    } else if (slot_size <= queue->head) {
+        queue->wrap = queue->tail;
+        *offset = 0;
+    } else {
+        return false;
+    }
+
+    queue->tail = *offset + slot_size;
+
+    return true;
+}
+
+/* removes the oldest event. Must be called with interrupts disabled. */
+static void event_queue_pop(struct pldm_event_queue *queue)
+{
+    struct pldm_event *event;
+
+    event = (struct pldm_event *)&queue->arena[queue->head];
+    queue->head += event_queue_slot_size(event->size);
+    queue->length--;
+
+    if (queue->head >= queue->wrap) {
+        queue->head = 0;
+        queue->wrap = queue->capacity;
+    }
+}
+
+int event_queue_init(size_t size)
+{
+    struct pldm_event_queue *queue = &pldm_fw_mcp_ctx.event_queue;
+
+    if ((size < sizeof(struct pldm_event)) || (size > UINT32_MAX)) {
+        return FWK_E_PARAM;
+    }
+
+    queue->arena = fwk_mm_alloc_aligned(
+        _Alignof(struct pldm_event), size, sizeof(uint8_t));
+    queue->capacity = (uint32_t)size;
+    queue->wrap = queue->capacity;
+    queue->next_id = 1;
+
+    return FWK_SUCCESS;
+}
+
 int event_queue_put(
-    uint8_t *event_data,
+    const uint8_t *event_data,
     uint32_t event_size,
     uint8_t event_class,
     uint32_t checksum)
 {
-    static uint16_t event_id = 1;
     struct pldm_event_queue *queue = &pldm_fw_mcp_ctx.event_queue;
+    struct pldm_event *event;
+    struct pldm_event *oldest;
+    uint32_t slot_size;
+    uint32_t offset;
+    unsigned int flags;
+
+    if (event_size > UINT16_MAX) {
+        return FWK_E_PARAM;
+    }
 
-    if (event_size > EVENT_MAX_SIZE) {
-        return -1; // over max event size
+    slot_size = event_queue_slot_size(event_size);
+    if (slot_size > queue->capacity) {
+        return FWK_E_PARAM;
     }
 
-    if (queue->tail == queue->head && queue->length > 0) {
-        // queue is full
-        // DSP0248 13.4 PLDM event log clearing policies
-        // Policy: FIFO, when queue full, discard oldest event
-        queue->head = (queue->tail + 1) % EVENT_QUEUE_SIZE;
-        ;
-        FWK_LOG_INFO(MOD_NAME "event_queue_put 1");
-    } else {
-        FWK_LOG_INFO(MOD_NAME "event_queue_put 2");
-        queue->length++;
+    /* only the slot is claimed with interrupts disabled, not the copy */
+    flags = fwk_interrupt_global_disable();
+
+    while (!event_queue_reserve(queue, slot_size, &offset)) {
+        /*
+         * DSP0248 13.4 PLDM event log clearing policies
+         * Policy: FIFO, when queue full, discard oldest event. The event in
+         * flight and events still being written cannot be discarded.
+         */
+        oldest = (struct pldm_event *)&queue->arena[queue->head];
+        if ((queue->length == 0) || (oldest == queue->in_flight) ||
+            !oldest->ready) {
+            queue->dropped++;
+            fwk_interrupt_global_enable(flags);
+            return FWK_E_NOMEM;
+        }
+
+        event_queue_pop(queue);
+        queue->dropped_oldest++;
     }
-    queue->events[queue->tail].class = event_class;
-    queue->events[queue->tail].id = event_id;
-    queue->events[queue->tail].size = event_size;
-    queue->events[queue->tail].checksum = checksum;
-    memcpy(queue->events[queue->tail].data, event_data, event_size);
-    queue->tail = (queue->tail + 1) % EVENT_QUEUE_SIZE;
-
-    event_id++;
-    if (event_id == 0xffff) {
-        event_id = 1;
+
+    event = (struct pldm_event *)&queue->arena[offset];
+    event->ready = false;
+    event->size = (uint16_t)event_size;
+    event->id = queue->next_id;
+
+    /* 0x0000 and 0xffff are reserved event ids */
+    queue->next_id++;
+    if (queue->next_id == 0xffff) {
+        queue->next_id = 1;
     }
-    return 0;
+
+    queue->length++;
+    if (queue->length > queue->peak_length) {
+        queue->peak_length = queue->length;
+    }
+
+    fwk_interrupt_global_enable(flags);
+
+    event->class = event_class;
+    event->checksum = checksum;
+    event->timestamp = fwk_time_current();
+    memcpy(event->data, event_data, event_size);
+
+    /* publish the event only once all its fields are written */
+    __asm__ volatile("" ::: "memory");
+    event->ready = true;
+
+    return FWK_SUCCESS;
 }
 
-int event_queue_get(
-    uint8_t *event_data,
-    uint32_t *event_size,
-    uint16_t *event_id,
-    uint8_t *event_class,
-    uint32_t *checksum)
+const struct pldm_event *event_queue_get(void)
 {
     struct pldm_event_queue *queue = &pldm_fw_mcp_ctx.event_queue;
+    struct pldm_event *oldest;
+    unsigned int flags;
 
-    if (queue->length == 0) {
-        *event_id = 0;
-        *event_size = 0;
-        *event_class = 0;
-        *checksum = 0;
-        FWK_LOG_INFO(MOD_NAME "event_queue_get 1, empty queue");
-    } else {
-        *event_id = queue->events[queue->head].id;
-        *event_size = queue->events[queue->head].size;
-        *event_class = queue->events[queue->head].class;
-        *checksum = queue->events[queue->head].checksum;
-        memcpy(
-            event_data,
-            queue->events[queue->head].data,
-            queue->events[queue->head].size);
-        queue->head = (queue->head + 1) % EVENT_QUEUE_SIZE;
-        queue->length--;
-        FWK_LOG_INFO(
-            MOD_NAME
-            "event_queue_get id=0x%04x, size=%ld, class=0x%02x checksum=%08lx",
-            *event_id,
-            *event_size,
-            *event_class,
-            *checksum);
+    flags = fwk_interrupt_global_disable();
+
+    if ((queue->in_flight == NULL) && (queue->length > 0)) {
+        oldest = (struct pldm_event *)&queue->arena[queue->head];
+        if (oldest->ready) {
+            queue->in_flight = oldest;
+        }
     }
-    return 0;
+
+    fwk_interrupt_global_enable(flags);
+
+    return queue->in_flight;
+}
+
+int event_queue_ack(uint16_t event_id)
+{
+    struct pldm_event_queue *queue = &pldm_fw_mcp_ctx.event_queue;
+    unsigned int flags;
+    int status = FWK_E_PARAM;
+
+    flags = fwk_interrupt_global_disable();
+
+    /* the event in flight is never discarded, so it is still the oldest */
+    if ((queue->in_flight != NULL) && (queue->in_flight->id == event_id)) {
+        queue->in_flight = NULL;
+        event_queue_pop(queue);
+        status = FWK_SUCCESS;
+    }
+
+    fwk_interrupt_global_enable(flags);
+
+    return status;
+}
+
+/*
+ * number of leading bytes identifying the sensor a sensor event reports on:
+ * the sensor id and the sensor event class, plus the sensor offset for the
+ * state sensors. Returns 0 for the events that are never superseded.
+ */
+static uint32_t event_queue_sensor_key_size(const struct pldm_event *event)
+{
+    uint32_t key_size;
+
+    if ((event->class != PLDM_SENSOR_EVENT) || (event->size < 3)) {
+        return 0;
+    }
+
+    key_size = (event->data[2] == PLDM_STATE_SENSOR_STATE) ? 4 : 3;
+
+    return (key_size <= event->size) ? key_size : 0;
+}
+
+bool event_queue_is_superseded(const struct pldm_event *event)
+{
+    struct pldm_event_queue *queue = &pldm_fw_mcp_ctx.event_queue;
+    const struct pldm_event *later;
+    uint32_t key_size;
+    uint32_t offset;
+    uint32_t i;
+    unsigned int flags;
+    bool after = false;
+    bool superseded = false;
+
+    key_size = event_queue_sensor_key_size(event);
+    if (key_size == 0) {
+        return false;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    offset = queue->head;
+    for (i = 0; (i < queue->length) && !superseded; i++) {
+        later = (const struct pldm_event *)&queue->arena[offset];
+
+        if (after && later->ready && (later->class == event->class) &&
+            (event_queue_sensor_key_size(later) == key_size)) {
+            superseded = (memcmp(later->data, event->data, key_size) == 0);
+        }
+        if (later == event) {
+            after = true;
+        }
+
+        offset += event_queue_slot_size(later->size);
+        if (offset >= queue->wrap) {
+            offset = 0;
+        }
+    }
+
+    fwk_interrupt_global_enable(flags);
+
+    return superseded;
+}
+
+uint32_t event_queue_length(void)
+{
+    return pldm_fw_mcp_ctx.event_queue.length;
+}
+
+void event_queue_get_stats(struct pldm_event_queue_stats *stats)
+{
+    struct pldm_event_queue *queue = &pldm_fw_mcp_ctx.event_queue;
+    const struct pldm_event *oldest;
+    fwk_timestamp_t timestamp = 0;
+    bool timestamped = false;
+    unsigned int flags;
+
+    flags = fwk_interrupt_global_disable();
+
+    stats->length = queue->length;
+    stats->peak_length = queue->peak_length;
+    stats->dropped_oldest = queue->dropped_oldest;
+    stats->dropped = queue->dropped;
+
+    /*
+     * The timestamp of an event still being written is not valid yet; such an
+     * event was only just reserved, so its age is reported as 0.
+     */
+    if (queue->length > 0) {
+        oldest = (const struct pldm_event *)&queue->arena[queue->head];
+        if (oldest->ready) {
+            timestamp = oldest->timestamp;
+            timestamped = true;
+        }
+    }
+
+    fwk_interrupt_global_enable(flags);
+
+    stats->oldest_age = timestamped ?
+        fwk_time_stamp_duration(fwk_time_current() - timestamp) :
+        0;
 }
 
 /*
@@ -249,117 +466,6 @@ void mcp_set_ctx(pldm_fw_terminus_ctx_t *ctx)
  * this function would initialize pldm pdr objects and add them to pdr
  * repository.
  */
-void init_pldm_state_sensor_pdr(pldm_state_sensor_pdr_t *pdr)
-{
-    pdr->hdr.record_handle = 0x01;
-    pdr->hdr.version = 0x01;
-    pdr->hdr.type = PLDM_STATE_SENSOR_PDR;
-    pdr->hdr.record_change_num = 0x0;
-    pdr->hdr.length =
-        sizeof(pldm_state_sensor_pdr_t) - sizeof(struct pldm_pdr_hdr);
-
-    pdr->terminus_handle = 0x0;
-    pdr->sensor_id = 0x01;
-    pdr->entity_type = 0x07;
-    pdr->entity_instance = 0x0;
-    pdr->container_id = 0x0;
-    pdr->sensor_init = 0x0;
-    pdr->sensor_auxiliary_names_pdr = false;
-    pdr->composite_sensor_count = 0x1;
-    pdr->possible_states[0] = PLDM_STATE_SET_HEALTH_STATE & 0xFF;
-    pdr->possible_states[1] = (PLDM_STATE_SET_HEALTH_STATE >> 8) & 0xFF;
-    pdr->possible_states[2] = 0x01;
-    pdr->possible_states[3] = 0x0f;
-}
-
-void init_pldm_numeric_sensor_pdr(pldm_numeric_sensor_pdr_t *pdr)
-{
-    /* setup pdr object with dummy values */
-    pdr->hdr.record_handle = 0x01;
-    pdr->hdr.version = 0x01;
-    pdr->hdr.type = PLDM_NUMERIC_SENSOR_PDR;
-    pdr->hdr.record_change_num = 0x0;
-    pdr->hdr.length =
-        sizeof(pldm_numeric_sensor_pdr_t) - sizeof(struct pldm_pdr_hdr);
-
-    pdr->terminus_handle = 0x1;
-    pdr->sensor_id = 0x01;
-    pdr->entity_type = 0x07;
-    pdr->entity_instance = 0x0;
-    pdr->container_id = 0x0;
-    pdr->sensor_init = 0x0; // noInit
-    pdr->sensor_auxiliary_names_pdr = true;
-    pdr->base_unit = 2; // Degress c
-    pdr->uint_modifier = 0;
-    pdr->rate_unit = 0;
-    pdr->aux_unit = 0;
-    pdr->is_linear = true;
-    pdr->sensor_data_size = PLDM_SENSOR_DATA_SIZE_UINT8;
-    pdr->resolution = 1; // m
-    pdr->offset = 0; // B
-    pdr->accuracy = 100; // +- 1.00%
-    pdr->plus_tolerance = 0;
-    pdr->minus_tolerance = 0;
-    pdr->hysteresis = 0; // not use hysteresis
-    pdr->supported_thresholds = 0x0;
-    pdr->threshold_and_hysteresis_volatility = 0x1f;
-    pdr->state_transition_interval = 5;
-    pdr->update_interval = 50;
-    pdr->max_readable = 255;
-    pdr->min_readable = 0;
-    pdr->range_field_format = PLDM_SENSOR_DATA_SIZE_UINT8;
-    pdr->range_field_support = 0x78;
-    pdr->nominal_value = 0;
-    pdr->normal_max = 0;
-    pdr->normal_min = 0;
-    pdr->warning_high = 90;
-    pdr->warning_low = 5;
-    pdr->critical_high = 100;
-    pdr->critical_low = 0;
-    pdr->fatal_high = 0;
-    pdr->fatal_low = 0;
-}
-
-void init_pldm_sensor_auxiliary_names_pdr(
-    pldm_sensor_auxiliary_names_pdr_t **aux_pdr,
-    uint32_t *pdr_size)
-{
-    pldm_sensor_auxiliary_names_pdr_t *pdr;
-    unsigned char tag[3] = { 'e', 'n', 0x0 }; // en
-    unsigned char aux_name[18] = {
-        0x0, 'C', 0x0, 'o', 0x0, 'r', 0x0, 'e', 0x0,
-        'T', 0x0, 'e', 0x0, 'm', 0x0, 'p', 0x0, 0x0
-    }; // CoreTemp
-    int idx = 0;
-
-    pdr = (pldm_sensor_auxiliary_names_pdr_t *)fwk_mm_calloc(
-        1,
-        sizeof(pldm_sensor_auxiliary_names_pdr_t) + sizeof(tag) +
-            sizeof(aux_name));
-
-    pdr->hdr.record_handle = 0x02;
-    pdr->hdr.version = 0x01;
-    pdr->hdr.type = PLDM_SENSOR_AUXILIARY_NAMES_PDR;
-    pdr->hdr.record_change_num = 0x0;
-    pdr->hdr.length = sizeof(pldm_sensor_auxiliary_names_pdr_t) + sizeof(tag) +
-        sizeof(aux_name) - sizeof(struct pldm_pdr_hdr);
-
-    pdr->terminus_handle = 0x01;
-    pdr->sensor_id = 0x1;
-    pdr->sensor_count = 0x1;
-    pdr->names[0] = 0x1;
-
-    idx = 1;
-    memcpy(&pdr->names[idx], tag, sizeof(tag));
-
-    idx += sizeof(tag);
-    memcpy(&pdr->names[idx], aux_name, sizeof(aux_name));
-
-    *aux_pdr = pdr;
-    *pdr_size = sizeof(pldm_sensor_auxiliary_names_pdr_t) + sizeof(tag) +
-        sizeof(aux_name);
-}
-
 void init_pldm_entity_auxiliary_names_pdr(
     pldm_entity_auxiliary_names_pdr_t **aux_pdr,
     uint32_t *pdr_size)
@@ -401,12 +507,8 @@ void init_pldm_entity_auxiliary_names_pdr(
 
 void mcp_setup_pdr(pldm_pdr_api_t *api)
 {
-    uint32_t record_handle = 1;
     uint32_t pdr_size = 0;
     pldm_pdr_t *repo;
-    pldm_state_sensor_pdr_t pldm_state_sensor_pdr;
-    pldm_numeric_sensor_pdr_t pldm_numeric_sensor_pdr;
-    pldm_sensor_auxiliary_names_pdr_t *sensor_aux_name_pdr;
     pldm_entity_auxiliary_names_pdr_t *entity_aux_name_pdr;
 
     /* create master repository which would hold all pdrs */
@@ -414,38 +516,19 @@ void mcp_setup_pdr(pldm_pdr_api_t *api)
     pldm_fw_mcp_ctx.pdr_info.pdr_owner = 1;
     pldm_fw_mcp_ctx.pdr_info.repo = repo;
 
-    /* add the first pdr object to repo */
-    // Numeric Sensor PDR
-    init_pldm_numeric_sensor_pdr(&pldm_numeric_sensor_pdr);
-    api->pldm_pdr_add(
-        repo,
-        (uint8_t *)&pldm_numeric_sensor_pdr,
-        sizeof(pldm_numeric_sensor_pdr_t),
-        false,
-        1,
-        &record_handle);
-
-    // State Sensor PDR
-    init_pldm_state_sensor_pdr(&pldm_state_sensor_pdr);
-    api->pldm_pdr_add(
-        repo,
-        (uint8_t *)&pldm_state_sensor_pdr,
-        sizeof(pldm_state_sensor_pdr_t),
-        false,
-        1,
-        NULL);
-
-    // Sensor Auxiliary Name PDR
-    init_pldm_sensor_auxiliary_names_pdr(&sensor_aux_name_pdr, &pdr_size);
-    api->pldm_pdr_add(
-        repo, (uint8_t *)sensor_aux_name_pdr, pdr_size, false, 1, NULL);
-    fwk_mm_free(sensor_aux_name_pdr);
+    /* numeric and state sensor pdrs of the sensors served by pldm_fw */
+    pldm_fw_sensor_add_pdrs(repo, api);
 
     // Entity Auxiliary Name PDR
     init_pldm_entity_auxiliary_names_pdr(&entity_aux_name_pdr, &pdr_size);
     api->pldm_pdr_add(
         repo, (uint8_t *)entity_aux_name_pdr, pdr_size, false, 1, NULL);
     fwk_mm_free(entity_aux_name_pdr);
+
+    /* GetPDR requests are served from the serialised copy of the repo */
+    if (pldm_fw_pdr_serialise(&pldm_fw_mcp_ctx.pdr_info, api) != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "pdr repository serialisation failed");
+    }
 }
 
 /*
@@ -15,10 +15,19 @@
 #include <mod_pldm.h>
 #include <mod_pldm_fw.h>
 
+#ifdef BUILD_HAS_MOD_TIMER
+#    include <mod_timer.h>
+#endif
+
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_core.h>
+#include <fwk_trace.h>
+
+#include <assert.h>
+#include <inttypes.h>
 
 #define MOD_NAME "[PLDM_FW]: "
 
@@ -33,7 +42,7 @@
  * __VA_ARGS__ by ALIGN_SIZE. This macro can keep all parameters right aligned
  */
 #define FWK_LOG_INFO_ALIGN_P1(fmt, ...) \
-    FWK_LOG_INFO(fmt, ALIGN_SIZE - strlen(fmt), __VA_ARGS__)
+    FWK_LOG_INFO(fmt, (int)(ALIGN_SIZE - strlen(fmt)), __VA_ARGS__)
 
 /*
  * wrapper macro over FWK_LOG_INFO. Use this macro to align and format spacing
@@ -41,7 +50,7 @@
  * the left and still keep the remaining parameters right aligned
  */
 #define FWK_LOG_INFO_ALIGN_P2(fmt, p1, ...) \
-    FWK_LOG_INFO(fmt, p1, ALIGN_SIZE - strlen(fmt), __VA_ARGS__)
+    FWK_LOG_INFO(fmt, p1, (int)(ALIGN_SIZE - strlen(fmt)), __VA_ARGS__)
 
 /* state setter and getter macros */
 #define pldm_fw_get_state() pldm_fw_state
@@ -153,11 +162,59 @@ typedef struct pldm_fw_elem_ctx_t {
 
 } pldm_fw_elem_ctx_t;
 
+/* progress of the push of the oldest queued event to the event receiver */
+typedef enum {
+    PLDM_FW_PUSH_IDLE,
+    /* queued events are held until the coalescing window closes */
+    PLDM_FW_PUSH_WINDOW,
+    /* the event has been sent and waits for its response */
+    PLDM_FW_PUSH_IN_FLIGHT,
+    /*
+     * the event is left for the event receiver to poll, because it is too
+     * large to be pushed, it was rejected or it could not be delivered.
+     * Pushes resume once it has been acknowledged.
+     */
+    PLDM_FW_PUSH_POLLED,
+} pldm_fw_push_state_t;
+
+/* asynchronous delivery of platform events, enabled by SetEventReceiver */
+typedef struct pldm_fw_push {
+    bool enabled;
+    pldm_fw_push_state_t state;
+    /* queued event being pushed and instance id of its request */
+    uint16_t event_id;
+    uint8_t instance_id;
+    unsigned int retries;
+    /* identifies the last alarm started, older alarm events are stale */
+    uint32_t alarm_seq;
+
+    uint32_t pushed;
+    uint32_t coalesced;
+    uint32_t retried;
+    uint32_t failed;
+} pldm_fw_push_t;
+
 /* pldm_fw_ctx type */
 typedef struct pldm_fw_ctx {
     pldm_fw_elem_ctx_t *elem_ctx_table;
     /* Number of channels */
     unsigned int elem_count;
+
+    /*
+     * per-bus response buffers. Each one starts with MCTP_FW_MSG_HEADROOM
+     * bytes so the response can be handed to mctp_fw without being copied.
+     */
+    uint8_t resp_arena[MCTP_FW_BIND_API_IDX_COUNT]
+                      [MCTP_FW_MSG_HEADROOM + PLDM_FW_RESP_ARENA_SIZE];
+    /* response buffer of the bus the request being handled arrived on */
+    uint8_t *resp_arena_active;
+    /* bus the request being handled arrived on */
+    uint32_t active_bus;
+
+    /* module configuration, NULL if the platform does not provide one */
+    const pldm_fw_config_t *config;
+
+    pldm_fw_push_t push;
 } pldm_fw_ctx_t;
 
 /*
@@ -180,6 +237,12 @@ static pldm_fw_ctx_t pldm_fw_ctx;
 extern pldm_fw_terminus_ctx_t pldm_fw_mcp_ctx;
 extern pldm_fw_terminus_ctx_t pldm_fw_bmc_mcp_ctx;
 
+#ifdef BUILD_HAS_MOD_TIMER
+static const struct mod_timer_alarm_api *pldm_fw_alarm_api;
+#endif
+/* sequence number of the last alarm which fired, written in interrupt context */
+static volatile uint32_t pldm_fw_push_alarm_fired;
+
 /* pldm requests and response needs to travel down the pldm<->mctp stack before
  * it reaches the corresponding terminal for decoding and preocessing. This api
  * helps in pushing packets down the stack.
@@ -192,10 +255,22 @@ static int send_pldm_packet(uint32_t bus, bool tag_owner, uint8_t msg_tag, pldm_
         &pldm_fw_ctx.elem_ctx_table[PLDM_FW_BIND_MCTP_FW_API_IDX];
 
     /* Call mctp_fw api to send packet */
-    GET_MCTP_FW_API(elem_ctx)->mctp_fw_receive_from_app_layer(
+    return GET_MCTP_FW_API(elem_ctx)->mctp_fw_receive_from_app_layer(
         bus, tag_owner, msg_tag, &mctp_msg_type, pkt, size);
+}
 
-    return FWK_SUCCESS;
+/*
+ * responses to incoming requests are encoded into the bus response arena,
+ * which has headroom for the mctp message type, so they are sent in place.
+ */
+static void send_pldm_resp(uint32_t bus, pldm_msg_t *resp, size_t size)
+{
+    pldm_fw_elem_ctx_t *elem_ctx =
+        &pldm_fw_ctx.elem_ctx_table[PLDM_FW_BIND_MCTP_FW_API_IDX];
+
+    /* mctp_fw logs a failure, and the requester retries on timeout */
+    (void)GET_MCTP_FW_API(elem_ctx)->mctp_fw_send_from_headroom(
+        bus, 0, 0, MCTP_MSG_TYPE_PLDM, resp, size);
 }
 
 /* returns the elements ctx */
@@ -204,6 +279,25 @@ static pldm_fw_elem_ctx_t *pldm_fw_get_elem_ctx(unsigned int elem_id)
     return &pldm_fw_ctx.elem_ctx_table[elem_id];
 }
 
+/*
+ * returns a zeroed response buffer of the given size from the arena of the bus
+ * the current request arrived on, or NULL if the response does not fit
+ */
+static pldm_msg_t *pldm_fw_get_resp_buffer(size_t size)
+{
+    uint8_t *resp;
+
+    if (size > PLDM_FW_RESP_ARENA_SIZE) {
+        FWK_LOG_ERR(MOD_NAME "Response too large: %u", (unsigned int)size);
+        return NULL;
+    }
+
+    resp = pldm_fw_ctx.resp_arena_active + MCTP_FW_MSG_HEADROOM;
+    memset(resp, 0, size);
+
+    return (pldm_msg_t *)resp;
+}
+
 int send_pldm_platform_event_message(uint16_t tid, uint32_t data_transfer_handle)
 {
     size_t size = 0;
@@ -235,7 +329,12 @@ int send_pldm_platform_event_message(uint16_t tid, uint32_t data_transfer_handle
 
     PLDM_ASSERT(rc);
 
-    send_pldm_packet(MCTP_FW_BIND_SERIAL_API_IDX, 1, 0, request, PLDM_MSG_HDR_T_SIZE + size);
+    send_pldm_packet(
+        pldm_fw_mcp_ctx.receiver_ev_state.bus,
+        1,
+        0,
+        request,
+        PLDM_MSG_HDR_T_SIZE + size);
     fwk_mm_free(request);
 
     return FWK_SUCCESS;
@@ -287,17 +386,282 @@ int send_pldm_platform_event_message_cper(uint16_t tid, uint32_t data_transfer_h
 
     PLDM_ASSERT(rc);
 
-    send_pldm_packet(MCTP_FW_BIND_SERIAL_API_IDX, 1, 0, request, PLDM_MSG_HDR_T_SIZE + size);
+    send_pldm_packet(
+        pldm_fw_mcp_ctx.receiver_ev_state.bus,
+        1,
+        0,
+        request,
+        PLDM_MSG_HDR_T_SIZE + size);
     fwk_mm_free(request);
 
     return FWK_SUCCESS;
 }
 
+/* asynchronous events need the alarm timing the window and the retries */
+static bool pldm_fw_push_supported(void)
+{
+#ifdef BUILD_HAS_MOD_TIMER
+    return (pldm_fw_ctx.config != NULL) &&
+        !fwk_id_is_equal(pldm_fw_ctx.config->event_alarm_id, FWK_ID_NONE);
+#else
+    return false;
+#endif
+}
+
+#ifdef BUILD_HAS_MOD_TIMER
+static void pldm_fw_push_alarm_callback(uintptr_t alarm_seq)
+{
+    struct fwk_event_light event = {
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_PLDM_FW, PLDM_FW_EVENT_IDX_EVENT_PUSH),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_PLDM_FW),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_PLDM_FW),
+    };
+
+    pldm_fw_push_alarm_fired = (uint32_t)alarm_seq;
+    (void)fwk_put_event(&event);
+}
+#endif
+
+/* raises a PLDM_FW_EVENT_IDX_EVENT_PUSH event once delay_ms has elapsed */
+static int pldm_fw_push_arm(unsigned int delay_ms)
+{
+    int status = FWK_E_SUPPORT;
+
+    pldm_fw_ctx.push.alarm_seq++;
+
+#ifdef BUILD_HAS_MOD_TIMER
+    status = pldm_fw_alarm_api->start(
+        pldm_fw_ctx.config->event_alarm_id,
+        delay_ms,
+        MOD_TIMER_ALARM_TYPE_ONCE,
+        pldm_fw_push_alarm_callback,
+        pldm_fw_ctx.push.alarm_seq);
+#endif
+
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "event alarm not started: %d", status);
+    }
+
+    return status;
+}
+
+static void pldm_fw_push_disarm(void)
+{
+    pldm_fw_ctx.push.alarm_seq++;
+
+#ifdef BUILD_HAS_MOD_TIMER
+    (void)pldm_fw_alarm_api->stop(pldm_fw_ctx.config->event_alarm_id);
+#endif
+}
+
+/*
+ * sends the event as a PlatformEventMessage to the bus the event receiver
+ * registered from. Events larger than the receiver buffer are announced with a
+ * pldmMessagePollEvent instead.
+ */
+static void pldm_fw_push_send(const struct pldm_event *event)
+{
+    pldm_fw_push_t *push = &pldm_fw_ctx.push;
+    pldm_platform_api_t *api;
+    pldm_msg_t *request;
+    size_t size;
+    int rc;
+
+    if (event->size > pldm_fw_mcp_ctx.event_receiver_max_buffer_size) {
+        push->state = PLDM_FW_PUSH_POLLED;
+        (void)send_pldm_platform_event_message(pldm_fw_mcp_ctx.tid, 0);
+        return;
+    }
+
+    api = GET_PLDM_PLATFORM_API(
+        pldm_fw_get_elem_ctx(PLDM_FW_BIND_PLATFORM_API_IDX));
+
+    size = PLDM_PLATFORM_EVENT_MESSAGE_MIN_REQ_BYTES + event->size;
+    request = (pldm_msg_t *)fwk_mm_calloc(1, PLDM_MSG_HDR_T_SIZE + size);
+
+    rc = api->encode_platform_event_message_req(
+        push->instance_id,
+        0x1,
+        pldm_fw_mcp_ctx.tid,
+        event->class,
+        event->data,
+        event->size,
+        request,
+        size);
+
+    PLDM_ASSERT(rc);
+
+    send_pldm_packet(
+        pldm_fw_mcp_ctx.receiver_ev_state.bus,
+        1,
+        0,
+        request,
+        PLDM_MSG_HDR_T_SIZE + size);
+    fwk_mm_free(request);
+
+    push->state = PLDM_FW_PUSH_IN_FLIGHT;
+    if (pldm_fw_push_arm(
+            pldm_fw_ctx.config->event_retry_timeout_ms << push->retries) !=
+        FWK_SUCCESS) {
+        /*
+         * without the alarm the push can neither be retried nor time out, so
+         * the event stays queued until the event receiver polls for it
+         */
+        push->failed++;
+        push->state = PLDM_FW_PUSH_POLLED;
+    }
+}
+
+/* pushes the oldest queued event which is not superseded by a newer one */
+static void pldm_fw_push_next(void)
+{
+    pldm_fw_push_t *push = &pldm_fw_ctx.push;
+    const struct pldm_event *event;
+
+    for (event = event_queue_get(); event != NULL; event = event_queue_get()) {
+        if (!event_queue_is_superseded(event)) {
+            break;
+        }
+        (void)event_queue_ack(event->id);
+        push->coalesced++;
+    }
+
+    if (event == NULL) {
+        push->state = PLDM_FW_PUSH_IDLE;
+        return;
+    }
+
+    push->event_id = event->id;
+    push->instance_id = (push->instance_id + 1) & PLDM_INSTANCE_MAX;
+    push->retries = 0;
+
+    pldm_fw_push_send(event);
+}
+
+/* opens the coalescing window for the events just queued */
+static void pldm_fw_push_schedule(void)
+{
+    pldm_fw_push_t *push = &pldm_fw_ctx.push;
+
+    /* the events are picked up when the current push completes */
+    if (push->state != PLDM_FW_PUSH_IDLE) {
+        return;
+    }
+
+    if (pldm_fw_ctx.config->event_coalesce_window_ms == 0) {
+        pldm_fw_push_next();
+        return;
+    }
+
+    push->state = PLDM_FW_PUSH_WINDOW;
+    if (pldm_fw_push_arm(pldm_fw_ctx.config->event_coalesce_window_ms) !=
+        FWK_SUCCESS) {
+        /* the window cannot be timed, push the events straight away */
+        pldm_fw_push_next();
+    }
+}
+
+/* the coalescing window closed or the pushed event response timed out */
+static void pldm_fw_push_alarm(void)
+{
+    pldm_fw_push_t *push = &pldm_fw_ctx.push;
+    const struct pldm_event *event;
+
+    /*
+     * pushes were disabled, or the alarm was stopped or started again after
+     * raising the event
+     */
+    if (!push->enabled || (pldm_fw_push_alarm_fired != push->alarm_seq)) {
+        return;
+    }
+
+    switch (push->state) {
+    case PLDM_FW_PUSH_WINDOW:
+        pldm_fw_push_next();
+        break;
+
+    case PLDM_FW_PUSH_IN_FLIGHT:
+        event = event_queue_get();
+        if ((event == NULL) || (event->id != push->event_id)) {
+            push->state = PLDM_FW_PUSH_IDLE;
+            break;
+        }
+
+        if (push->retries >= pldm_fw_ctx.config->event_retry_count) {
+            /* the event stays queued until the event receiver polls for it */
+            FWK_LOG_WARN(MOD_NAME "event %u not delivered", event->id);
+            push->failed++;
+            push->state = PLDM_FW_PUSH_POLLED;
+            break;
+        }
+
+        push->retries++;
+        push->retried++;
+        pldm_fw_push_send(event);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/* completes the push of the event the PlatformEventMessage response is for */
+static void pldm_fw_push_complete(uint8_t instance_id, uint8_t completion_code)
+{
+    pldm_fw_push_t *push = &pldm_fw_ctx.push;
+
+    if ((push->state != PLDM_FW_PUSH_IN_FLIGHT) ||
+        (instance_id != push->instance_id)) {
+        return;
+    }
+
+    /* the alarm fires again for the retry, unless the receiver is busy */
+    if (completion_code == PLDM_ERROR_NOT_READY) {
+        return;
+    }
+
+    pldm_fw_push_disarm();
+
+    if (completion_code != PLDM_SUCCESS) {
+        /* the event stays queued until the event receiver polls for it */
+        FWK_LOG_WARN(
+            MOD_NAME "event %u rejected: %u", push->event_id, completion_code);
+        push->failed++;
+        push->state = PLDM_FW_PUSH_POLLED;
+        return;
+    }
+
+    push->pushed++;
+    (void)event_queue_ack(push->event_id);
+    pldm_fw_push_next();
+}
+
+/* resumes the pushes once the event left for polling has been acknowledged */
+static void pldm_fw_push_polled(uint16_t event_id)
+{
+    pldm_fw_push_t *push = &pldm_fw_ctx.push;
+
+    if ((push->state != PLDM_FW_PUSH_POLLED) || (event_id != push->event_id)) {
+        return;
+    }
+
+    push->state = PLDM_FW_PUSH_IDLE;
+    pldm_fw_push_schedule();
+}
+
 #ifdef BUILD_HAS_DEBUGGER
 static const char pldm_call[] = "pldm";
 static const char pldm_help[] =
     "  Test pldm send platform event message request\n"
-    "    Usage: pldm event\n";
+    "    Usage: pldm event\n"
+    "  Show pldm command statistics\n"
+    "    Usage: pldm stats\n"
+    "  Show platform event queue and push statistics\n"
+    "    Usage: pldm events\n";
+
+static void pldm_fw_print_stats(void);
+static void pldm_fw_print_event_stats(void);
 
 static int32_t pldm_f(int32_t argc, char **argv)
 {
@@ -310,7 +674,11 @@ static int32_t pldm_f(int32_t argc, char **argv)
         return FWK_E_PARAM;
     }
 
-    if (cli_strncmp(argv[1], "event", 5) == 0) {
+    if (cli_strncmp(argv[1], "events", 6) == 0) {
+        pldm_fw_print_event_stats();
+
+        return FWK_SUCCESS;
+    } else if (cli_strncmp(argv[1], "event", 5) == 0) {
         cli_print("[PLDM FW] Send Platform Event Message Request ... \n");
 
         return send_pldm_platform_event_message(1, 0);
@@ -318,6 +686,10 @@ static int32_t pldm_f(int32_t argc, char **argv)
         cli_print("[PLDM FW] Send Platform Event Message - CPER ... \n");
 
         return send_pldm_platform_event_message_cper(1, 0);
+    } else if (cli_strncmp(argv[1], "stats", 5) == 0) {
+        pldm_fw_print_stats();
+
+        return FWK_SUCCESS;
     }
 
     cli_print("CLI: Invalid command received:\n");
@@ -367,25 +739,29 @@ void pldm_fw_terminus_info(pldm_fw_terminus_ctx_t *ctx)
     ev_state = &ctx->receiver_ev_state;
 
     FWK_LOG_INFO(MOD_NAME "\n");
-    FWK_LOG_INFO_ALIGN_P1(MOD_NAME "pldm tid: %*lu", (uint32_t)ctx->tid);
+    FWK_LOG_INFO_ALIGN_P1(MOD_NAME "pldm tid: %*" PRIu32, (uint32_t)ctx->tid);
     FWK_LOG_INFO_ALIGN_P1(
-        MOD_NAME "pldm type count: %*lu", (uint32_t)ctx->types_count);
+        MOD_NAME "pldm type count: %*" PRIu32, (uint32_t)ctx->types_count);
 
     FWK_LOG_INFO_ALIGN_P1(
-        MOD_NAME "global enable: %*lu", (uint32_t)ev_state->global_enable);
+        MOD_NAME "global enable: %*" PRIu32,
+        (uint32_t)ev_state->global_enable);
     FWK_LOG_INFO_ALIGN_P1(
-        MOD_NAME "receiver addr: %*lu", (uint32_t)ev_state->receiver_addr);
+        MOD_NAME "receiver addr: %*" PRIu32,
+        (uint32_t)ev_state->receiver_addr);
     FWK_LOG_INFO_ALIGN_P1(
-        MOD_NAME "heartbeat timer: %*lu", (uint32_t)ev_state->heartbeat_timer);
+        MOD_NAME "heartbeat timer: %*" PRIu32,
+        (uint32_t)ev_state->heartbeat_timer);
     FWK_LOG_INFO_ALIGN_P1(
-        MOD_NAME "transport protocol type: %*lu",
+        MOD_NAME "transport protocol type: %*" PRIu32,
         (uint32_t)ev_state->transport_protocol_type);
 
     for (size_t i = 0; i < ctx->types_count; i++) {
         info = &ctx->pldm_info[i];
-        FWK_LOG_INFO_ALIGN_P1(MOD_NAME "pldm type: %*lu", (uint32_t)info->type);
         FWK_LOG_INFO_ALIGN_P1(
-            MOD_NAME "version count: %*lu", (uint32_t)info->version_count);
+            MOD_NAME "pldm type: %*" PRIu32, (uint32_t)info->type);
+        FWK_LOG_INFO_ALIGN_P1(
+            MOD_NAME "version count: %*" PRIu32, (uint32_t)info->version_count);
 
         for (size_t j = 0; j < info->version_count; j++) {
             version = &info->version[j];
@@ -393,31 +769,34 @@ void pldm_fw_terminus_info(pldm_fw_terminus_ctx_t *ctx)
 
             FWK_LOG_INFO_ALIGN_P2(
                 MOD_NAME "version[%u] : %*x.%x.%x.%x",
-                j,
+                (unsigned int)j,
                 (int)v[0],
                 (int)v[1],
                 (int)v[2],
                 (int)v[3]);
 
             FWK_LOG_INFO_ALIGN_P1(
-                MOD_NAME "commands count: %*lu",
+                MOD_NAME "commands count: %*" PRIu32,
                 (uint32_t)version->commands_count);
 
             for (size_t k = 0; k < version->commands_count; k++) {
                 FWK_LOG_INFO_ALIGN_P2(
-                    MOD_NAME "command[%u]: %*lu",
-                    k,
+                    MOD_NAME "command[%u]: %*" PRIu32,
+                    (unsigned int)k,
                     (uint32_t)version->commands[k]);
             }
         }
     }
 
     pdr_info = &ctx->pdr_info;
-    for (size_t i = 0; i < pdr_info->idx; i++) {
-        FWK_LOG_INFO(MOD_NAME "pdr [%lu]: ", (uint32_t)i);
-        for (size_t j = 0; j < pdr_info->pdr[i].sz; j++)
+    for (size_t i = 0; i < pdr_info->count; i++) {
+        FWK_LOG_INFO(
+            MOD_NAME "pdr [%" PRIu32 "]: ",
+            (uint32_t)pdr_info->index[i].record_handle);
+        for (size_t j = 0; j < pdr_info->index[i].size; j++)
             FWK_LOG_INFO_ALIGN_P1(
-                MOD_NAME "%*lu ", (uint32_t)pdr_info->pdr[i].p[j]);
+                MOD_NAME "%*" PRIu32 " ",
+                (uint32_t)pdr_info->blob[pdr_info->index[i].offset + j]);
     }
 }
 
@@ -448,6 +827,11 @@ void pldm_fw_discovery(pldm_fw_terminus_ctx_t *ctx)
     info = &ctx->pldm_info[idx];
     version_idx = info->idx;
 
+    /* keep fetching pdrs until the responder reports the last one */
+    if ((pldm_discovery == PLDM_FW_GET_PDR) && ctx->pdr_info.xfer_done) {
+        pldm_discovery = PLDM_FW_REQ_TYPES;
+    }
+
     /* pldm discovery - handshake */
     switch (pldm_discovery) {
     case PLDM_FW_REQ_TID:
@@ -486,43 +870,35 @@ void pldm_fw_discovery(pldm_fw_terminus_ctx_t *ctx)
 
     case PLDM_FW_GET_PDR:
 
-        size = PLDM_GET_PDR_REQ_BYTES;
+        size = PLDM_MSG_HDR_T_SIZE + PLDM_GET_PDR_REQ_BYTES;
         request = (pldm_msg_t *)fwk_mm_calloc(1, size);
 
         MM_ASSERT(request);
 
-        /* transfer_op_flag denoting either FIRST_PART or NEXT_PART or the PDR
-         * to be retrieved. */
-        uint8_t transfer_op_flag = PLDM_GET_FIRSTPART;
-
         /* The maximum number of record bytes requested to be returned in the
          * response to this instance of the GetPDR command. */
-        uint16_t request_cnt = sizeof(pldm_state_sensor_pdr_t);
+        uint16_t request_cnt = PLDM_FW_PDR_XFER_SIZE;
 
         /* From pldm platform specification - "If the transferOperationFlag
          * field is set to GetFirstPart, set this value to 0x0000" */
         uint16_t record_chg_num = 0;
 
-        /* record_hndl value for the PDR to be retrieved. 0 is a special value
-         * denoting the first PDR from the repository*/
-        uint32_t record_hndl = 0;
-
-        /* data_transfer_hndl is used to identify multipart messages. 0 stands
-         * for the first part */
-        uint32_t data_transfer_hndl = 0;
-
-        /* form get_pdr request */
+        /*
+         * record_hndl starts at 0, denoting the first PDR from the repository,
+         * and then follows the next record handles returned by the responder.
+         * transfer_op_flag and data_transfer_hndl walk through the parts of
+         * PDRs larger than request_cnt.
+         */
         rc = pldm_platform_api->encode_get_pdr_req(
             PLDM_INSTANCE_ID,
-            record_hndl,
-            data_transfer_hndl,
-            transfer_op_flag,
+            ctx->pdr_info.xfer_record_hndl,
+            ctx->pdr_info.xfer_data_transfer_hndl,
+            ctx->pdr_info.xfer_op_flag,
             request_cnt,
             record_chg_num,
             request,
             PLDM_GET_PDR_REQ_BYTES);
 
-        pldm_discovery = PLDM_FW_REQ_TYPES;
         break;
 
     case PLDM_FW_REQ_TYPES:
@@ -598,22 +974,20 @@ void pldm_fw_discovery(pldm_fw_terminus_ctx_t *ctx)
     }
 
     PLDM_ASSERT(rc);
-    send_pldm_packet(MCTP_FW_BIND_SERIAL_API_IDX, 1, 0, request, size);
+    send_pldm_packet(ctx->receiver_ev_state.bus, 1, 0, request, size);
     fwk_mm_free(request);
 }
 
-/* pldm unsupport packet processing */
-/* api to process pldm unsupport request packets */
-void pldm_response_unsupport(
+/* api to build a response carrying only a completion code */
+static void pldm_response_error(
     pldm_msg_t *pldm_req,
+    uint8_t completion_code,
     pldm_msg_t **pldm_resp_ptr,
     size_t *resp_len_ptr)
 {
     // 1 for CompleteCode
     *resp_len_ptr = PLDM_MSG_HDR_T_SIZE + 1;
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
 
     /* encode response packet */
     (*pldm_resp_ptr)->hdr.instance_id = pldm_req->hdr.instance_id;
@@ -623,13 +997,25 @@ void pldm_response_unsupport(
     (*pldm_resp_ptr)->hdr.type = pldm_req->hdr.type;
     (*pldm_resp_ptr)->hdr.header_ver = pldm_req->hdr.header_ver;
     (*pldm_resp_ptr)->hdr.command = pldm_req->hdr.command;
-    (*pldm_resp_ptr)->payload[0] = PLDM_ERROR_UNSUPPORTED_PLDM_CMD;
+    (*pldm_resp_ptr)->payload[0] = completion_code;
+}
+
+/* pldm unsupport packet processing */
+/* api to process pldm unsupport request packets */
+void pldm_response_unsupport(
+    pldm_msg_t *pldm_req,
+    pldm_msg_t **pldm_resp_ptr,
+    size_t *resp_len_ptr)
+{
+    pldm_response_error(
+        pldm_req, PLDM_ERROR_UNSUPPORTED_PLDM_CMD, pldm_resp_ptr, resp_len_ptr);
 }
 
 /* pldm set version packet processing */
 /* api to process pldm base get tid request packets */
 void handle_pldm_set_tid_req(
     pldm_msg_t *pldm_req,
+    size_t req_len,
     pldm_msg_t **pldm_resp_ptr,
     size_t *resp_len_ptr,
     pldm_fw_terminus_ctx_t *ctx)
@@ -645,9 +1031,10 @@ void handle_pldm_set_tid_req(
 
     /* populate size for response packet and allocate memory */
     *resp_len_ptr = PLDM_MSG_HDR_T_SIZE + PLDM_SET_TID_RESP_BYTES;
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* encode response packet */
     rc = pldm_base_api->encode_cc_only_resp(
@@ -664,6 +1051,7 @@ void handle_pldm_set_tid_req(
 /* api to process pldm base get tid request packets */
 void handle_pldm_get_tid_req(
     pldm_msg_t *pldm_req,
+    size_t req_len,
     pldm_msg_t **pldm_resp_ptr,
     size_t *resp_len_ptr,
     pldm_fw_terminus_ctx_t *ctx)
@@ -678,9 +1066,10 @@ void handle_pldm_get_tid_req(
 
     /* populate size for response packet and allocate memory */
     *resp_len_ptr = PLDM_MSG_HDR_T_SIZE + sizeof(pldm_get_tid_resp_t);
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* encode response packet */
     rc = pldm_base_api->encode_get_tid_resp(
@@ -692,6 +1081,7 @@ void handle_pldm_get_tid_req(
 /* api to process pldm base get tid response packets */
 void handle_pldm_get_tid_resp(
     pldm_msg_t *pldm_resp,
+    size_t resp_len,
     pldm_fw_terminus_ctx_t *ctx)
 {
     uint8_t completion_code = PLDM_SUCCESS;
@@ -721,6 +1111,7 @@ void handle_pldm_set_event_receiver_req(
     uint8_t completion_code = PLDM_SUCCESS;
     uint8_t instance_id = PLDM_INSTANCE_ID;
     uint16_t heartbeat_timer = 0;
+    bool push_enable;
     int rc;
 
     receiver_ev_state_t *ev_state;
@@ -740,6 +1131,21 @@ void handle_pldm_set_event_receiver_req(
 
     PLDM_ASSERT(rc);
 
+    push_enable =
+        (event_message_global_enable ==
+         PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC) ||
+        (event_message_global_enable ==
+         PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC_KEEP_ALIVE);
+
+    if (push_enable && !pldm_fw_push_supported()) {
+        pldm_response_error(
+            pldm_req,
+            PLDM_PLATFORM_ENABLE_METHOD_NOT_SUPPORTED,
+            pldm_resp_ptr,
+            resp_len_ptr);
+        return;
+    }
+
     /*
      * ctx object passed into this function is that of the event generator.
      * Therefor rather than retrieving information from the context, event
@@ -750,10 +1156,28 @@ void handle_pldm_set_event_receiver_req(
     ev_state->transport_protocol_type = transport_protocol_type;
     ev_state->receiver_addr = event_receiver_address_info;
     ev_state->heartbeat_timer = heartbeat_timer;
+    ev_state->bus = pldm_fw_ctx.active_bus;
+
+    /*
+     * events queued so far are pushed as well. When pushes are disabled, the
+     * push in progress is abandoned and its event is left for polling.
+     */
+    if (!push_enable && pldm_fw_ctx.push.enabled) {
+        pldm_fw_push_disarm();
+        pldm_fw_ctx.push.state = PLDM_FW_PUSH_IDLE;
+    }
+
+    pldm_fw_ctx.push.enabled = push_enable;
+    if (push_enable && (event_queue_length() > 0)) {
+        pldm_fw_push_schedule();
+    }
 
     /* set_event_receiver response packets don't have any additional payload */
     *resp_len_ptr = PLDM_MSG_HDR_T_SIZE;
-    *pldm_resp_ptr = fwk_mm_calloc(1, *resp_len_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     rc = pldm_platform_api->encode_set_event_receiver_resp(
         instance_id, completion_code, *pldm_resp_ptr);
@@ -765,6 +1189,7 @@ void handle_pldm_set_event_receiver_req(
 /* api to process pldm get event receiver request packet */
 void handle_pldm_get_event_receiver_req(
     pldm_msg_t *pldm_req,
+    size_t req_len,
     pldm_msg_t **pldm_resp_ptr,
     size_t *resp_len_ptr,
     pldm_fw_terminus_ctx_t *ev_gen_ctx)
@@ -781,9 +1206,10 @@ void handle_pldm_get_event_receiver_req(
     /* populate size for response packet and allocate memory */
     *resp_len_ptr =
         PLDM_MSG_HDR_T_SIZE + sizeof(struct pldm_get_event_receiver_resp);
-    *pldm_resp_ptr = fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* get ev_state */
     ev_state = &ev_gen_ctx->receiver_ev_state;
@@ -825,6 +1251,7 @@ void handle_pldm_set_event_receiver_resp(
 /* api to process pldm base get pldm types request packets */
 void handle_pldm_get_pldm_types_req(
     pldm_msg_t *pldm_req,
+    size_t req_len,
     pldm_msg_t **pldm_resp_ptr,
     size_t *resp_ptr_len,
     pldm_fw_terminus_ctx_t *ctx)
@@ -853,9 +1280,10 @@ void handle_pldm_get_pldm_types_req(
 
     /* populate size for response packet and allocate memory */
     *resp_ptr_len = PLDM_MSG_HDR_T_SIZE + sizeof(pldm_get_types_resp_t);
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_ptr_len);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_ptr_len);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* encode response packet */
     rc = pldm_base_api->encode_get_types_resp(
@@ -867,6 +1295,7 @@ void handle_pldm_get_pldm_types_req(
 /* api to process pldm base get pldm types response packets */
 void handle_pldm_get_pldm_types_resp(
     pldm_msg_t *pldm_resp,
+    size_t resp_len,
     pldm_fw_terminus_ctx_t *ctx)
 {
     uint8_t completion_code = PLDM_SUCCESS;
@@ -966,9 +1395,10 @@ void handle_pldm_get_version_req(
     /* populate size for response packet and allocate memory */
     *resp_len_ptr =
         PLDM_MSG_HDR_T_SIZE + sizeof(pldm_get_version_resp_t) + sizeof(ver32_t);
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* encode response packet */
     rc = pldm_base_api->encode_get_version_resp(
@@ -1083,9 +1513,10 @@ void handle_pldm_get_commands_req(
 
     /* populate size for response packet and allocate memory */
     *resp_len_ptr = PLDM_MSG_HDR_T_SIZE + sizeof(pldm_get_commands_resp_t);
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* encode response packet */
     rc = pldm_base_api->encode_get_commands_resp(
@@ -1188,65 +1619,278 @@ void handle_pldm_get_commands_resp(
 }
 
 /* pldm get pdr packet processing */
-/* api to process pldm_platform get_pdr request packets */
-void handle_pldm_get_pdr_req(
-    pldm_msg_t *pldm_req,
-    size_t req_len,
-    pldm_msg_t **pldm_resp_ptr,
-    size_t *resp_len_ptr,
-    pldm_fw_terminus_ctx_t *ctx)
+
+/* grows *buf so it holds at least count elements of elem_size bytes */
+static int pldm_fw_pdr_reserve(
+    void **buf,
+    uint32_t *capacity,
+    size_t count,
+    size_t elem_size)
 {
-    uint8_t *record_data;
-    uint8_t transfer_op_flag;
-    /* Start and end of transfer */
-    uint8_t transfer_flag = PLDM_EVENT_START_AND_END;
-    /* we don't have a CRC engine to do this. Add in a dummy value */
-    uint8_t transfer_crc = 0xFF;
-    uint16_t request_cnt;
-    uint16_t record_chg_num;
-    uint32_t record_hndl;
-    uint32_t data_transfer_hndl;
-    uint32_t next_record_hndl;
-    uint32_t next_data_transfer_hndl = 0x0;
-    uint32_t resp_cnt;
+    size_t new_capacity;
+    void *new_buf;
 
-    int rc;
+    if (count <= *capacity) {
+        return FWK_SUCCESS;
+    }
 
-    pldm_platform_api_t *pldm_platform_api;
-    pldm_pdr_api_t *pldm_pdr_api;
+    new_capacity = FWK_MAX(count, (size_t)*capacity * 2);
+    if (new_capacity > UINT32_MAX) {
+        return FWK_E_NOMEM;
+    }
 
-    /* get pldm pdr api to access required fps */
-    pldm_pdr_api =
-        GET_PLDM_PDR_API(pldm_fw_get_elem_ctx(PLDM_FW_BIND_PDR_API_IDX));
-    /* get pldm platform api to access required fps */
-    pldm_platform_api = GET_PLDM_PLATFORM_API(
-        pldm_fw_get_elem_ctx(PLDM_FW_BIND_PLATFORM_API_IDX));
+    new_buf = fwk_mm_realloc(*buf, new_capacity, elem_size);
+    if (new_buf == NULL) {
+        return FWK_E_NOMEM;
+    }
 
-    /* decode pldm pdr request */
-    rc = pldm_platform_api->decode_get_pdr_req(
-        pldm_req,
-        PLDM_GET_PDR_REQ_BYTES,
-        &record_hndl,
-        &data_transfer_hndl,
-        &transfer_op_flag,
-        &request_cnt,
+    *buf = new_buf;
+    *capacity = (uint32_t)new_capacity;
+
+    return FWK_SUCCESS;
+}
+
+/* adds the pdr at the end of the blob to the index */
+static int pldm_fw_pdr_index_add(
+    pdr_info_t *pdr_info,
+    uint32_t record_handle,
+    uint32_t size,
+    uint8_t crc)
+{
+    pdr_index_t *entry;
+    int status;
+
+    /* handles are looked up with a binary search, keep them sorted */
+    if ((pdr_info->count > 0) &&
+        (record_handle <= pdr_info->index[pdr_info->count - 1].record_handle)) {
+        return FWK_E_PARAM;
+    }
+
+    if (size > UINT16_MAX) {
+        return FWK_E_SIZE;
+    }
+
+    status = pldm_fw_pdr_reserve(
+        (void **)&pdr_info->index,
+        &pdr_info->index_capacity,
+        pdr_info->count + 1,
+        sizeof(pdr_index_t));
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    entry = &pdr_info->index[pdr_info->count++];
+    entry->record_handle = record_handle;
+    entry->offset = (uint32_t)pdr_info->blob_size;
+    entry->size = (uint16_t)size;
+    entry->crc = crc;
+
+    pdr_info->blob_size += size;
+
+    return FWK_SUCCESS;
+}
+
+int pldm_fw_pdr_serialise(pdr_info_t *pdr_info, pldm_pdr_api_t *pldm_pdr_api)
+{
+    const pldm_pdr_record_t *record;
+    pldm_utils_api_t *pldm_utils_api;
+    uint8_t *data;
+    uint32_t size;
+    uint32_t next_record_hndl;
+    int status;
+
+    pldm_utils_api =
+        GET_PLDM_UTILS_API(pldm_fw_get_elem_ctx(PLDM_FW_BIND_UTILS_API_IDX));
+
+    /* the repo size and record count are known up front, allocate once */
+    status = pldm_fw_pdr_reserve(
+        (void **)&pdr_info->blob,
+        &pdr_info->blob_capacity,
+        pldm_pdr_api->pldm_pdr_get_repo_size(pdr_info->repo),
+        sizeof(uint8_t));
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    status = pldm_fw_pdr_reserve(
+        (void **)&pdr_info->index,
+        &pdr_info->index_capacity,
+        pldm_pdr_api->pldm_pdr_get_record_count(pdr_info->repo),
+        sizeof(pdr_index_t));
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* record handle 0 stands for the first pdr in the repository */
+    record = pldm_pdr_api->pldm_pdr_find_record(
+        pdr_info->repo, 0, &data, &size, &next_record_hndl);
+
+    while (record != NULL) {
+        if (size > (pdr_info->blob_capacity - pdr_info->blob_size)) {
+            return FWK_E_SIZE;
+        }
+
+        memcpy(&pdr_info->blob[pdr_info->blob_size], data, size);
+
+        status = pldm_fw_pdr_index_add(
+            pdr_info,
+            pldm_pdr_api->pldm_pdr_get_record_handle(pdr_info->repo, record),
+            size,
+            pldm_utils_api->crc8(data, size));
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        record = pldm_pdr_api->pldm_pdr_get_next_record(
+            pdr_info->repo, record, &data, &size, &next_record_hndl);
+    }
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * looks a pdr up in the index. Record handle 0 stands for the first pdr. The
+ * handle of the pdr following it, or 0 for the last one, is returned through
+ * next_record_hndl.
+ */
+static const pdr_index_t *pldm_fw_pdr_find(
+    const pdr_info_t *pdr_info,
+    uint32_t record_hndl,
+    uint32_t *next_record_hndl)
+{
+    uint32_t low = 0;
+    uint32_t high = pdr_info->count;
+    uint32_t mid;
+
+    if (pdr_info->count == 0) {
+        return NULL;
+    }
+
+    if (record_hndl == 0) {
+        high = 1;
+    } else {
+        while (low < high) {
+            mid = low + ((high - low) / 2);
+            if (pdr_info->index[mid].record_handle < record_hndl) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        if ((low == pdr_info->count) ||
+            (pdr_info->index[low].record_handle != record_hndl)) {
+            return NULL;
+        }
+    }
+
+    *next_record_hndl = ((low + 1) < pdr_info->count) ?
+        pdr_info->index[low + 1].record_handle :
+        0;
+
+    return &pdr_info->index[low];
+}
+
+/* api to process pldm_platform get_pdr request packets */
+void handle_pldm_get_pdr_req(
+    pldm_msg_t *pldm_req,
+    size_t req_len,
+    pldm_msg_t **pldm_resp_ptr,
+    size_t *resp_len_ptr,
+    pldm_fw_terminus_ctx_t *ctx)
+{
+    const pdr_index_t *entry;
+    uint8_t transfer_op_flag;
+    uint8_t transfer_flag;
+    uint8_t transfer_crc = 0;
+    uint16_t request_cnt;
+    uint16_t record_chg_num;
+    uint32_t record_hndl;
+    uint32_t data_transfer_hndl;
+    uint32_t next_record_hndl;
+    uint32_t next_data_transfer_hndl = 0x0;
+    uint32_t remaining;
+    uint32_t resp_cnt;
+    bool last;
+
+    int rc;
+
+    pldm_platform_api_t *pldm_platform_api;
+
+    /* get pldm platform api to access required fps */
+    pldm_platform_api = GET_PLDM_PLATFORM_API(
+        pldm_fw_get_elem_ctx(PLDM_FW_BIND_PLATFORM_API_IDX));
+
+    /* decode pldm pdr request */
+    rc = pldm_platform_api->decode_get_pdr_req(
+        pldm_req,
+        PLDM_GET_PDR_REQ_BYTES,
+        &record_hndl,
+        &data_transfer_hndl,
+        &transfer_op_flag,
+        &request_cnt,
         &record_chg_num);
 
     PLDM_ASSERT(rc);
 
-    /* find appropriate pdr from pdr repo */
-    pldm_pdr_api->pldm_pdr_find_record(
-        ctx->pdr_info.repo,
-        record_hndl,
-        &record_data,
-        &resp_cnt,
-        &next_record_hndl);
+    /* find appropriate pdr from the serialised pdr repo */
+    entry = pldm_fw_pdr_find(&ctx->pdr_info, record_hndl, &next_record_hndl);
+    if (entry == NULL) {
+        pldm_response_error(
+            pldm_req,
+            PLDM_PLATFORM_INVALID_RECORD_HANDLE,
+            pldm_resp_ptr,
+            resp_len_ptr);
+        return;
+    }
 
-    /* populate size for response packet and allocate memory */
+    /* data_transfer_hndl is the offset of the next part within the pdr */
+    if (transfer_op_flag == PLDM_GET_FIRSTPART) {
+        data_transfer_hndl = 0;
+    } else if (transfer_op_flag != PLDM_GET_NEXTPART) {
+        pldm_response_error(
+            pldm_req,
+            PLDM_PLATFORM_INVALID_TRANSFER_OPERATION_FLAG,
+            pldm_resp_ptr,
+            resp_len_ptr);
+        return;
+    }
+
+    if (data_transfer_hndl >= entry->size) {
+        pldm_response_error(
+            pldm_req,
+            PLDM_PLATFORM_INVALID_DATA_TRANSFER_HANDLE,
+            pldm_resp_ptr,
+            resp_len_ptr);
+        return;
+    }
+
+    remaining = entry->size - data_transfer_hndl;
+    resp_cnt = FWK_MIN(FWK_MIN((uint32_t)request_cnt, remaining),
+                       (uint32_t)PLDM_FW_PDR_XFER_SIZE);
+    last = (resp_cnt == remaining);
+
+    if (data_transfer_hndl == 0) {
+        transfer_flag = last ? PLDM_START_AND_END : PLDM_START;
+    } else {
+        transfer_flag = last ? PLDM_END : PLDM_MIDDLE;
+    }
+
+    if (!last) {
+        next_data_transfer_hndl = data_transfer_hndl + resp_cnt;
+    }
+
+    /* populate size for response packet, the crc only follows the last part */
     *resp_len_ptr = PLDM_MSG_HDR_T_SIZE + PLDM_GET_PDR_MIN_RESP_BYTES + resp_cnt;
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
+    if (transfer_flag == PLDM_END) {
+        transfer_crc = entry->crc;
+        *resp_len_ptr += sizeof(transfer_crc);
+    }
 
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* form get_pdr response to send to the requesting terminus */
     rc = pldm_platform_api->encode_get_pdr_resp(
@@ -1256,7 +1900,7 @@ void handle_pldm_get_pdr_req(
         next_data_transfer_hndl,
         transfer_flag,
         (uint16_t)resp_cnt,
-        record_data,
+        &ctx->pdr_info.blob[entry->offset + data_transfer_hndl],
         transfer_crc,
         *pldm_resp_ptr);
 
@@ -1269,53 +1913,103 @@ void handle_pldm_get_pdr_resp(
     size_t resp_len,
     pldm_fw_terminus_ctx_t *ctx)
 {
-    uint8_t idx;
     uint8_t completion_code;
     uint32_t next_record_hndl;
     uint32_t next_data_transfer_hndl;
     uint8_t transfer_flag;
     uint16_t resp_cnt;
-    uint8_t transfer_crc;
+    uint8_t transfer_crc = 0;
+    uint8_t *record;
+    uint32_t record_handle;
+    int status;
     int rc;
 
     pdr_info_t *pdr_info;
+    pldm_platform_api_t *pldm_platform_api;
+    pldm_utils_api_t *pldm_utils_api;
 
     pdr_info = &ctx->pdr_info;
-    idx = pdr_info->idx;
-
-    if (idx >= PLDM_MAX_PDR) {
-        return;
-    }
 
-    pldm_platform_api_t *pldm_platform_api;
-
-    /* get pldm base api to access required fps */
+    /* get pldm platform api to access required fps */
     pldm_platform_api = GET_PLDM_PLATFORM_API(
         pldm_fw_get_elem_ctx(PLDM_FW_BIND_PLATFORM_API_IDX));
+    pldm_utils_api =
+        GET_PLDM_UTILS_API(pldm_fw_get_elem_ctx(PLDM_FW_BIND_UTILS_API_IDX));
 
-    pdr_info->pdr[idx].sz =
-        ((pldm_get_pdr_resp_t *)pldm_resp->payload)->response_count;
-
-    pdr_info->pdr[idx].p = (uint8_t *)fwk_mm_calloc(1, pdr_info->pdr[idx].sz);
+    if (resp_len < (PLDM_MSG_HDR_T_SIZE + PLDM_GET_PDR_MIN_RESP_BYTES)) {
+        pdr_info->xfer_done = true;
+        return;
+    }
 
-    MM_ASSERT(pdr_info->pdr[idx].p);
+    /* parts of a pdr are reassembled in place, right after the last pdr */
+    resp_cnt = ((pldm_get_pdr_resp_t *)pldm_resp->payload)->response_count;
+    status = pldm_fw_pdr_reserve(
+        (void **)&pdr_info->blob,
+        &pdr_info->blob_capacity,
+        pdr_info->blob_size + pdr_info->xfer_offset + resp_cnt,
+        sizeof(uint8_t));
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(
+            MOD_NAME "no memory for pdr %" PRIu32, pdr_info->xfer_record_hndl);
+        pdr_info->xfer_done = true;
+        return;
+    }
+    record = &pdr_info->blob[pdr_info->blob_size];
 
     /* decode get_pdr response and store in ctx object */
     rc = pldm_platform_api->decode_get_pdr_resp(
         pldm_resp,
-        PLDM_GET_PDR_MIN_RESP_BYTES + pdr_info->pdr[idx].sz,
+        resp_len - PLDM_MSG_HDR_T_SIZE,
         &completion_code,
         &next_record_hndl,
         &next_data_transfer_hndl,
         &transfer_flag,
         &resp_cnt,
-        pdr_info->pdr[idx].p,
-        pdr_info->pdr[idx].sz,
+        &record[pdr_info->xfer_offset],
+        resp_cnt,
         &transfer_crc);
 
-    PLDM_ASSERT(rc);
+    if ((rc != PLDM_SUCCESS) || (completion_code != PLDM_SUCCESS)) {
+        FWK_LOG_ERR(
+            MOD_NAME "get pdr %" PRIu32 " failed: %d",
+            pdr_info->xfer_record_hndl,
+            (rc != PLDM_SUCCESS) ? rc : completion_code);
+        pdr_info->xfer_done = true;
+        return;
+    }
+
+    pdr_info->xfer_offset += resp_cnt;
 
-    ctx->pdr_info.idx++;
+    /* more parts of the same pdr to come */
+    if ((transfer_flag == PLDM_START) || (transfer_flag == PLDM_MIDDLE)) {
+        pdr_info->xfer_op_flag = PLDM_GET_NEXTPART;
+        pdr_info->xfer_data_transfer_hndl = next_data_transfer_hndl;
+        return;
+    }
+
+    if ((transfer_flag == PLDM_END) &&
+        (pldm_utils_api->crc8(record, pdr_info->xfer_offset) != transfer_crc)) {
+        FWK_LOG_ERR(
+            MOD_NAME "pdr %" PRIu32 " crc mismatch",
+            pdr_info->xfer_record_hndl);
+    } else if (pdr_info->xfer_offset >= sizeof(struct pldm_pdr_hdr)) {
+        record_handle = le32toh(((struct pldm_pdr_hdr *)record)->record_handle);
+        status = pldm_fw_pdr_index_add(
+            pdr_info,
+            record_handle,
+            pdr_info->xfer_offset,
+            pldm_utils_api->crc8(record, pdr_info->xfer_offset));
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_ERR(MOD_NAME "pdr %" PRIu32 " not stored", record_handle);
+        }
+    }
+
+    /* move on to the next pdr, if any */
+    pdr_info->xfer_offset = 0;
+    pdr_info->xfer_op_flag = PLDM_GET_FIRSTPART;
+    pdr_info->xfer_data_transfer_hndl = 0;
+    pdr_info->xfer_record_hndl = next_record_hndl;
+    pdr_info->xfer_done = (next_record_hndl == 0);
 }
 
 /* pldm get state sensor reading packet processing */
@@ -1331,6 +2025,7 @@ void handle_pldm_get_state_sensor_reading_req(
     bitfield8_t rearm_event_state;
     int rc;
     get_sensor_state_field field;
+    const struct pldm_fw_sensor_reading *reading;
 
     pldm_platform_api_t *pldm_platform_api;
 
@@ -1348,18 +2043,33 @@ void handle_pldm_get_state_sensor_reading_req(
 
     PLDM_ASSERT(rc);
 
+    reading = pldm_fw_sensor_get_state_reading(sensor_id);
+    if (reading == NULL) {
+        pldm_response_error(
+            pldm_req,
+            PLDM_PLATFORM_INVALID_SENSOR_ID,
+            pldm_resp_ptr,
+            resp_len_ptr);
+        return;
+    }
+
     /* populate size for response packet and allocate memory */
     *resp_len_ptr =
         PLDM_MSG_HDR_T_SIZE + sizeof(pldm_get_state_sensor_readings_resp_t);
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
-    /* TODO: state sensor reading */
-    field.sensor_op_state = PLDM_SENSOR_ENABLED;
-    field.present_state = PLDM_STATE_SET_HEALTH_STATE_NORMAL;
-    field.previous_state = PLDM_STATE_SET_HEALTH_STATE_NON_CRITICAL;
-    field.event_state = PLDM_SENSOR_NORMAL;
+    /* the health state follows the availability of the numeric readings */
+    field.sensor_op_state = reading->op_state;
+    field.present_state = (reading->present_state == PLDM_SENSOR_NORMAL) ?
+        PLDM_STATE_SET_HEALTH_STATE_NORMAL :
+        PLDM_SENSOR_UNKNOWN;
+    field.previous_state = (reading->previous_state == PLDM_SENSOR_NORMAL) ?
+        PLDM_STATE_SET_HEALTH_STATE_NORMAL :
+        PLDM_SENSOR_UNKNOWN;
+    field.event_state = field.present_state;
 
     /* form get_state_sensor_reading response to send to the requesting terminus
      */
@@ -1378,11 +2088,13 @@ void handle_pldm_get_sensor_reading_req(
     size_t *resp_len_ptr,
     pldm_fw_terminus_ctx_t *ctx)
 {
-    uint8_t resp_cnt = 0; // Sensor Reading Uint8
-    static uint8_t sensor_value = 0;
+    /* readings are sint32, one byte of which the response struct holds */
+    uint8_t resp_cnt = sizeof(int32_t) - 1;
+    int32_t sensor_value;
     uint16_t sensor_id = 0;
     bool8_t rearm_event_state = 0;
     int rc;
+    const struct pldm_fw_sensor_reading *reading;
 
     pldm_platform_api_t *pldm_platform_api;
 
@@ -1399,27 +2111,38 @@ void handle_pldm_get_sensor_reading_req(
 
     PLDM_ASSERT(rc);
 
+    reading = pldm_fw_sensor_get_reading(sensor_id);
+    if (reading == NULL) {
+        pldm_response_error(
+            pldm_req,
+            PLDM_PLATFORM_INVALID_SENSOR_ID,
+            pldm_resp_ptr,
+            resp_len_ptr);
+        return;
+    }
+
     /* populate size for response packet and allocate memory */
     *resp_len_ptr =
         PLDM_MSG_HDR_T_SIZE + sizeof(pldm_get_sensor_reading_resp_t) + resp_cnt;
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
-    /* TODO: sensor reading */
-    sensor_value++;
+    /* served from the cache, which is refreshed in the background */
+    sensor_value = reading->value;
 
-    /* form get_pdr response to send to the requesting terminus */
+    /* form get_sensor_reading response to send to the requesting terminus */
     rc = pldm_platform_api->encode_get_sensor_reading_resp(
         pldm_req->hdr.instance_id,
         PLDM_SUCCESS,
-        PLDM_EFFECTER_DATA_SIZE_UINT8,
-        PLDM_SENSOR_ENABLED,
+        PLDM_SENSOR_DATA_SIZE_SINT32,
+        reading->op_state,
         PLDM_NO_EVENT_GENERATION,
-        PLDM_SENSOR_NORMAL,
-        PLDM_SENSOR_NORMAL,
-        PLDM_SENSOR_NORMAL,
-        &sensor_value,
+        reading->present_state,
+        reading->previous_state,
+        reading->present_state,
+        (const uint8_t *)&sensor_value,
         *pldm_resp_ptr,
         sizeof(pldm_get_sensor_reading_resp_t) + resp_cnt);
 
@@ -1457,11 +2180,12 @@ void handle_pldm_poll_for_platform_event_message(
 
     PLDM_ASSERT(rc);
 
-    static uint8_t event_data[EVENT_MAX_SIZE];
-    static uint16_t event_id = 0;
-    static uint32_t event_size = 0;
-    static uint32_t checksum = 0;
-    static uint8_t event_class = 0;
+    /* events are transferred straight from their event queue slot */
+    const struct pldm_event *event = NULL;
+    uint8_t *event_data = NULL;
+    uint32_t event_size = 0;
+    uint32_t checksum = 0;
+    uint8_t event_class = 0;
 
     uint8_t transfer_flag = PLDM_EVENT_START;
     uint8_t completion_code = PLDM_SUCCESS;
@@ -1476,17 +2200,19 @@ void handle_pldm_poll_for_platform_event_message(
 
     switch (transfer_operation_flag) {
     case PLDM_ACKNOWLEDGEMENT_ONLY:
-        if (pldm_fw_mcp_ctx.event_queue.length > 0) {
-            xfer_id = 0xffff;
+        if (event_queue_ack(event_id_to_acknowledge) == FWK_SUCCESS) {
+            completion_code = PLDM_SUCCESS;
+
+            pldm_fw_push_polled(event_id_to_acknowledge);
         } else {
-            xfer_id = 0;
+            completion_code = PLDM_PLATFORM_EVENT_ID_NOT_VALID;
         }
 
-        if (event_id == event_id_to_acknowledge) {
-            event_id = 0; // mark event_data is empty
-            completion_code = PLDM_SUCCESS;
+        /* 0xffff tells the receiver more events are waiting */
+        if (event_queue_length() > 0) {
+            xfer_id = 0xffff;
         } else {
-            completion_code = PLDM_PLATFORM_EVENT_ID_NOT_VALID;
+            xfer_id = 0;
         }
 
         data_transfer_handle = 0;
@@ -1496,17 +2222,19 @@ void handle_pldm_poll_for_platform_event_message(
         break;
 
     case PLDM_GET_FIRSTPART:
-        if (event_id == 0) {
-            event_queue_get(
-                event_data, &event_size, &event_id, &event_class, &checksum);
-        }
+        /* the event in flight is returned until acknowledged */
+        event = event_queue_get();
 
-        if (event_id == 0) {
+        if (event == NULL) {
             // Empty Queue
-            xfer_id = event_id;
+            xfer_id = 0;
             payload_length +=
                 PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE_MIN_RESP_BYTES;
         } else {
+            event_size = event->size;
+            checksum = event->checksum;
+            event_class = event->class;
+
             // Get first event in queue
             if (event_size >= max_xfer_size) {
                 transfer_flag = PLDM_EVENT_START;
@@ -1518,7 +2246,7 @@ void handle_pldm_poll_for_platform_event_message(
                 payload_length += sizeof(checksum);
             }
 
-            xfer_id = event_id;
+            xfer_id = event->id;
             data_transfer_handle = 0;
             next_data_transfer_handle = xfer_size;
             payload_length +=
@@ -1529,7 +2257,6 @@ void handle_pldm_poll_for_platform_event_message(
     case PLDM_GET_NEXTPART:
     default:
         transfer_flag = PLDM_EVENT_MIDDLE;
-        xfer_id = event_id;
         if (event_id_to_acknowledge != 0xffff) {
             completion_code = PLDM_PLATFORM_EVENT_ID_NOT_VALID;
             xfer_size = 0;
@@ -1538,14 +2265,21 @@ void handle_pldm_poll_for_platform_event_message(
             break;
         }
 
-        if (event_id == 0x0 || data_transfer_handle > event_size) {
+        event = event_queue_get();
+        if ((event == NULL) || (data_transfer_handle > event->size)) {
             completion_code = PLDM_PLATFORM_INVALID_DATA_TRANSFER_HANDLE;
+            event = NULL;
             xfer_size = 0;
             data_transfer_handle = 0;
             next_data_transfer_handle = 0;
             break;
         }
 
+        event_size = event->size;
+        checksum = event->checksum;
+        event_class = event->class;
+        xfer_id = event->id;
+
         xfer_size = event_size - data_transfer_handle;
         if (xfer_size > max_xfer_size) {
             xfer_size = max_xfer_size;
@@ -1561,11 +2295,16 @@ void handle_pldm_poll_for_platform_event_message(
         break;
     }
 
+    if (event != NULL) {
+        event_data = (uint8_t *)&event->data[data_transfer_handle];
+    }
+
     /* populate size for response packet and allocate memory */
     *resp_len_ptr = PLDM_MSG_HDR_T_SIZE + payload_length;
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     rc = pldm_platform_api->encode_poll_for_platform_event_message_resp(
         pldm_req->hdr.instance_id,
@@ -1576,7 +2315,7 @@ void handle_pldm_poll_for_platform_event_message(
         transfer_flag,
         event_class,
         xfer_size,
-        &event_data[data_transfer_handle],
+        event_data,
         checksum,
         *pldm_resp_ptr,
         payload_length);
@@ -1647,9 +2386,10 @@ void handle_pldm_platform_event_message_req(
     /* encode response packet */
     *resp_len_ptr =
         PLDM_MSG_HDR_T_SIZE + sizeof(pldm_platform_event_message_resp_t);
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_alloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     completion_code = PLDM_SUCCESS;
     status = PLDM_EVENT_LOGGED;
@@ -1672,7 +2412,8 @@ void handle_pldm_platform_event_message_req(
 
 void handle_pldm_platform_event_message_resp(
     pldm_msg_t *pldm_resp,
-    size_t resp_len)
+    size_t resp_len,
+    pldm_fw_terminus_ctx_t *ctx)
 {
     uint8_t completion_code = PLDM_SUCCESS;
     uint8_t status = PLDM_EVENT_NO_LOGGING;
@@ -1686,6 +2427,10 @@ void handle_pldm_platform_event_message_resp(
         pldm_resp, resp_len, &completion_code, &status);
 
     PLDM_ASSERT(rc);
+
+    if (rc == PLDM_SUCCESS) {
+        pldm_fw_push_complete(pldm_resp->hdr.instance_id, completion_code);
+    }
 }
 
 /* pldm event message buffer packet processing */
@@ -1717,9 +2462,10 @@ void handle_pldm_event_message_buffer_req(
     /* populate size for response packet and allocate memory */
     *resp_len_ptr =
         PLDM_MSG_HDR_T_SIZE + sizeof(pldm_event_message_buffer_size_resp_t);
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* encode response packet */
     rc = pldm_platform_api->encode_event_message_buffer_size_resp(
@@ -1772,9 +2518,10 @@ void handle_pldm_get_fru_record_table(
     *resp_len_ptr = PLDM_MSG_HDR_T_SIZE +
         sizeof(pldm_get_fru_record_table_resp_t) - 1 + fru_record_table_size +
         pad + 4; // 4 for crc
-    *pldm_resp_ptr = (pldm_msg_t *)fwk_mm_calloc(1, *resp_len_ptr);
-
-    MM_ASSERT(*pldm_resp_ptr);
+    *pldm_resp_ptr = pldm_fw_get_resp_buffer(*resp_len_ptr);
+    if (*pldm_resp_ptr == NULL) {
+        return;
+    }
 
     /* encode response packet */
     rc = pldm_fru_api->encode_get_fru_record_table_resp(
@@ -1819,151 +2566,316 @@ void pldm_fw_send_next_request(pldm_fw_terminus_ctx_t *ctx)
     }
 }
 
-/*
- * implements request - response framework (From here on rr fwk). rr fwk helps
- * identify a received packet to be either a request or a response. Once
- * identified, they are passed onto their corresponding handlers. For request
- * packets, a well formed response packet is expected at the end of processing.
- * This response packet is layer passed onto the transport layer to carry on
- * with pldm transactions.
- */
-void process_pldm_packet(
-    pldm_msg_t *pldm_packet,
-    size_t len,
+/* handler for a request, which encodes a response into the arena */
+typedef void (*pldm_fw_req_handler_t)(
+    pldm_msg_t *pldm_req,
+    size_t req_len,
     pldm_msg_t **pldm_resp_ptr,
-    uint16_t hash,
     size_t *resp_len_ptr,
-    pldm_fw_terminus_ctx_t *ctx)
-{
-    switch (hash) {
-    case PLDM_HASH(PLDM_BASE, PLDM_SET_TID):
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_set_tid_req(
-                pldm_packet, pldm_resp_ptr, resp_len_ptr, ctx);
-        }
-        break;
+    pldm_fw_terminus_ctx_t *ctx);
 
-    case PLDM_HASH(PLDM_BASE, PLDM_GET_TID):
+/* handler for a response to a request sent by pldm_fw */
+typedef void (*pldm_fw_resp_handler_t)(
+    pldm_msg_t *pldm_resp,
+    size_t resp_len,
+    pldm_fw_terminus_ctx_t *ctx);
 
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_tid_req(
-                pldm_packet, pldm_resp_ptr, resp_len_ptr, ctx);
-        } else {
-            handle_pldm_get_tid_resp(pldm_packet, ctx);
-        }
-        break;
+/* registration of a pldm command with its handlers */
+typedef struct pldm_fw_cmd {
+    uint8_t type;
+    uint8_t command;
+    /* minimum request payload length, excluding the pldm header */
+    size_t min_req_len;
+    /* NULL if requests for the command are not supported */
+    pldm_fw_req_handler_t handle_req;
+    /* NULL if responses for the command are not expected */
+    pldm_fw_resp_handler_t handle_resp;
+} pldm_fw_cmd_t;
+
+/* per-command statistics, in trace driver counts for handler times */
+typedef struct pldm_fw_cmd_stats {
+    uint32_t calls;
+    uint32_t errors;
+    fwk_trace_count_t min_time;
+    fwk_trace_count_t max_time;
+    fwk_trace_count_t total_time;
+} pldm_fw_cmd_stats_t;
+
+/* commands handled by pldm_fw */
+static const pldm_fw_cmd_t pldm_fw_cmds[] = {
+    { PLDM_BASE, PLDM_SET_TID, 1, handle_pldm_set_tid_req, NULL },
+    { PLDM_BASE,
+      PLDM_GET_TID,
+      0,
+      handle_pldm_get_tid_req,
+      handle_pldm_get_tid_resp },
+    { PLDM_BASE,
+      PLDM_GET_PLDM_TYPES,
+      0,
+      handle_pldm_get_pldm_types_req,
+      handle_pldm_get_pldm_types_resp },
+    { PLDM_BASE,
+      PLDM_GET_PLDM_VERSION,
+      PLDM_GET_VERSION_REQ_BYTES,
+      handle_pldm_get_version_req,
+      handle_pldm_get_version_resp },
+    { PLDM_BASE,
+      PLDM_GET_PLDM_COMMANDS,
+      PLDM_GET_COMMANDS_REQ_BYTES,
+      handle_pldm_get_commands_req,
+      handle_pldm_get_commands_resp },
+    { PLDM_PLATFORM,
+      PLDM_SET_EVENT_RECEIVER,
+      PLDM_SET_EVENT_RECEIVER_REQ_BYTES,
+      handle_pldm_set_event_receiver_req,
+      handle_pldm_set_event_receiver_resp },
+    { PLDM_PLATFORM,
+      PLDM_GET_EVENT_RECEIVER,
+      0,
+      handle_pldm_get_event_receiver_req,
+      NULL },
+    { PLDM_PLATFORM,
+      PLDM_GET_PDR,
+      PLDM_GET_PDR_REQ_BYTES,
+      handle_pldm_get_pdr_req,
+      handle_pldm_get_pdr_resp },
+    { PLDM_PLATFORM,
+      PLDM_GET_SENSOR_READING,
+      PLDM_GET_SENSOR_READING_REQ_BYTES,
+      handle_pldm_get_sensor_reading_req,
+      NULL },
+    { PLDM_PLATFORM,
+      PLDM_GET_STATE_SENSOR_READINGS,
+      PLDM_GET_STATE_SENSOR_READINGS_REQ_BYTES,
+      handle_pldm_get_state_sensor_reading_req,
+      NULL },
+    { PLDM_PLATFORM,
+      PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE,
+      PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE_REQ_BYTES,
+      handle_pldm_poll_for_platform_event_message,
+      NULL },
+    { PLDM_PLATFORM,
+      PLDM_PLATFORM_EVENT_MESSAGE,
+      PLDM_PLATFORM_EVENT_MESSAGE_MIN_REQ_BYTES,
+      handle_pldm_platform_event_message_req,
+      handle_pldm_platform_event_message_resp },
+    { PLDM_PLATFORM,
+      PLDM_EVENT_MESSAGE_BUFFER_SIZE,
+      PLDM_EVENT_MESSAGE_BUFFER_SIZE_REQ_BYTES,
+      handle_pldm_event_message_buffer_req,
+      NULL },
+    /* data transfer handle and transfer operation flag */
+    { PLDM_FRU,
+      PLDM_GET_FRU_RECORD_TABLE,
+      5,
+      handle_pldm_get_fru_record_table,
+      NULL },
+};
 
-    case PLDM_HASH(PLDM_PLATFORM, PLDM_SET_EVENT_RECEIVER):
+/*
+ * open-addressed hash of PLDM_HASH(type, command) to the index of the command
+ * in pldm_fw_cmds plus one, zero marking an empty slot. Built at init.
+ */
+#define PLDM_FW_CMD_SLOTS 32U
 
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_set_event_receiver_req(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        } else {
-            handle_pldm_set_event_receiver_resp(pldm_packet, len, ctx);
-        }
-        break;
+static uint8_t pldm_fw_cmd_slots[PLDM_FW_CMD_SLOTS];
+static pldm_fw_cmd_stats_t pldm_fw_cmd_stats[FWK_ARRAY_SIZE(pldm_fw_cmds)];
+static uint32_t pldm_fw_unsupported_count;
+static fwk_trace_count_t (*pldm_fw_get_trace_count)(void);
 
-    case PLDM_HASH(PLDM_BASE, PLDM_GET_PLDM_TYPES):
+static_assert(
+    FWK_ARRAY_SIZE(pldm_fw_cmds) < PLDM_FW_CMD_SLOTS,
+    "PLDM_FW_CMD_SLOTS too small for the command table");
 
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_pldm_types_req(
-                pldm_packet, pldm_resp_ptr, resp_len_ptr, ctx);
-        } else {
-            handle_pldm_get_pldm_types_resp(pldm_packet, ctx);
+static unsigned int pldm_fw_cmd_slot(uint16_t hash)
+{
+    /* type is in the upper byte, fold it onto the command */
+    return (hash ^ (hash >> 5)) & (PLDM_FW_CMD_SLOTS - 1);
+}
+
+static void pldm_fw_cmd_table_init(void)
+{
+    unsigned int idx;
+    unsigned int slot;
+
+    for (idx = 0; idx < FWK_ARRAY_SIZE(pldm_fw_cmds); idx++) {
+        slot = pldm_fw_cmd_slot(
+            PLDM_HASH(pldm_fw_cmds[idx].type, pldm_fw_cmds[idx].command));
+        while (pldm_fw_cmd_slots[slot] != 0) {
+            slot = (slot + 1) & (PLDM_FW_CMD_SLOTS - 1);
         }
-        break;
+        pldm_fw_cmd_slots[slot] = (uint8_t)(idx + 1);
+    }
+
+    pldm_fw_get_trace_count = fmw_trace_driver().get_trace_count;
+}
 
-    case PLDM_HASH(PLDM_BASE, PLDM_GET_PLDM_VERSION):
+/* returns the index of the command in pldm_fw_cmds, or -1 if unsupported */
+static int pldm_fw_cmd_find(uint16_t hash)
+{
+    unsigned int slot = pldm_fw_cmd_slot(hash);
+    const pldm_fw_cmd_t *cmd;
 
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_version_req(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        } else {
-            handle_pldm_get_version_resp(pldm_packet, len, ctx);
+    while (pldm_fw_cmd_slots[slot] != 0) {
+        cmd = &pldm_fw_cmds[pldm_fw_cmd_slots[slot] - 1];
+        if (PLDM_HASH(cmd->type, cmd->command) == hash) {
+            return pldm_fw_cmd_slots[slot] - 1;
         }
-        break;
+        slot = (slot + 1) & (PLDM_FW_CMD_SLOTS - 1);
+    }
 
-    case PLDM_HASH(PLDM_BASE, PLDM_GET_PLDM_COMMANDS):
+    return -1;
+}
 
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_commands_req(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        } else {
-            handle_pldm_get_commands_resp(pldm_packet, len, ctx);
-        }
-        break;
+static void pldm_fw_cmd_stats_update(
+    pldm_fw_cmd_stats_t *stats,
+    fwk_trace_count_t start,
+    bool error)
+{
+    fwk_trace_count_t time;
 
-    case PLDM_HASH(PLDM_PLATFORM, PLDM_GET_PDR):
+    stats->calls++;
+    if (error) {
+        stats->errors++;
+    }
 
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_pdr_req(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        } else {
-            handle_pldm_get_pdr_resp(pldm_packet, len, ctx);
-        }
-        break;
+    if (pldm_fw_get_trace_count == NULL) {
+        return;
+    }
 
-    case PLDM_HASH(PLDM_PLATFORM, PLDM_GET_SENSOR_READING):
+    time = pldm_fw_get_trace_count() - start;
+    if ((stats->calls == 1) || (time < stats->min_time)) {
+        stats->min_time = time;
+    }
+    if (time > stats->max_time) {
+        stats->max_time = time;
+    }
+    stats->total_time += time;
+}
 
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_sensor_reading_req(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        }
-        break;
+/*
+ * implements request - response framework (From here on rr fwk). rr fwk helps
+ * identify a received packet to be either a request or a response. Once
+ * identified, they are passed onto their corresponding handlers looked up from
+ * pldm_fw_cmds. For request packets, a well formed response packet is expected
+ * at the end of processing. This response packet is layer passed onto the
+ * transport layer to carry on with pldm transactions.
+ */
+void process_pldm_packet(
+    pldm_msg_t *pldm_packet,
+    size_t len,
+    pldm_msg_t **pldm_resp_ptr,
+    uint16_t hash,
+    size_t *resp_len_ptr,
+    pldm_fw_terminus_ctx_t *ctx)
+{
+    const pldm_fw_cmd_t *cmd;
+    fwk_trace_count_t start = 0;
+    bool error = false;
+    int idx;
 
-    case PLDM_HASH(PLDM_PLATFORM, PLDM_GET_STATE_SENSOR_READINGS):
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_state_sensor_reading_req(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        }
-        break;
+    idx = pldm_fw_cmd_find(hash);
+    cmd = (idx < 0) ? NULL : &pldm_fw_cmds[idx];
 
-    case PLDM_HASH(PLDM_PLATFORM, PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE):
+    if ((cmd == NULL) ||
+        ((pldm_resp_ptr != NULL) ? (cmd->handle_req == NULL) :
+                                   (cmd->handle_resp == NULL))) {
+        FWK_LOG_INFO(MOD_NAME "PLDM_ERROR_UNSUPPORTED_PLDM_CMD");
+        pldm_fw_unsupported_count++;
         if (pldm_resp_ptr != NULL) {
-            handle_pldm_poll_for_platform_event_message(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
+            pldm_response_unsupport(pldm_packet, pldm_resp_ptr, resp_len_ptr);
         }
-        break;
+        return;
+    }
 
-    case PLDM_HASH(PLDM_PLATFORM, PLDM_PLATFORM_EVENT_MESSAGE):
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_platform_event_message_req(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        } else {
-            handle_pldm_platform_event_message_resp(pldm_packet, len);
-        }
-        break;
+    if (pldm_fw_get_trace_count != NULL) {
+        start = pldm_fw_get_trace_count();
+    }
 
-    case PLDM_HASH(PLDM_PLATFORM, PLDM_GET_EVENT_RECEIVER):
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_event_receiver_req(
-                pldm_packet, pldm_resp_ptr, resp_len_ptr, ctx);
-        }
-        break;
+    if (pldm_resp_ptr == NULL) {
+        cmd->handle_resp(pldm_packet, len, ctx);
+    } else if (len < (PLDM_MSG_HDR_T_SIZE + cmd->min_req_len)) {
+        pldm_response_error(
+            pldm_packet, PLDM_ERROR_INVALID_LENGTH, pldm_resp_ptr, resp_len_ptr);
+        error = true;
+    } else {
+        cmd->handle_req(pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
 
-    case PLDM_HASH(PLDM_PLATFORM, PLDM_EVENT_MESSAGE_BUFFER_SIZE):
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_event_message_buffer_req(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        }
-        break;
+        /* the completion code is the first byte of every response payload */
+        error = (*pldm_resp_ptr == NULL) ||
+            ((*pldm_resp_ptr)->payload[0] != PLDM_SUCCESS);
+    }
 
-    case PLDM_HASH(PLDM_FRU, PLDM_GET_FRU_RECORD_TABLE):
-        if (pldm_resp_ptr != NULL) {
-            handle_pldm_get_fru_record_table(
-                pldm_packet, len, pldm_resp_ptr, resp_len_ptr, ctx);
-        }
-        break;
+    pldm_fw_cmd_stats_update(&pldm_fw_cmd_stats[idx], start, error);
+}
 
-    default:
-        FWK_LOG_INFO(MOD_NAME "PLDM_ERROR_UNSUPPORTED_PLDM_CMD");
-        if (pldm_resp_ptr != NULL) {
-            pldm_response_unsupport(pldm_packet, pldm_resp_ptr, resp_len_ptr);
-        }
-        break;
+#ifdef BUILD_HAS_DEBUGGER
+/* prints per-command statistics, handler times are in trace driver counts */
+static void pldm_fw_print_stats(void)
+{
+    const pldm_fw_cmd_stats_t *stats;
+    uint32_t avg;
+
+    cli_printf(
+        NONE,
+        "%4s %4s %8s %8s %10s %10s %10s\n",
+        "type",
+        "cmd",
+        "calls",
+        "errors",
+        "min",
+        "avg",
+        "max");
+
+    for (size_t i = 0; i < FWK_ARRAY_SIZE(pldm_fw_cmds); i++) {
+        stats = &pldm_fw_cmd_stats[i];
+        avg = (stats->calls == 0) ?
+            0 :
+            (uint32_t)(stats->total_time / stats->calls);
+
+        cli_printf(
+            NONE,
+            "%4u %4u %8u %8u %10u %10u %10u\n",
+            (unsigned int)pldm_fw_cmds[i].type,
+            (unsigned int)pldm_fw_cmds[i].command,
+            (unsigned int)stats->calls,
+            (unsigned int)stats->errors,
+            (unsigned int)stats->min_time,
+            (unsigned int)avg,
+            (unsigned int)stats->max_time);
     }
+
+    cli_printf(
+        NONE, "unsupported: %u\n", (unsigned int)pldm_fw_unsupported_count);
 }
 
+/* prints the platform event queue counters, the age is in microseconds */
+static void pldm_fw_print_event_stats(void)
+{
+    struct pldm_event_queue_stats stats;
+
+    event_queue_get_stats(&stats);
+
+    cli_printf(NONE, "queued: %u\n", (unsigned int)stats.length);
+    cli_printf(NONE, "peak: %u\n", (unsigned int)stats.peak_length);
+    cli_printf(
+        NONE, "dropped oldest: %u\n", (unsigned int)stats.dropped_oldest);
+    cli_printf(NONE, "dropped: %u\n", (unsigned int)stats.dropped);
+    cli_printf(
+        NONE,
+        "oldest age: %u\n",
+        (unsigned int)(stats.oldest_age / FWK_US(1)));
+
+    cli_printf(
+        NONE, "push: %s\n", pldm_fw_ctx.push.enabled ? "enabled" : "disabled");
+    cli_printf(NONE, "pushed: %u\n", (unsigned int)pldm_fw_ctx.push.pushed);
+    cli_printf(
+        NONE, "coalesced: %u\n", (unsigned int)pldm_fw_ctx.push.coalesced);
+    cli_printf(NONE, "retried: %u\n", (unsigned int)pldm_fw_ctx.push.retried);
+    cli_printf(NONE, "failed: %u\n", (unsigned int)pldm_fw_ctx.push.failed);
+}
+#endif
+
 /* receive's data from transport layer and processes it accordingly */
 static void pldm_fw_receive_from_transport_layer(
     void *data,
@@ -1984,14 +2896,15 @@ static void pldm_fw_receive_from_transport_layer(
     (void)msg;
     (void)buf;
 
-    FWK_LOG_INFO(MOD_NAME "Request : %d from %ld", msg->hdr.request, *bus);
+    FWK_LOG_INFO(
+        MOD_NAME "Request : %d from %" PRIu32, msg->hdr.request, *bus);
     FWK_LOG_INFO(MOD_NAME "Instance_id : %d ", msg->hdr.instance_id);
     FWK_LOG_INFO(MOD_NAME "Type : %d ", msg->hdr.type);
     FWK_LOG_INFO(MOD_NAME "Ver : %d ", msg->hdr.header_ver);
     FWK_LOG_INFO(MOD_NAME "Command : %d ", msg->hdr.command);
 
 #if FWK_LOG_LEVEL < FWK_LOG_LEVEL_INFO
-    FWK_LOG_DEBUG(MOD_NAME "Rx Len : %d ", len);
+    FWK_LOG_DEBUG(MOD_NAME "Rx Len : %u ", (unsigned int)len);
     for (size = 0; size < len; size++) {
         FWK_LOG_DEBUG("Rx: 0x%02x ", buf[size]);
     }
@@ -2008,11 +2921,17 @@ static void pldm_fw_receive_from_transport_layer(
      * no addtional fields.
      * */
     if (request == PLDM_REQUEST) {
+        fwk_assert(*bus < MCTP_FW_BIND_API_IDX_COUNT);
+        pldm_fw_ctx.resp_arena_active = pldm_fw_ctx.resp_arena[*bus];
+        pldm_fw_ctx.active_bus = *bus;
+
         process_pldm_packet(
             pldm_packet, len, &pldm_resp, hash, &size, &pldm_fw_mcp_ctx);
-        send_pldm_packet(*bus, 0, 0, pldm_resp, size);
+        if (pldm_resp == NULL) {
+            pldm_response_error(pldm_packet, PLDM_ERROR, &pldm_resp, &size);
+        }
 
-        fwk_mm_free(pldm_resp);
+        send_pldm_resp(*bus, pldm_resp, size);
     } else {
         process_pldm_packet(
             pldm_packet, len, NULL, hash, &size, &pldm_fw_bmc_mcp_ctx);
@@ -2046,8 +2965,15 @@ static int pldm_fw_process_bind_request(
 /* start off pldm handshakes starting from discovery */
 static int pldm_fw_start(fwk_id_t id)
 {
+#ifdef BUILD_HAS_DEBUGGER
     int status;
     uint32_t index;
+#endif
+
+    /* sensors are described before mcp_init() generates their pdrs */
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return pldm_fw_sensor_start(id);
+    }
 
     if (fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT) &&
         fwk_id_get_element_idx(id) == PLDM_FW_BIND_BASE_API_IDX) {
@@ -2084,6 +3010,21 @@ static int pldm_fw_bind(fwk_id_t id, unsigned int round)
     int status = FWK_SUCCESS;
     pldm_fw_elem_ctx_t *elem_ctx;
 
+    if (round == 0 && fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+#ifdef BUILD_HAS_MOD_TIMER
+        if (pldm_fw_push_supported()) {
+            status = fwk_module_bind(
+                pldm_fw_ctx.config->event_alarm_id,
+                MOD_TIMER_API_ID_ALARM,
+                &pldm_fw_alarm_api);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+#endif
+        return pldm_fw_sensor_bind();
+    }
+
     if (round == 0 && fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
         elem_ctx = pldm_fw_get_elem_ctx(fwk_id_get_element_idx(id));
 
@@ -2150,6 +3091,23 @@ static int pldm_fw_init(
     unsigned int elem_count,
     const void *config)
 {
+    const pldm_fw_config_t *fw_config = config;
+    int status;
+
+    status = event_queue_init(
+        (fw_config != NULL) ? fw_config->event_queue_size :
+                              PLDM_FW_EVENT_QUEUE_DEFAULT_SIZE);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    pldm_fw_ctx.config = fw_config;
+
+    status = pldm_fw_sensor_init(fw_config);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
     pldm_fw_ctx.elem_ctx_table =
         fwk_mm_calloc(elem_count, sizeof(pldm_fw_ctx.elem_ctx_table[0]));
 
@@ -2160,6 +3118,9 @@ static int pldm_fw_init(
     }
 
     pldm_fw_ctx.elem_count = elem_count;
+
+    pldm_fw_cmd_table_init();
+
     return FWK_SUCCESS;
 }
 
@@ -2182,25 +3143,54 @@ static int pldm_fw_process_event(const struct fwk_event *event,
                                   struct fwk_event *resp)
 {
     int rc = 0;
+
+    /* response to a sensor reading started by the cache refresh */
+    if (pldm_fw_sensor_read_complete(event)) {
+        return FWK_SUCCESS;
+    }
+
     switch (fwk_id_get_event_idx(event->id)) {
     case PLDM_FW_EVENT_IDX_PLDM_EVENT_MESSAGE:
+        if (pldm_fw_ctx.push.enabled) {
+            pldm_fw_push_schedule();
+            return FWK_SUCCESS;
+        }
+
         rc = send_pldm_platform_event_message(1, 0);
         if (rc != FWK_SUCCESS) {
             FWK_LOG_ERR(MOD_NAME "Sending pldm platform event message failed : %d.", rc);
         }
         return FWK_SUCCESS;
+    case PLDM_FW_EVENT_IDX_SENSOR_REFRESH:
+        pldm_fw_sensor_refresh();
+        return FWK_SUCCESS;
+    case PLDM_FW_EVENT_IDX_EVENT_PUSH:
+        pldm_fw_push_alarm();
+        return FWK_SUCCESS;
     default:
         FWK_LOG_ERR(MOD_NAME "Invalid event request: %s.", FWK_ID_STR(event->id));
         return FWK_E_PARAM;
     }
 }
 
+/*
+ * Sensor cache refreshes are background work and must not delay the PLDM
+ * requests received through the MCTP binding.
+ */
+static const enum fwk_event_priority
+    pldm_fw_event_priorities[PLDM_FW_EVENT_IDX_COUNT] = {
+        [PLDM_FW_EVENT_IDX_PLDM_EVENT_MESSAGE] = FWK_EVENT_PRIORITY_NORMAL,
+        [PLDM_FW_EVENT_IDX_SENSOR_REFRESH] = FWK_EVENT_PRIORITY_LOW,
+        [PLDM_FW_EVENT_IDX_EVENT_PUSH] = FWK_EVENT_PRIORITY_NORMAL,
+    };
+
 /* module description */
 const struct fwk_module module_pldm_fw = {
     .type = FWK_MODULE_TYPE_SERVICE,
     .init = pldm_fw_init,
     .api_count = PLDM_FW_BIND_REQ_API_IDX_COUNT,
     .event_count = PLDM_FW_EVENT_IDX_COUNT,
+    .event_priorities = pldm_fw_event_priorities,
     .element_init = pldm_fw_elem_init,
     .bind = pldm_fw_bind,
     .start = pldm_fw_start,
@@ -0,0 +1,479 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2022, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/mod_pldm_fw_int.h>
+
+#include <mod_pldm.h>
+#include <mod_pldm_fw.h>
+
+#include <fwk_status.h>
+
+#if defined(BUILD_HAS_MOD_SENSOR) && defined(BUILD_HAS_MOD_TIMER)
+
+#    include <mod_sensor.h>
+#    include <mod_timer.h>
+
+#    include <fwk_core.h>
+#    include <fwk_event.h>
+#    include <fwk_id.h>
+#    include <fwk_mm.h>
+#    include <fwk_module.h>
+#    include <fwk_module_idx.h>
+
+#    include <stdbool.h>
+#    include <stddef.h>
+#    include <stdint.h>
+#    include <string.h>
+
+/* pldm base unit used for sensor types beyond the ones shared with scmi */
+#    define PLDM_FW_SENSOR_UNIT_UNSPECIFIED 1
+
+struct pldm_fw_sensor_ctx {
+    const pldm_fw_sensor_config_t *config;
+
+    /* written by the sensor module when a pending reading completes */
+    struct mod_sensor_data data;
+
+    struct pldm_fw_sensor_reading reading;
+
+    /* pdr description of the sensor, taken from the sensor information */
+    uint8_t base_unit;
+    int8_t unit_modifier;
+
+    uint32_t interval_ms;
+    uint32_t elapsed_ms;
+    bool read_pending;
+};
+
+static struct {
+    const pldm_fw_config_t *config;
+    struct pldm_fw_sensor_ctx *ctx_table;
+
+    const struct mod_sensor_api *sensor_api;
+    const struct mod_timer_alarm_api *alarm_api;
+
+    /* set by the alarm until the refresh event has been processed */
+    volatile bool refresh_pending;
+} pldm_fw_sensor;
+
+static int32_t pldm_fw_sensor_clamp(mod_sensor_value_t value)
+{
+#    ifdef BUILD_HAS_SENSOR_SIGNED_VALUE
+    if (value < INT32_MIN) {
+        return INT32_MIN;
+    }
+#    endif
+    if (value > INT32_MAX) {
+        return INT32_MAX;
+    }
+
+    return (int32_t)value;
+}
+
+static void pldm_fw_sensor_update(struct pldm_fw_sensor_ctx *ctx, int status)
+{
+    struct pldm_fw_sensor_reading *reading = &ctx->reading;
+
+    reading->previous_state = reading->present_state;
+
+    if (status == FWK_SUCCESS) {
+        reading->value = pldm_fw_sensor_clamp(ctx->data.value);
+        reading->op_state = PLDM_SENSOR_ENABLED;
+        reading->present_state = PLDM_SENSOR_NORMAL;
+    } else {
+        reading->op_state = PLDM_SENSOR_UNAVAILABLE;
+        reading->present_state = PLDM_SENSOR_UNKNOWN;
+    }
+}
+
+static void pldm_fw_sensor_alarm_callback(uintptr_t module_idx)
+{
+    struct fwk_event_light event;
+
+    if (pldm_fw_sensor.refresh_pending) {
+        return;
+    }
+
+    event = (struct fwk_event_light){
+        .id = FWK_ID_EVENT(module_idx, PLDM_FW_EVENT_IDX_SENSOR_REFRESH),
+        .source_id = FWK_ID_MODULE(module_idx),
+        .target_id = FWK_ID_MODULE(module_idx),
+    };
+
+    pldm_fw_sensor.refresh_pending = true;
+
+    if (fwk_put_event(&event) != FWK_SUCCESS) {
+        pldm_fw_sensor.refresh_pending = false;
+    }
+}
+
+int pldm_fw_sensor_init(const pldm_fw_config_t *config)
+{
+    struct pldm_fw_sensor_ctx *ctx;
+    unsigned int i;
+
+    if ((config == NULL) || (config->sensor_count == 0)) {
+        return FWK_SUCCESS;
+    }
+
+    if ((config->sensors == NULL) || (config->sensor_tick_ms == 0)) {
+        return FWK_E_PARAM;
+    }
+
+    pldm_fw_sensor.config = config;
+    pldm_fw_sensor.ctx_table =
+        fwk_mm_calloc(config->sensor_count, sizeof(pldm_fw_sensor.ctx_table[0]));
+
+    for (i = 0; i < config->sensor_count; i++) {
+        ctx = &pldm_fw_sensor.ctx_table[i];
+        ctx->config = &config->sensors[i];
+        ctx->reading.op_state = PLDM_SENSOR_UNAVAILABLE;
+        ctx->reading.present_state = PLDM_SENSOR_UNKNOWN;
+        ctx->reading.previous_state = PLDM_SENSOR_UNKNOWN;
+    }
+
+    return FWK_SUCCESS;
+}
+
+int pldm_fw_sensor_bind(void)
+{
+    int status;
+
+    if (pldm_fw_sensor.config == NULL) {
+        return FWK_SUCCESS;
+    }
+
+    status = fwk_module_bind(
+        FWK_ID_MODULE(FWK_MODULE_IDX_SENSOR),
+        mod_sensor_api_id_sensor,
+        &pldm_fw_sensor.sensor_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    return fwk_module_bind(
+        pldm_fw_sensor.config->sensor_alarm_id,
+        MOD_TIMER_API_ID_ALARM,
+        &pldm_fw_sensor.alarm_api);
+}
+
+int pldm_fw_sensor_start(fwk_id_t module_id)
+{
+    const pldm_fw_config_t *config = pldm_fw_sensor.config;
+    struct mod_sensor_complete_info info;
+    struct pldm_fw_sensor_ctx *ctx;
+    unsigned int i;
+    int status;
+
+    if (config == NULL) {
+        return FWK_SUCCESS;
+    }
+
+    for (i = 0; i < config->sensor_count; i++) {
+        ctx = &pldm_fw_sensor.ctx_table[i];
+
+        status = pldm_fw_sensor.sensor_api->get_info(
+            ctx->config->sensor_id, &info);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        ctx->base_unit = (info.hal_info.type <= MOD_SENSOR_TYPE_SECONDS) ?
+            (uint8_t)info.hal_info.type :
+            PLDM_FW_SENSOR_UNIT_UNSPECIFIED;
+        ctx->unit_modifier = (int8_t)info.hal_info.unit_multiplier;
+
+        /* sensors without a minimum interval are read on every tick */
+        ctx->interval_ms = mod_sensor_update_interval_ms(&info.hal_info);
+        if (ctx->interval_ms < config->sensor_tick_ms) {
+            ctx->interval_ms = config->sensor_tick_ms;
+        }
+
+        /* read everything on the first tick */
+        ctx->elapsed_ms = ctx->interval_ms - config->sensor_tick_ms;
+    }
+
+    return pldm_fw_sensor.alarm_api->start(
+        config->sensor_alarm_id,
+        config->sensor_tick_ms,
+        MOD_TIMER_ALARM_TYPE_PERIODIC,
+        pldm_fw_sensor_alarm_callback,
+        fwk_id_get_module_idx(module_id));
+}
+
+void pldm_fw_sensor_refresh(void)
+{
+    const pldm_fw_config_t *config = pldm_fw_sensor.config;
+    struct pldm_fw_sensor_ctx *ctx;
+    unsigned int i;
+    int status;
+
+    pldm_fw_sensor.refresh_pending = false;
+
+    if (config == NULL) {
+        return;
+    }
+
+    for (i = 0; i < config->sensor_count; i++) {
+        ctx = &pldm_fw_sensor.ctx_table[i];
+
+        ctx->elapsed_ms += config->sensor_tick_ms;
+        if ((ctx->elapsed_ms < ctx->interval_ms) || ctx->read_pending) {
+            continue;
+        }
+        ctx->elapsed_ms = 0;
+
+        /* sensors sampled by the sensor module are not read again */
+        if (pldm_fw_sensor.sensor_api->get_snapshot != NULL) {
+            status = pldm_fw_sensor.sensor_api->get_snapshot(
+                ctx->config->sensor_id, &ctx->data);
+            if (status == FWK_SUCCESS) {
+                pldm_fw_sensor_update(ctx, ctx->data.status);
+                continue;
+            }
+        }
+
+        /*
+         * a reading taken by another user of the sensor since the previous
+         * refresh is reused, the reading of the previous refresh is not
+         */
+        status = pldm_fw_sensor.sensor_api->get_data_max_age(
+            ctx->config->sensor_id,
+            (fwk_duration_us_t)(ctx->interval_ms - config->sensor_tick_ms) *
+                1000,
+            &ctx->data);
+        if (status == FWK_PENDING) {
+            /* completed by pldm_fw_sensor_read_complete() */
+            ctx->read_pending = true;
+        } else {
+            pldm_fw_sensor_update(ctx, status);
+        }
+    }
+}
+
+bool pldm_fw_sensor_read_complete(const struct fwk_event *event)
+{
+    const pldm_fw_config_t *config = pldm_fw_sensor.config;
+    struct pldm_fw_sensor_ctx *ctx;
+    unsigned int i;
+
+    if ((config == NULL) ||
+        !fwk_id_is_equal(event->id, mod_sensor_event_id_read_request)) {
+        return false;
+    }
+
+    for (i = 0; i < config->sensor_count; i++) {
+        ctx = &pldm_fw_sensor.ctx_table[i];
+        if (ctx->read_pending &&
+            fwk_id_is_equal(ctx->config->sensor_id, event->source_id)) {
+            ctx->read_pending = false;
+            pldm_fw_sensor_update(ctx, ctx->data.status);
+            break;
+        }
+    }
+
+    return true;
+}
+
+static struct pldm_fw_sensor_ctx *pldm_fw_sensor_find(
+    uint16_t pldm_sensor_id,
+    bool state_sensor)
+{
+    const pldm_fw_sensor_config_t *sensor;
+    unsigned int i;
+
+    if (pldm_fw_sensor.config == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < pldm_fw_sensor.config->sensor_count; i++) {
+        sensor = pldm_fw_sensor.ctx_table[i].config;
+        if (state_sensor ? (sensor->pldm_state_sensor_id == pldm_sensor_id) :
+                           (sensor->pldm_sensor_id == pldm_sensor_id)) {
+            return &pldm_fw_sensor.ctx_table[i];
+        }
+    }
+
+    return NULL;
+}
+
+const struct pldm_fw_sensor_reading *pldm_fw_sensor_get_reading(
+    uint16_t pldm_sensor_id)
+{
+    struct pldm_fw_sensor_ctx *ctx = pldm_fw_sensor_find(pldm_sensor_id, false);
+
+    return (ctx == NULL) ? NULL : &ctx->reading;
+}
+
+const struct pldm_fw_sensor_reading *pldm_fw_sensor_get_state_reading(
+    uint16_t pldm_state_sensor_id)
+{
+    struct pldm_fw_sensor_ctx *ctx;
+
+    if (pldm_state_sensor_id == 0) {
+        return NULL;
+    }
+
+    ctx = pldm_fw_sensor_find(pldm_state_sensor_id, true);
+
+    return (ctx == NULL) ? NULL : &ctx->reading;
+}
+
+/*
+ * The numeric sensor pdr readings are 32-bit signed, which makes the
+ * max/min readable fields four bytes long instead of the single byte laid out
+ * in pldm_numeric_sensor_pdr_t. The range fields which follow are not
+ * supported and are kept as one byte each.
+ */
+#    define PLDM_FW_NUMERIC_PDR_SIZE \
+        (sizeof(pldm_numeric_sensor_pdr_t) + 2 * (sizeof(int32_t) - 1))
+
+static void pldm_fw_sensor_numeric_pdr(
+    const struct pldm_fw_sensor_ctx *ctx,
+    uint8_t *buf)
+{
+    pldm_numeric_sensor_pdr_t pdr = { 0 };
+    size_t head = offsetof(pldm_numeric_sensor_pdr_t, max_readable);
+    size_t tail = sizeof(pdr) - offsetof(pldm_numeric_sensor_pdr_t,
+                                         range_field_format);
+    uint32_t max_readable = htole32((uint32_t)INT32_MAX);
+    uint32_t min_readable = htole32((uint32_t)INT32_MIN);
+
+    pdr.hdr.version = 0x01;
+    pdr.hdr.type = PLDM_NUMERIC_SENSOR_PDR;
+    pdr.hdr.length = PLDM_FW_NUMERIC_PDR_SIZE - sizeof(struct pldm_pdr_hdr);
+
+    pdr.terminus_handle = 0x1;
+    pdr.sensor_id = ctx->config->pldm_sensor_id;
+    pdr.entity_type = ctx->config->entity_type;
+    pdr.entity_instance = ctx->config->entity_instance;
+    pdr.sensor_init = 0x0; // noInit
+    pdr.sensor_auxiliary_names_pdr = false;
+    pdr.base_unit = ctx->base_unit;
+    pdr.uint_modifier = ctx->unit_modifier;
+    pdr.is_linear = true;
+    pdr.sensor_data_size = PLDM_SENSOR_DATA_SIZE_SINT32;
+    pdr.resolution = 1;
+    pdr.offset = 0;
+    pdr.threshold_and_hysteresis_volatility = 0x1f;
+    pdr.update_interval = (real32_t)ctx->interval_ms / 1000;
+    pdr.range_field_format = PLDM_SENSOR_DATA_SIZE_UINT8;
+    pdr.range_field_support = 0x0;
+
+    memcpy(buf, &pdr, head);
+    buf += head;
+    memcpy(buf, &max_readable, sizeof(max_readable));
+    buf += sizeof(max_readable);
+    memcpy(buf, &min_readable, sizeof(min_readable));
+    buf += sizeof(min_readable);
+    memcpy(buf, &pdr.range_field_format, tail);
+}
+
+static void pldm_fw_sensor_state_pdr(
+    const struct pldm_fw_sensor_ctx *ctx,
+    pldm_state_sensor_pdr_t *pdr)
+{
+    *pdr = (pldm_state_sensor_pdr_t){ 0 };
+
+    pdr->hdr.version = 0x01;
+    pdr->hdr.type = PLDM_STATE_SENSOR_PDR;
+    pdr->hdr.length =
+        sizeof(pldm_state_sensor_pdr_t) - sizeof(struct pldm_pdr_hdr);
+
+    pdr->terminus_handle = 0x1;
+    pdr->sensor_id = ctx->config->pldm_state_sensor_id;
+    pdr->entity_type = ctx->config->entity_type;
+    pdr->entity_instance = ctx->config->entity_instance;
+    pdr->sensor_init = 0x0;
+    pdr->sensor_auxiliary_names_pdr = false;
+    pdr->composite_sensor_count = 0x1;
+    pdr->possible_states[0] = PLDM_STATE_SET_HEALTH_STATE & 0xFF;
+    pdr->possible_states[1] = (PLDM_STATE_SET_HEALTH_STATE >> 8) & 0xFF;
+    pdr->possible_states[2] = 0x01;
+    /* normal, non-critical, critical, fatal */
+    pdr->possible_states[3] = 0x1e;
+}
+
+void pldm_fw_sensor_add_pdrs(pldm_pdr_t *repo, pldm_pdr_api_t *api)
+{
+    uint8_t numeric_pdr[PLDM_FW_NUMERIC_PDR_SIZE];
+    pldm_state_sensor_pdr_t state_pdr;
+    struct pldm_fw_sensor_ctx *ctx;
+    unsigned int i;
+
+    if (pldm_fw_sensor.config == NULL) {
+        return;
+    }
+
+    for (i = 0; i < pldm_fw_sensor.config->sensor_count; i++) {
+        ctx = &pldm_fw_sensor.ctx_table[i];
+
+        pldm_fw_sensor_numeric_pdr(ctx, numeric_pdr);
+        api->pldm_pdr_add(
+            repo, numeric_pdr, sizeof(numeric_pdr), false, 1, NULL);
+
+        if (ctx->config->pldm_state_sensor_id != 0) {
+            pldm_fw_sensor_state_pdr(ctx, &state_pdr);
+            api->pldm_pdr_add(
+                repo,
+                (uint8_t *)&state_pdr,
+                sizeof(state_pdr),
+                false,
+                1,
+                NULL);
+        }
+    }
+}
+
+#else
+
+int pldm_fw_sensor_init(const pldm_fw_config_t *config)
+{
+    /* sensors can only be served with the sensor and timer modules */
+    if ((config != NULL) && (config->sensor_count != 0)) {
+        return FWK_E_SUPPORT;
+    }
+
+    return FWK_SUCCESS;
+}
+
+int pldm_fw_sensor_bind(void)
+{
+    return FWK_SUCCESS;
+}
+
+int pldm_fw_sensor_start(fwk_id_t module_id)
+{
+    return FWK_SUCCESS;
+}
+
+void pldm_fw_sensor_refresh(void)
+{
+}
+
+bool pldm_fw_sensor_read_complete(const struct fwk_event *event)
+{
+    return false;
+}
+
+const struct pldm_fw_sensor_reading *pldm_fw_sensor_get_reading(
+    uint16_t pldm_sensor_id)
+{
+    return NULL;
+}
+
+const struct pldm_fw_sensor_reading *pldm_fw_sensor_get_state_reading(
+    uint16_t pldm_state_sensor_id)
+{
+    return NULL;
+}
+
+void pldm_fw_sensor_add_pdrs(pldm_pdr_t *repo, pldm_pdr_api_t *api)
+{
+}
+
+#endif
@@ -0,0 +1,37 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TEST_FWK_MODULE_MODULE_IDX_H
+#define TEST_FWK_MODULE_MODULE_IDX_H
+
+#include <fwk_id.h>
+
+enum fwk_module_idx {
+    FWK_MODULE_IDX_TIMER,
+    FWK_MODULE_IDX_SENSOR,
+    FWK_MODULE_IDX_PLDM,
+    FWK_MODULE_IDX_MCTP_FW,
+    FWK_MODULE_IDX_PLDM_FW,
+    FWK_MODULE_IDX_COUNT,
+};
+
+static const fwk_id_t fwk_module_id_timer =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_TIMER);
+
+static const fwk_id_t fwk_module_id_sensor =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SENSOR);
+
+static const fwk_id_t fwk_module_id_pldm =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_PLDM);
+
+static const fwk_id_t fwk_module_id_mctp_fw =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_MCTP_FW);
+
+static const fwk_id_t fwk_module_id_pldm_fw =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_PLDM_FW);
+
+#endif /* TEST_FWK_MODULE_MODULE_IDX_H */
@@ -0,0 +1,473 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <internal/mod_pldm_fw_int.h>
+
+#include <mod_mctp_fw.h>
+#include <mod_pldm.h>
+#include <mod_pldm_fw.h>
+#include <mod_timer.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+/* Bus the event receiver registers from, other than the discovery bus */
+#define RECEIVER_BUS MCTP_FW_BIND_PCC_API_IDX
+
+#define COALESCE_WINDOW_MS 10
+#define RETRY_TIMEOUT_MS   20
+#define RETRY_COUNT        2
+
+static pldm_fw_config_t config = {
+    .event_queue_size = PLDM_FW_EVENT_QUEUE_DEFAULT_SIZE,
+    .event_alarm_id = FWK_ID_SUB_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, 0, 0),
+    .event_coalesce_window_ms = COALESCE_WINDOW_MS,
+    .event_retry_timeout_ms = RETRY_TIMEOUT_MS,
+    .event_retry_count = RETRY_COUNT,
+};
+
+static const uint8_t event_data[] = { 0x01, 0x02, 0x03, 0x04 };
+
+/* State reported by the fake SetEventReceiver request decoder */
+static uint8_t receiver_global_enable;
+
+/* Requests handed to the fake mctp_fw api */
+static unsigned int sends;
+static uint32_t last_send_bus;
+
+/* Fake alarm api */
+static unsigned int alarm_starts;
+static unsigned int alarm_stops;
+static unsigned int last_alarm_ms;
+static unsigned int alarm_start_failures;
+
+static pldm_fw_elem_ctx_t elem_ctx_table[PLDM_FW_BIND_API_IDX_COUNT];
+
+static int fake_decode_set_event_receiver_req(
+    const pldm_msg_t *msg,
+    size_t payload_length,
+    uint8_t *event_message_global_enable,
+    uint8_t *transport_protocol_type,
+    uint8_t *event_receiver_address_info,
+    uint16_t *heartbeat_timer)
+{
+    *event_message_global_enable = receiver_global_enable;
+    *transport_protocol_type = 0;
+    *event_receiver_address_info = 0x08;
+    *heartbeat_timer = 0;
+
+    return PLDM_SUCCESS;
+}
+
+static int fake_encode_set_event_receiver_resp(
+    uint8_t instance_id,
+    uint8_t completion_code,
+    pldm_msg_t *msg)
+{
+    return PLDM_SUCCESS;
+}
+
+static int fake_encode_platform_event_message_req(
+    uint8_t instance_id,
+    uint8_t format_version,
+    uint8_t tid,
+    uint8_t event_class,
+    const uint8_t *event_data,
+    size_t event_data_length,
+    pldm_msg_t *msg,
+    size_t payload_length)
+{
+    msg->hdr.instance_id = instance_id;
+
+    return PLDM_SUCCESS;
+}
+
+static pldm_platform_api_t platform_api = {
+    .decode_set_event_receiver_req = fake_decode_set_event_receiver_req,
+    .encode_set_event_receiver_resp = fake_encode_set_event_receiver_resp,
+    .encode_platform_event_message_req = fake_encode_platform_event_message_req,
+};
+
+static int fake_mctp_fw_receive_from_app_layer(
+    uint32_t bus,
+    bool tag_owner,
+    uint8_t msg_tag,
+    void *data,
+    void *msg,
+    size_t len)
+{
+    sends++;
+    last_send_bus = bus;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_mctp_fw_send_from_headroom(
+    uint32_t bus,
+    bool tag_owner,
+    uint8_t msg_tag,
+    uint8_t msg_type,
+    void *msg,
+    size_t len)
+{
+    return FWK_SUCCESS;
+}
+
+static mctp_fw_api_t mctp_fw_api = {
+    .mctp_fw_receive_from_app_layer = fake_mctp_fw_receive_from_app_layer,
+    .mctp_fw_send_from_headroom = fake_mctp_fw_send_from_headroom,
+};
+
+static int fake_alarm_start(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
+{
+    if (alarm_start_failures > 0) {
+        alarm_start_failures--;
+        return FWK_E_DEVICE;
+    }
+
+    alarm_starts++;
+    last_alarm_ms = milliseconds;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_alarm_stop(fwk_id_t alarm_id)
+{
+    alarm_stops++;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_timer_alarm_api alarm_api = {
+    .start = fake_alarm_start,
+    .stop = fake_alarm_stop,
+};
+
+/* Sends a SetEventReceiver request from the given bus */
+static void set_event_receiver(uint32_t bus, uint8_t global_enable)
+{
+    pldm_msg_t req = { 0 };
+    pldm_msg_t *resp = NULL;
+    size_t resp_len = 0;
+
+    receiver_global_enable = global_enable;
+    pldm_fw_ctx.active_bus = bus;
+    pldm_fw_ctx.resp_arena_active = pldm_fw_ctx.resp_arena[bus];
+
+    handle_pldm_set_event_receiver_req(
+        &req, sizeof(req), &resp, &resp_len, &pldm_fw_mcp_ctx);
+
+    TEST_ASSERT_NOT_NULL(resp);
+}
+
+/* Raises the event of the last alarm started */
+static void fire_alarm(void)
+{
+    pldm_fw_push_alarm_fired = pldm_fw_ctx.push.alarm_seq;
+    pldm_fw_push_alarm();
+}
+
+static void queue_event(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        event_queue_put(
+            event_data, sizeof(event_data), PLDM_CPER_EVENT, 0));
+}
+
+void setUp(void)
+{
+    memset(&pldm_fw_ctx, 0, sizeof(pldm_fw_ctx));
+    memset(&pldm_fw_mcp_ctx, 0, sizeof(pldm_fw_mcp_ctx));
+    memset(elem_ctx_table, 0, sizeof(elem_ctx_table));
+
+    config.event_coalesce_window_ms = COALESCE_WINDOW_MS;
+
+    elem_ctx_table[PLDM_FW_BIND_PLATFORM_API_IDX]
+        .pldm_fw_elem.pldm_platform_elem.pldm_platform_api = &platform_api;
+    elem_ctx_table[PLDM_FW_BIND_MCTP_FW_API_IDX]
+        .pldm_fw_elem.mctp_fw_elem.mctp_fw_api = &mctp_fw_api;
+    pldm_fw_ctx.elem_ctx_table = elem_ctx_table;
+    pldm_fw_ctx.elem_count = FWK_ARRAY_SIZE(elem_ctx_table);
+    pldm_fw_ctx.config = &config;
+    pldm_fw_alarm_api = &alarm_api;
+    pldm_fw_push_alarm_fired = 0;
+
+    pldm_fw_mcp_ctx.tid = 1;
+    pldm_fw_mcp_ctx.event_receiver_max_buffer_size = EVENT_MAX_BUFFER_SIZE;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, event_queue_init(config.event_queue_size));
+
+    receiver_global_enable = PLDM_EVENT_MESSAGE_GLOBAL_DISABLE;
+    sends = 0;
+    last_send_bus = UINT32_MAX;
+    alarm_starts = 0;
+    alarm_stops = 0;
+    last_alarm_ms = 0;
+    alarm_start_failures = 0;
+}
+
+void tearDown(void)
+{
+    fwk_mm_free(pldm_fw_mcp_ctx.event_queue.arena);
+}
+
+void utest_pldm_fw_push_window_then_send(void)
+{
+    queue_event();
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+
+    TEST_ASSERT_TRUE(pldm_fw_ctx.push.enabled);
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_WINDOW, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(1, alarm_starts);
+    TEST_ASSERT_EQUAL(COALESCE_WINDOW_MS, last_alarm_ms);
+    TEST_ASSERT_EQUAL(0, sends);
+
+    fire_alarm();
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_IN_FLIGHT, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(1, sends);
+    TEST_ASSERT_EQUAL(RECEIVER_BUS, last_send_bus);
+    TEST_ASSERT_EQUAL(2, alarm_starts);
+    TEST_ASSERT_EQUAL(RETRY_TIMEOUT_MS, last_alarm_ms);
+}
+
+void utest_pldm_fw_push_complete_acks_event(void)
+{
+    queue_event();
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+    fire_alarm();
+
+    pldm_fw_push_complete(pldm_fw_ctx.push.instance_id, PLDM_SUCCESS);
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_IDLE, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(1, pldm_fw_ctx.push.pushed);
+    TEST_ASSERT_EQUAL(1, alarm_stops);
+    TEST_ASSERT_EQUAL(0, event_queue_length());
+}
+
+void utest_pldm_fw_push_retries_then_leaves_event_queued(void)
+{
+    unsigned int retry;
+
+    queue_event();
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+    fire_alarm();
+
+    for (retry = 1; retry <= RETRY_COUNT; retry++) {
+        fire_alarm();
+
+        TEST_ASSERT_EQUAL(PLDM_FW_PUSH_IN_FLIGHT, pldm_fw_ctx.push.state);
+        TEST_ASSERT_EQUAL(1 + retry, sends);
+        TEST_ASSERT_EQUAL(RETRY_TIMEOUT_MS << retry, last_alarm_ms);
+    }
+
+    fire_alarm();
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_POLLED, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(1 + RETRY_COUNT, sends);
+    TEST_ASSERT_EQUAL(RETRY_COUNT, pldm_fw_ctx.push.retried);
+    TEST_ASSERT_EQUAL(1, pldm_fw_ctx.push.failed);
+    TEST_ASSERT_EQUAL(1, event_queue_length());
+}
+
+void utest_pldm_fw_push_undelivered_event_holds_later_events(void)
+{
+    unsigned int retry;
+    uint16_t undelivered_id;
+
+    config.event_coalesce_window_ms = 0;
+    queue_event();
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+
+    for (retry = 0; retry <= RETRY_COUNT; retry++) {
+        fire_alarm();
+    }
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_POLLED, pldm_fw_ctx.push.state);
+    undelivered_id = pldm_fw_ctx.push.event_id;
+
+    /* the undelivered event is not pushed again with a fresh retry count */
+    queue_event();
+    pldm_fw_push_schedule();
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_POLLED, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(1 + RETRY_COUNT, sends);
+    TEST_ASSERT_EQUAL(2, event_queue_length());
+
+    /* acknowledging another event id does not resume the pushes */
+    pldm_fw_push_polled(undelivered_id + 1);
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_POLLED, pldm_fw_ctx.push.state);
+
+    /* the event receiver polls for the undelivered event */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, event_queue_ack(undelivered_id));
+    pldm_fw_push_polled(undelivered_id);
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_IN_FLIGHT, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(2 + RETRY_COUNT, sends);
+    TEST_ASSERT_NOT_EQUAL(undelivered_id, pldm_fw_ctx.push.event_id);
+    TEST_ASSERT_EQUAL(0, pldm_fw_ctx.push.retries);
+}
+
+void utest_pldm_fw_push_rejected_event_left_queued(void)
+{
+    queue_event();
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+    fire_alarm();
+
+    pldm_fw_push_complete(
+        pldm_fw_ctx.push.instance_id, PLDM_ERROR_INVALID_DATA);
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_POLLED, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(0, pldm_fw_ctx.push.pushed);
+    TEST_ASSERT_EQUAL(1, pldm_fw_ctx.push.failed);
+    TEST_ASSERT_EQUAL(1, alarm_stops);
+    TEST_ASSERT_EQUAL(1, event_queue_length());
+}
+
+void utest_pldm_fw_push_disable_disarms(void)
+{
+    queue_event();
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+    fire_alarm();
+
+    set_event_receiver(
+        RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_POLLING);
+
+    TEST_ASSERT_FALSE(pldm_fw_ctx.push.enabled);
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_IDLE, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(1, alarm_stops);
+
+    /* the event is left for the event receiver to poll */
+    TEST_ASSERT_EQUAL(1, event_queue_length());
+}
+
+void utest_pldm_fw_push_alarm_ignored_when_disabled(void)
+{
+    queue_event();
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+
+    /* the alarm event was raised before pushes were disabled */
+    pldm_fw_push_alarm_fired = pldm_fw_ctx.push.alarm_seq;
+    pldm_fw_ctx.push.enabled = false;
+    pldm_fw_push_alarm();
+
+    TEST_ASSERT_EQUAL(0, sends);
+}
+
+void utest_pldm_fw_push_alarm_ignored_when_stale(void)
+{
+    queue_event();
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+
+    pldm_fw_push_alarm_fired = pldm_fw_ctx.push.alarm_seq - 1;
+    pldm_fw_push_alarm();
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_WINDOW, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(0, sends);
+}
+
+void utest_pldm_fw_push_window_arm_failure(void)
+{
+    queue_event();
+
+    /* the window cannot be timed, so the event is pushed straight away */
+    alarm_start_failures = 1;
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_IN_FLIGHT, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(1, sends);
+    TEST_ASSERT_EQUAL(1, alarm_starts);
+    TEST_ASSERT_EQUAL(RETRY_TIMEOUT_MS, last_alarm_ms);
+}
+
+void utest_pldm_fw_push_retry_arm_failure(void)
+{
+    config.event_coalesce_window_ms = 0;
+    queue_event();
+
+    /* without the retry alarm the event is left queued for polling */
+    alarm_start_failures = 1;
+    set_event_receiver(RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC);
+
+    TEST_ASSERT_EQUAL(PLDM_FW_PUSH_POLLED, pldm_fw_ctx.push.state);
+    TEST_ASSERT_EQUAL(1, sends);
+    TEST_ASSERT_EQUAL(1, pldm_fw_ctx.push.failed);
+    TEST_ASSERT_EQUAL(1, event_queue_length());
+}
+
+void utest_pldm_fw_stats_skip_unpublished_event(void)
+{
+    struct pldm_event_queue *queue = &pldm_fw_mcp_ctx.event_queue;
+    struct pldm_event *oldest;
+    struct pldm_event_queue_stats stats;
+
+    queue_event();
+
+    /* an event still being written has no valid timestamp yet */
+    oldest = (struct pldm_event *)&queue->arena[queue->head];
+    oldest->ready = false;
+    oldest->timestamp = UINT64_MAX;
+
+    event_queue_get_stats(&stats);
+
+    TEST_ASSERT_EQUAL(1, stats.length);
+    TEST_ASSERT_EQUAL(0, stats.oldest_age);
+}
+
+void utest_pldm_fw_cper_uses_registered_bus(void)
+{
+    set_event_receiver(
+        RECEIVER_BUS, PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_POLLING);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        send_pldm_platform_event_message_cper(pldm_fw_mcp_ctx.tid, 0));
+
+    TEST_ASSERT_EQUAL(1, sends);
+    TEST_ASSERT_EQUAL(RECEIVER_BUS, last_send_bus);
+}
+
+int pldm_fw_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(utest_pldm_fw_push_window_then_send);
+    RUN_TEST(utest_pldm_fw_push_complete_acks_event);
+    RUN_TEST(utest_pldm_fw_push_retries_then_leaves_event_queued);
+    RUN_TEST(utest_pldm_fw_push_undelivered_event_holds_later_events);
+    RUN_TEST(utest_pldm_fw_push_rejected_event_left_queued);
+    RUN_TEST(utest_pldm_fw_push_disable_disarms);
+    RUN_TEST(utest_pldm_fw_push_alarm_ignored_when_disabled);
+    RUN_TEST(utest_pldm_fw_push_alarm_ignored_when_stale);
+    RUN_TEST(utest_pldm_fw_push_window_arm_failure);
+    RUN_TEST(utest_pldm_fw_push_retry_arm_failure);
+    RUN_TEST(utest_pldm_fw_stats_skip_unpublished_event);
+    RUN_TEST(utest_pldm_fw_cper_uses_registered_bus);
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return pldm_fw_test_main();
+}
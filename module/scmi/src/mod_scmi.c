@@ -23,6 +23,7 @@
 #include <fwk_id.h>
 #include <fwk_log.h>
 #include <fwk_macros.h>
+#include <fwk_math.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
@@ -41,6 +42,7 @@
 /* Following macros are used for scmi notification related operations */
 #    define MOD_SCMI_PROTOCOL_MAX_OPERATION_ID 0x20
 #    define MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID 0xFF
+#    define MOD_SCMI_SUBSCRIBER_BITMAP_WORD_BITS    32
 
 struct scmi_notification_subscribers {
     unsigned int agent_count;
@@ -71,6 +73,20 @@ struct scmi_notification_subscribers {
      *   agent_service_ids[operation_idx][element_idx][agent_idx]
      */
     fwk_id_t *agent_service_ids;
+
+    /*
+     * Bitmap of the (element, agent) pairs subscribed to each operation, laid
+     * out like agent_service_ids with one bit per entry. Notifications only
+     * visit the set bits, so their cost follows the number of subscriptions
+     * rather than the number of elements and agents.
+     */
+    uint32_t *subscriber_bitmap;
+
+    /* Number of words of the bitmap of each operation */
+    unsigned int bitmap_word_count;
+
+    /* Number of subscriptions to each operation */
+    unsigned int *subscription_count;
 };
 
 #endif
@@ -638,6 +654,15 @@ static int scmi_notification_init(
     subscribers->agent_service_ids =
         fwk_mm_calloc((size_t)total_count, sizeof(fwk_id_t));
 
+    subscribers->bitmap_word_count =
+        (element_count * agent_count + MOD_SCMI_SUBSCRIBER_BITMAP_WORD_BITS -
+         1) /
+        MOD_SCMI_SUBSCRIBER_BITMAP_WORD_BITS;
+    subscribers->subscriber_bitmap = fwk_mm_calloc(
+        operation_count * subscribers->bitmap_word_count, sizeof(uint32_t));
+    subscribers->subscription_count =
+        fwk_mm_calloc(operation_count, sizeof(unsigned int));
+
     /*
      * Mark all operations_idx as invalid. This will be updated
      * whenever an agent subscribes to a notification for an operation.
@@ -654,6 +679,26 @@ static int scmi_notification_init(
     return FWK_SUCCESS;
 }
 
+/*
+ * Get the bitmap word holding the subscription bit of an (element, agent) pair
+ * and the mask of that bit.
+ */
+static uint32_t *scmi_notification_subscriber_word(
+    struct scmi_notification_subscribers *subscribers,
+    unsigned int agent_idx,
+    unsigned int element_idx,
+    unsigned int operation_idx,
+    uint32_t *mask)
+{
+    unsigned int pair_idx = agent_idx + element_idx * subscribers->agent_count;
+
+    *mask = UINT32_C(1) << (pair_idx % MOD_SCMI_SUBSCRIBER_BITMAP_WORD_BITS);
+
+    return &subscribers->subscriber_bitmap
+                [operation_idx * subscribers->bitmap_word_count +
+                 pair_idx / MOD_SCMI_SUBSCRIBER_BITMAP_WORD_BITS];
+}
+
 static int scmi_notification_service_idx(
     unsigned int agent_idx,
     unsigned int element_idx,
@@ -684,6 +729,8 @@ static int scmi_notification_add_subscriber(
     int status;
     unsigned int service_id_idx;
     unsigned int agent_idx;
+    unsigned int operation_idx;
+    uint32_t *word, mask;
 
     struct scmi_notification_subscribers *subscribers =
         notification_subscribers(protocol_id);
@@ -705,15 +752,29 @@ static int scmi_notification_add_subscriber(
             (uint8_t)subscribers->operation_idx++;
     }
 
+    operation_idx = subscribers->operation_id_to_idx[operation_id];
+
     service_id_idx = (unsigned int)scmi_notification_service_idx(
         agent_idx,
         element_idx,
-        subscribers->operation_id_to_idx[operation_id],
+        operation_idx,
         subscribers->agent_count,
         subscribers->element_count);
 
     subscribers->agent_service_ids[service_id_idx] = service_id;
 
+    /* Agent 0, the platform agent, is never notified */
+    if (agent_idx == 0) {
+        return FWK_SUCCESS;
+    }
+
+    word = scmi_notification_subscriber_word(
+        subscribers, agent_idx, element_idx, operation_idx, &mask);
+    if ((*word & mask) == 0) {
+        *word |= mask;
+        subscribers->subscription_count[operation_idx]++;
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -725,6 +786,7 @@ static int scmi_notification_remove_subscriber(
 {
     unsigned int operation_idx = 0;
     unsigned int service_id_idx;
+    uint32_t *word, mask;
 
     struct scmi_notification_subscribers *subscribers =
         notification_subscribers(protocol_id);
@@ -733,6 +795,11 @@ static int scmi_notification_remove_subscriber(
 
     operation_idx = subscribers->operation_id_to_idx[operation_id];
 
+    /* No agent ever subscribed to this operation */
+    if (operation_idx == MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID) {
+        return FWK_SUCCESS;
+    }
+
     service_id_idx = (unsigned int)scmi_notification_service_idx(
         agent_idx,
         element_idx,
@@ -742,6 +809,13 @@ static int scmi_notification_remove_subscriber(
 
     subscribers->agent_service_ids[service_id_idx] = FWK_ID_NONE;
 
+    word = scmi_notification_subscriber_word(
+        subscribers, agent_idx, element_idx, operation_idx, &mask);
+    if ((*word & mask) != 0) {
+        *word &= ~mask;
+        subscribers->subscription_count[operation_idx]--;
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -752,10 +826,12 @@ static int scmi_notification_notify(
     void *payload_p2a,
     size_t payload_size)
 {
-    unsigned int i, j;
+    unsigned int word_idx;
     unsigned int operation_idx;
-    fwk_id_t service_id;
     unsigned int service_id_idx;
+    uint32_t word;
+    const uint32_t *bitmap;
+    const fwk_id_t *service_ids;
 
     struct scmi_notification_subscribers *subscribers =
         notification_subscribers(protocol_id);
@@ -773,26 +849,31 @@ static int scmi_notification_notify(
         return FWK_SUCCESS;
     }
 
-    for (i = 0; i < subscribers->element_count; i++) {
-        /* Skip agent 0, platform agent */
-        for (j = 1; j < subscribers->agent_count; j++) {
-            service_id_idx = (unsigned int)scmi_notification_service_idx(
-                j,
-                i,
-                operation_idx,
-                subscribers->agent_count,
-                subscribers->element_count);
-
-            service_id = subscribers->agent_service_ids[service_id_idx];
-
-            if (!fwk_id_is_equal(service_id, FWK_ID_NONE)) {
-                scmi_notify(
-                    service_id,
-                    (int)protocol_id,
-                    (int)scmi_response_id,
-                    payload_p2a,
-                    payload_size);
-            }
+    if (subscribers->subscription_count[operation_idx] == 0) {
+        return FWK_SUCCESS;
+    }
+
+    bitmap = &subscribers->subscriber_bitmap
+                  [operation_idx * subscribers->bitmap_word_count];
+    service_ids = &subscribers->agent_service_ids
+                       [operation_idx * subscribers->element_count *
+                        subscribers->agent_count];
+
+    /*
+     * Visit the subscribed (element, agent) pairs in element then agent
+     * order, one set bit at a time.
+     */
+    for (word_idx = 0; word_idx < subscribers->bitmap_word_count; word_idx++) {
+        for (word = bitmap[word_idx]; word != 0; word &= word - 1) {
+            service_id_idx = word_idx * MOD_SCMI_SUBSCRIBER_BITMAP_WORD_BITS +
+                (unsigned int)fwk_math_log2(word & (~word + 1U));
+
+            scmi_notify(
+                service_ids[service_id_idx],
+                (int)protocol_id,
+                (int)scmi_response_id,
+                payload_p2a,
+                payload_size);
         }
     }
 
@@ -1346,6 +1427,7 @@ static int scmi_process_notification(const struct fwk_event *event,
 const struct fwk_module module_scmi = {
     .api_count = (unsigned int)MOD_SCMI_API_IDX_COUNT,
     .event_count = 1,
+    .event_priority = FWK_EVENT_PRIORITY_HIGH,
 #ifdef BUILD_HAS_NOTIFICATION
     .notification_count = (unsigned int)MOD_SCMI_NOTIFICATION_IDX_COUNT,
 #endif
@@ -0,0 +1,316 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+
+#include <internal/mod_scmi.h>
+
+#include <mod_scmi.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+#include <mod_scmi_base.c>
+
+#define FAKE_MODULE_ID 0x5
+
+/* Agent 0 is the platform, agents 1 to 7 each have an A2P and a P2A channel */
+#define FAKE_AGENT_COUNT    8
+#define FAKE_DOMAIN_COUNT   256
+#define FAKE_OPERATION_ID   0x7
+#define FAKE_OPERATION_ID_2 0x8
+#define FAKE_RESPONSE_ID    0x1A
+
+#define A2P_SERVICE_IDX(agent) (agent)
+#define P2A_SERVICE_IDX(agent) (FAKE_AGENT_COUNT + (agent))
+#define SERVICE_COUNT          (2 * FAKE_AGENT_COUNT)
+
+#define NOTIFICATION_LOG_SIZE 16
+
+static struct mod_scmi_service_config service_config_table[SERVICE_COUNT];
+static struct scmi_service_ctx service_ctx_table[SERVICE_COUNT];
+static struct scmi_notification_subscribers subscribers_table[2];
+
+static unsigned int notification_count;
+static unsigned int notification_log[NOTIFICATION_LOG_SIZE];
+
+static int fake_transmit(
+    fwk_id_t transport_id,
+    uint32_t message_header,
+    const void *payload,
+    size_t size,
+    bool request_ack_by_interrupt)
+{
+    if (notification_count < NOTIFICATION_LOG_SIZE) {
+        notification_log[notification_count] =
+            fwk_id_get_element_idx(transport_id);
+    }
+
+    notification_count++;
+
+    return FWK_SUCCESS;
+}
+
+static fwk_id_t a2p_service_id(unsigned int agent)
+{
+    return FWK_ID_ELEMENT(FAKE_MODULE_ID, A2P_SERVICE_IDX(agent));
+}
+
+void setUp(void)
+{
+    unsigned int agent;
+
+    memset(&scmi_ctx, 0, sizeof(scmi_ctx));
+    memset(subscribers_table, 0, sizeof(subscribers_table));
+    memset(service_ctx_table, 0, sizeof(service_ctx_table));
+
+    for (agent = 0; agent < FAKE_AGENT_COUNT; agent++) {
+        service_config_table[A2P_SERVICE_IDX(agent)] =
+            (struct mod_scmi_service_config){
+                .scmi_agent_id = agent,
+                .scmi_p2a_id = FWK_ID_ELEMENT(
+                    FAKE_MODULE_ID, P2A_SERVICE_IDX(agent)),
+            };
+        service_config_table[P2A_SERVICE_IDX(agent)] =
+            (struct mod_scmi_service_config){
+                .scmi_agent_id = agent,
+                .scmi_p2a_id = FWK_ID_NONE,
+            };
+
+        service_ctx_table[A2P_SERVICE_IDX(agent)].config =
+            &service_config_table[A2P_SERVICE_IDX(agent)];
+        service_ctx_table[P2A_SERVICE_IDX(agent)] = (struct scmi_service_ctx){
+            .config = &service_config_table[P2A_SERVICE_IDX(agent)],
+            .transport_id =
+                FWK_ID_ELEMENT(FAKE_MODULE_ID, P2A_SERVICE_IDX(agent)),
+            .transmit = fake_transmit,
+        };
+    }
+
+    scmi_ctx.service_ctx_table = service_ctx_table;
+    scmi_ctx.scmi_notif_subscribers = subscribers_table;
+    scmi_ctx.scmi_protocol_id_to_idx[MOD_SCMI_PROTOCOL_ID_PERF] =
+        PROTOCOL_TABLE_RESERVED_ENTRIES_COUNT;
+
+    notification_count = 0;
+
+    scmi_notification_init(
+        MOD_SCMI_PROTOCOL_ID_PERF, FAKE_AGENT_COUNT, FAKE_DOMAIN_COUNT, 2);
+}
+
+void tearDown(void)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < FWK_ARRAY_SIZE(subscribers_table); idx++) {
+        fwk_mm_free(subscribers_table[idx].agent_service_ids);
+        fwk_mm_free(subscribers_table[idx].subscriber_bitmap);
+        fwk_mm_free(subscribers_table[idx].subscription_count);
+    }
+}
+
+static void subscribe(unsigned int agent, unsigned int domain)
+{
+    int status;
+
+    status = scmi_notification_add_subscriber(
+        MOD_SCMI_PROTOCOL_ID_PERF,
+        domain,
+        FAKE_OPERATION_ID,
+        a2p_service_id(agent));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+static void unsubscribe(unsigned int agent, unsigned int domain)
+{
+    int status;
+
+    status = scmi_notification_remove_subscriber(
+        MOD_SCMI_PROTOCOL_ID_PERF, agent, domain, FAKE_OPERATION_ID);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+static void notify(unsigned int operation_id)
+{
+    uint32_t payload = 0;
+    int status;
+
+    status = scmi_notification_notify(
+        MOD_SCMI_PROTOCOL_ID_PERF,
+        operation_id,
+        FAKE_RESPONSE_ID,
+        &payload,
+        sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+/*
+ * Reference implementation walking every (domain, agent) pair, as was done
+ * before subscriptions were tracked in bitmaps.
+ */
+static void notify_scan(unsigned int operation_id)
+{
+    struct scmi_notification_subscribers *subscribers =
+        notification_subscribers(MOD_SCMI_PROTOCOL_ID_PERF);
+    unsigned int operation_idx = subscribers->operation_id_to_idx[operation_id];
+    uint32_t payload = 0;
+    unsigned int i, j;
+    int service_id_idx;
+
+    if (operation_idx == MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID) {
+        return;
+    }
+
+    for (i = 0; i < subscribers->element_count; i++) {
+        for (j = 1; j < subscribers->agent_count; j++) {
+            service_id_idx = scmi_notification_service_idx(
+                j,
+                i,
+                operation_idx,
+                subscribers->agent_count,
+                subscribers->element_count);
+
+            if (!fwk_id_is_equal(
+                    subscribers->agent_service_ids[service_id_idx],
+                    FWK_ID_NONE)) {
+                scmi_notify(
+                    subscribers->agent_service_ids[service_id_idx],
+                    MOD_SCMI_PROTOCOL_ID_PERF,
+                    FAKE_RESPONSE_ID,
+                    &payload,
+                    sizeof(payload));
+            }
+        }
+    }
+}
+
+void test_scmi_notification_notify_no_subscriber(void)
+{
+    /* The operation has never been subscribed to */
+    notify(FAKE_OPERATION_ID);
+    TEST_ASSERT_EQUAL(0, notification_count);
+
+    /* Every subscriber has gone */
+    subscribe(3, 10);
+    unsubscribe(3, 10);
+    notify(FAKE_OPERATION_ID);
+    TEST_ASSERT_EQUAL(0, notification_count);
+}
+
+void test_scmi_notification_notify_subscribers(void)
+{
+    subscribe(7, 200);
+    subscribe(2, 5);
+    subscribe(4, 5);
+    subscribe(1, FAKE_DOMAIN_COUNT - 1);
+
+    notify(FAKE_OPERATION_ID);
+
+    /* Notifications are sent in domain order, then agent order */
+    TEST_ASSERT_EQUAL(4, notification_count);
+    TEST_ASSERT_EQUAL(P2A_SERVICE_IDX(2), notification_log[0]);
+    TEST_ASSERT_EQUAL(P2A_SERVICE_IDX(4), notification_log[1]);
+    TEST_ASSERT_EQUAL(P2A_SERVICE_IDX(7), notification_log[2]);
+    TEST_ASSERT_EQUAL(P2A_SERVICE_IDX(1), notification_log[3]);
+
+    /* Other operations are not affected */
+    notification_count = 0;
+    notify(FAKE_OPERATION_ID_2);
+    TEST_ASSERT_EQUAL(0, notification_count);
+}
+
+void test_scmi_notification_remove_subscriber(void)
+{
+    subscribe(2, 5);
+    subscribe(4, 5);
+
+    unsubscribe(2, 5);
+    notify(FAKE_OPERATION_ID);
+    TEST_ASSERT_EQUAL(1, notification_count);
+    TEST_ASSERT_EQUAL(P2A_SERVICE_IDX(4), notification_log[0]);
+
+    /* Removing a missing subscription is harmless */
+    unsubscribe(2, 5);
+    TEST_ASSERT_EQUAL(1, subscribers_table[1].subscription_count[0]);
+
+    /* Removing from an operation nobody subscribed to is harmless */
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        scmi_notification_remove_subscriber(
+            MOD_SCMI_PROTOCOL_ID_PERF, 2, 5, FAKE_OPERATION_ID_2));
+}
+
+void test_scmi_notification_add_subscriber_twice(void)
+{
+    subscribe(3, 10);
+    subscribe(3, 10);
+    TEST_ASSERT_EQUAL(1, subscribers_table[1].subscription_count[0]);
+
+    notify(FAKE_OPERATION_ID);
+    TEST_ASSERT_EQUAL(1, notification_count);
+
+    unsubscribe(3, 10);
+    TEST_ASSERT_EQUAL(0, subscribers_table[1].subscription_count[0]);
+}
+
+void test_scmi_notification_platform_agent(void)
+{
+    /* The platform agent is never notified */
+    subscribe(0, 10);
+    TEST_ASSERT_EQUAL(0, subscribers_table[1].subscription_count[0]);
+
+    notify(FAKE_OPERATION_ID);
+    TEST_ASSERT_EQUAL(0, notification_count);
+}
+
+void test_scmi_notification_matches_scan(void)
+{
+    unsigned int domain, agent, expected;
+
+    for (domain = 0; domain < FAKE_DOMAIN_COUNT; domain += 3) {
+        for (agent = 1; agent < FAKE_AGENT_COUNT; agent++) {
+            if (((domain + agent) % 5) == 0) {
+                subscribe(agent, domain);
+            }
+        }
+    }
+
+    notify_scan(FAKE_OPERATION_ID);
+    expected = notification_count;
+    TEST_ASSERT_NOT_EQUAL(0, expected);
+
+    notification_count = 0;
+    notify(FAKE_OPERATION_ID);
+    TEST_ASSERT_EQUAL(expected, notification_count);
+}
+
+int scmi_notification_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_scmi_notification_notify_no_subscriber);
+    RUN_TEST(test_scmi_notification_notify_subscribers);
+    RUN_TEST(test_scmi_notification_remove_subscriber);
+    RUN_TEST(test_scmi_notification_add_subscriber_twice);
+    RUN_TEST(test_scmi_notification_platform_agent);
+    RUN_TEST(test_scmi_notification_matches_scan);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return scmi_notification_test_main();
+}
+#endif
@@ -42,6 +42,7 @@ enum scmi_perf_event_idx {
     SCMI_PERF_EVENT_IDX_LEVEL_GET_REQUEST,
 #ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
     SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS,
+    SCMI_PERF_EVENT_IDX_FAST_CHANNELS_DOORBELL,
 #endif
     SCMI_PERF_EVENT_IDX_COUNT,
 };
@@ -75,6 +76,30 @@ struct fast_channel_ctx {
     const struct mod_transport_fast_channels_api *transport_fch_api;
 };
 
+/*
+ * Copy of the values last read from the set fast channels of a domain, used to
+ * only process the domains whose fast channels have been written to.
+ */
+struct fast_channel_shadow {
+    /* Level set fast channel */
+    uint32_t level;
+
+    /* Limits set fast channel */
+    struct mod_scmi_perf_fast_channel_limit limits;
+
+    /* Level last requested to DVFS on behalf of the fast channels */
+    uint32_t requested_level;
+
+    /* The domain was busy, the values must be processed again */
+    bool retry;
+
+    /* The level was refused, it is only requested again once it changes */
+    bool level_refused;
+
+    /* The limits were refused, they are only set again once they change */
+    bool limits_refused;
+};
+
 #endif
 
 /*!
@@ -95,6 +120,9 @@ struct scmi_perf_domain_ctx {
     /* Table of fast channel context */
     struct fast_channel_ctx fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_COUNT];
 
+    /* Values last read from the set fast channels */
+    struct fast_channel_shadow fch_shadow;
+
 #endif
 };
 
@@ -78,43 +78,31 @@ static int find_opp_for_level(
 {
     struct perf_opp_table *opp_table;
     size_t i;
-    uint32_t opp_level, limit_max;
+    uint32_t limit_max;
+    int status;
 
     opp_table = domain_ctx->opp_table;
     limit_max = domain_ctx->level_limits.maximum;
 
-    for (i = 0; i < opp_table->opp_count; i++) {
-        opp_level = opp_table->opps[i].level;
-
-        if ((use_nearest &&
-             ((opp_level < *level) && (opp_level < limit_max))) ||
-            (!use_nearest && (opp_level != *level))) {
-            /*
-             * The current OPP level is either below the desired level
-             * or not exact match found.
-             */
-            continue;
-        } else {
-            /*
-             * Either found exact match, or the current OPP is above the limit.
-             * Must be within limits.
-             */
-            if ((opp_level > limit_max) && (i > 0)) {
-                i--;
-            }
+    /* Use the DVFS level indices rather than scanning the OPP table */
+    if (use_nearest) {
+        status = scmi_perf_ctx.dvfs_api->get_nearest_level_id(
+            opp_table->dvfs_id, FWK_MIN(*level, limit_max), &i);
+    } else {
+        status = scmi_perf_ctx.dvfs_api->get_level_id(
+            opp_table->dvfs_id, *level, &i);
+    }
 
-            return opp_for_level_found(level, opp_table, i);
-        }
+    if (status != FWK_SUCCESS) {
+        return FWK_E_RANGE;
     }
 
-    /* Either not exact match or approximate to the highest level */
-    if (use_nearest) {
+    /* The OPP must be within limits */
+    if ((opp_table->opps[i].level > limit_max) && (i > 0)) {
         i--;
-
-        return opp_for_level_found(level, opp_table, i);
     }
 
-    return FWK_E_RANGE;
+    return opp_for_level_found(level, opp_table, i);
 }
 
 #if defined(BUILD_HAS_SCMI_PERF_PROTOCOL_OPS) || \
@@ -612,6 +600,7 @@ static int process_internal_event(const struct fwk_event *event)
     switch (event_idx) {
 #ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
     case SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS:
+    case SCMI_PERF_EVENT_IDX_FAST_CHANNELS_DOORBELL:
         status = perf_fch_process_event(event);
         break;
 #endif
@@ -61,9 +61,16 @@ static unsigned int fast_channel_elem_size[MOD_SCMI_PERF_FAST_CHANNEL_COUNT] = {
         sizeof(struct mod_scmi_perf_fast_channel_limit)
 };
 
+/* Parameters of the fast channels doorbell event */
+struct perf_fch_doorbell_params {
+    /* Index of the domain whose fast channel has been written to */
+    uint32_t domain_idx;
+};
+
 static struct mod_scmi_perf_fc_ctx perf_fch_ctx;
 
 static void fast_channel_callback(uintptr_t param);
+static void fast_channel_doorbell_callback(uintptr_t param);
 
 /*
  * Static Helpers
@@ -137,6 +144,7 @@ static struct fast_channel_ctx *get_fch_ctx(
 }
 
 static int fch_context_init(
+    unsigned int domain_idx,
     const struct scmi_perf_fch_config *fch_config,
     struct fast_channel_ctx *fch_ctx)
 {
@@ -172,8 +180,14 @@ static int fch_context_init(
 
         perf_fch_ctx.callback_registered = true;
     } else if (interrupt_type == MOD_TRANSPORT_FCH_INTERRUPT_TYPE_HW) {
+        /*
+         * Hardware fast channels signal each write, so there is no need to
+         * poll them and only the domain written to has to be processed.
+         */
         status = fch_ctx->transport_fch_api->transport_fch_register_callback(
-            fch_config->transport_id, (uintptr_t)NULL, fast_channel_callback);
+            fch_config->transport_id,
+            (uintptr_t)domain_idx,
+            fast_channel_doorbell_callback);
 
         if (status != FWK_SUCCESS) {
             return FWK_E_DATA;
@@ -488,6 +502,78 @@ static void fast_channel_callback(uintptr_t param)
     log_and_increment_pending_req_count();
 }
 
+static void fast_channel_doorbell_callback(uintptr_t param)
+{
+    int status;
+
+    struct fwk_event event = (struct fwk_event){
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_SCMI_PERF,
+            SCMI_PERF_EVENT_IDX_FAST_CHANNELS_DOORBELL),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+    };
+    struct perf_fch_doorbell_params *params =
+        (struct perf_fch_doorbell_params *)event.params;
+
+    params->domain_idx = (uint32_t)param;
+
+    status = fwk_put_event(&event);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-PERF] Error creating FC doorbell event.");
+    }
+}
+
+#ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
+/*
+ * Read the set fast channels of a domain into its shadow copy. Returns true
+ * when they hold new values, or when the previous values have to be retried.
+ */
+static bool fch_shadow_update(
+    struct fast_channel_shadow *shadow,
+    const uint32_t *set_level,
+    const struct mod_scmi_perf_fast_channel_limit *set_limit)
+{
+    uint32_t level = 0;
+    uint32_t range_max = 0;
+    uint32_t range_min = 0;
+    uint32_t diff;
+
+    if (set_level != NULL) {
+        level = *set_level;
+    }
+
+    if (set_limit != NULL) {
+        range_max = set_limit->range_max;
+        range_min = set_limit->range_min;
+    }
+
+    /* Compare all the words at once rather than branching on each of them */
+    diff = (level ^ shadow->level) |
+        (range_max ^ shadow->limits.range_max) |
+        (range_min ^ shadow->limits.range_min);
+
+    shadow->level = level;
+    shadow->limits.range_max = range_max;
+    shadow->limits.range_min = range_min;
+
+    return (diff != 0) || shadow->retry;
+}
+
+/* The domain could not take the request yet, so it is made again later */
+static inline bool fch_request_busy(int status)
+{
+    return status == FWK_E_BUSY;
+}
+
+/* The values of the request are not valid, retrying them would not help */
+static inline bool fch_request_refused(int status)
+{
+    return (status != FWK_SUCCESS) && (status != FWK_PENDING) &&
+        !fch_request_busy(status);
+}
+#endif
+
 static inline void load_tlimits(
     struct mod_scmi_perf_fast_channel_limit *set_limit,
     uint32_t *tmax,
@@ -512,34 +598,66 @@ static inline void load_tlevel(
 }
 
 #ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+/*
+ * Get the values to pass to the plugins handler for a domain, from the shadow
+ * copy of its set fast channels.
+ */
+static void load_shadow_values(
+    unsigned int domain_idx,
+    struct scmi_perf_domain_ctx *domain_ctx,
+    struct fc_perf_update *update)
+{
+    struct fast_channel_shadow *shadow = &domain_ctx->fch_shadow;
+
+    load_tlimits(
+        (get_fc_set_limit_addr(domain_idx) != NULL) ? &shadow->limits : NULL,
+        &update->max_limit,
+        &update->min_limit,
+        domain_ctx);
+
+    load_tlevel(
+        (get_fc_set_level_addr(domain_idx) != NULL) ? &shadow->level : NULL,
+        &update->level,
+        domain_ctx);
+
+    update->domain_id = get_dependency_id(domain_idx);
+}
+
 static void perf_fch_process_plugins_handler(void)
 {
-    struct mod_scmi_perf_fast_channel_limit *set_limit;
     struct scmi_perf_domain_ctx *domain_ctx;
-    uint32_t *set_level;
-    uint32_t tlevel, tmax, tmin;
+    struct fast_channel_shadow *shadow;
+    uint32_t tlevel, tmax, tmin, curr_level;
     unsigned int i;
+    bool changed = false;
     int status;
 
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
     struct fc_perf_update update;
 
+    /* Read each fast channel once, into the shadow copy of its domain */
     for (i = 0; i < perf_ctx->domain_count; i++) {
         if (perf_fch_domain_has_fastchannels(i)) {
-            set_limit = get_fc_set_limit_addr(i);
-            set_level = get_fc_set_level_addr(i);
-
-            domain_ctx = &perf_ctx->domain_ctx_table[i];
-            load_tlimits(set_limit, &tmax, &tmin, domain_ctx);
+            changed |= fch_shadow_update(
+                &perf_ctx->domain_ctx_table[i].fch_shadow,
+                get_fc_set_level_addr(i),
+                get_fc_set_limit_addr(i));
+        }
+    }
 
-            load_tlevel(set_level, &tlevel, domain_ctx);
+    /*
+     * Without plugins, the result only depends on the fast channels so there
+     * is nothing to do until one of them changes. Plugins run their own policy
+     * and are given the chance to update it on every pass.
+     */
+    if (!changed && (perf_ctx->config->plugins_count == 0)) {
+        return;
+    }
 
-            update = (struct fc_perf_update){
-                .domain_id = get_dependency_id(i),
-                .level = tlevel,
-                .max_limit = tmax,
-                .min_limit = tmin,
-            };
+    for (i = 0; i < perf_ctx->domain_count; i++) {
+        if (perf_fch_domain_has_fastchannels(i)) {
+            domain_ctx = &perf_ctx->domain_ctx_table[i];
+            load_shadow_values(i, domain_ctx, &update);
 
             perf_plugins_handler_update(i, &update);
         }
@@ -547,21 +665,8 @@ static void perf_fch_process_plugins_handler(void)
 
     for (i = 0; i < perf_ctx->domain_count; i++) {
         if (perf_fch_domain_has_fastchannels(i)) {
-            set_limit = get_fc_set_limit_addr(i);
-            set_level = get_fc_set_level_addr(i);
-
             domain_ctx = &perf_ctx->domain_ctx_table[i];
-
-            load_tlimits(set_limit, &tmax, &tmin, domain_ctx);
-
-            load_tlevel(set_level, &tlevel, domain_ctx);
-
-            update = (struct fc_perf_update){
-                .domain_id = get_dependency_id(i),
-                .level = tlevel,
-                .max_limit = tmax,
-                .min_limit = tmin,
-            };
+            load_shadow_values(i, domain_ctx, &update);
 
             perf_plugins_handler_get(i, &update);
 
@@ -577,67 +682,112 @@ static void perf_fch_process_plugins_handler(void)
                 }),
                 &tlevel);
 
+            /*
+             * Leave DVFS alone when it has already been asked for this level
+             * and the physical domain is running at it, or refused it.
+             */
+            shadow = &domain_ctx->fch_shadow;
+            curr_level = perf_ctx
+                             ->domain_ctx_table[fwk_id_get_element_idx(
+                                 update.domain_id)]
+                             .curr_level;
+            if (!shadow->retry && (tlevel == shadow->requested_level) &&
+                ((tlevel == curr_level) || shadow->level_refused)) {
+                continue;
+            }
+
             status = perf_fch_ctx.perf_ctx->dvfs_api->set_level(
-                get_dependency_id(i), 0, tlevel);
+                update.domain_id, 0, tlevel);
             if (status != FWK_SUCCESS) {
                 FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
             }
+
+            shadow->requested_level = tlevel;
+            shadow->retry = fch_request_busy(status);
+            shadow->level_refused = fch_request_refused(status);
         }
     }
-
-    decrement_pending_req_count();
 }
 #endif
 
 #ifndef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
-static void perf_fch_process(void)
+/*
+ * Apply the values of the set fast channels of a domain, if they have changed
+ * since they were last applied or if the domain is no longer running with
+ * them.
+ */
+static void perf_fch_process_domain(unsigned int domain_idx)
 {
     struct mod_scmi_perf_fast_channel_limit *set_limit;
     struct scmi_perf_domain_ctx *domain_ctx;
+    struct fast_channel_shadow *shadow;
     uint32_t *set_level;
-    uint32_t tlevel, tmax, tmin;
-    unsigned int i;
+    bool changed;
     int status;
 
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
 
-    for (i = 0; i < perf_ctx->domain_count; i++) {
-        if (perf_fch_domain_has_fastchannels(i)) {
-            set_limit = get_fc_set_limit_addr(i);
-            set_level = get_fc_set_level_addr(i);
+    set_limit = get_fc_set_limit_addr(domain_idx);
+    set_level = get_fc_set_level_addr(domain_idx);
+    domain_ctx = &perf_ctx->domain_ctx_table[domain_idx];
+    shadow = &domain_ctx->fch_shadow;
 
-            domain_ctx = &perf_ctx->domain_ctx_table[i];
+    changed = fch_shadow_update(shadow, set_level, set_limit);
+    shadow->retry = false;
 
-            load_tlimits(set_limit, &tmax, &tmin, domain_ctx);
+    if ((set_level != NULL) && (shadow->level > 0) &&
+        (changed ||
+         (!shadow->level_refused &&
+          (shadow->level != domain_ctx->curr_level)))) {
+        status = perf_fch_ctx.api_fch_stub->perf_set_level(
+            get_dependency_id(domain_idx), 0, shadow->level);
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+        }
+        shadow->retry |= fch_request_busy(status);
+        shadow->level_refused = fch_request_refused(status);
+    }
 
-            load_tlevel(set_level, &tlevel, domain_ctx);
+    if (set_limit != NULL) {
+        if ((shadow->limits.range_max == 0) &&
+            (shadow->limits.range_min == 0)) {
+            return;
+        }
 
-            if (set_level != NULL && tlevel > 0) {
-                status = perf_fch_ctx.api_fch_stub->perf_set_level(
-                    get_dependency_id(i), 0, tlevel);
-                if (status != FWK_SUCCESS) {
-                    FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
-                }
-            }
-            if (set_limit != NULL) {
-                if ((tmax == 0) && (tmin == 0)) {
-                    continue;
-                }
-                status = perf_fch_ctx.api_fch_stub->perf_set_limits(
-                    get_dependency_id(i),
-                    0,
-                    &((struct mod_scmi_perf_level_limits){
-                        .minimum = tmin,
-                        .maximum = tmax,
-                    }));
-                if (status != FWK_SUCCESS) {
-                    FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
-                }
-            }
+        if (!changed &&
+            (shadow->limits_refused ||
+             ((shadow->limits.range_max == domain_ctx->level_limits.maximum) &&
+              (shadow->limits.range_min ==
+               domain_ctx->level_limits.minimum)))) {
+            return;
+        }
+
+        status = perf_fch_ctx.api_fch_stub->perf_set_limits(
+            get_dependency_id(domain_idx),
+            0,
+            &((struct mod_scmi_perf_level_limits){
+                .minimum = shadow->limits.range_min,
+                .maximum = shadow->limits.range_max,
+            }));
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
         }
+        shadow->retry |= fch_request_busy(status);
+        shadow->limits_refused = fch_request_refused(status);
     }
+}
+
+static void perf_fch_process(void)
+{
+    unsigned int i;
+
+    struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
 
-    decrement_pending_req_count();
+    for (i = 0; i < perf_ctx->domain_count; i++) {
+        if (perf_fch_domain_has_fastchannels(i)) {
+            perf_fch_process_domain(i);
+        }
+    }
 }
 #endif
 
@@ -698,7 +848,7 @@ static void *get_fch_local_address(
     fch_config = get_fch_config(domain_idx, fch_idx);
     fch_ctx = get_fch_ctx(domain_idx, fch_idx);
 
-    status = fch_context_init(fch_config, fch_ctx);
+    status = fch_context_init(domain_idx, fch_config, fch_ctx);
 
     if (status != FWK_SUCCESS) {
         return NULL;
@@ -795,6 +945,7 @@ int perf_fch_start(fwk_id_t id)
 
 int perf_fch_process_event(const struct fwk_event *event)
 {
+    const struct perf_fch_doorbell_params *params;
     int status;
     enum scmi_perf_event_idx event_idx =
         (enum scmi_perf_event_idx)fwk_id_get_event_idx(event->id);
@@ -807,6 +958,24 @@ int perf_fch_process_event(const struct fwk_event *event)
 #else
         perf_fch_process();
 #endif
+        decrement_pending_req_count();
+
+        status = FWK_SUCCESS;
+        break;
+
+    case SCMI_PERF_EVENT_IDX_FAST_CHANNELS_DOORBELL:
+        params = (const struct perf_fch_doorbell_params *)event->params;
+        if (params->domain_idx >= perf_fch_ctx.perf_ctx->domain_count) {
+            status = FWK_E_PARAM;
+            break;
+        }
+
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+        /* The plugins handler aggregates the requests of all the domains */
+        perf_fch_process_plugins_handler();
+#else
+        perf_fch_process_domain(params->domain_idx);
+#endif
 
         status = FWK_SUCCESS;
         break;
@@ -214,6 +214,18 @@ int mod_dvfs_domain_api_get_level_id(
     uint32_t level,
     size_t *level_id);
 
+/*!
+ * \brief Get the level id of the operating point nearest to a level.
+ *
+ * \param domain_id Element identifier of the domain.
+ * \param level Requested level.
+ * \param [out] level_id Level id inside the OPP table.
+ */
+int mod_dvfs_domain_api_get_nearest_level_id(
+    fwk_id_t domain_id,
+    uint32_t level,
+    size_t *level_id);
+
 /*!
  * \brief Get the worst-case transition latency of a domain.
  *
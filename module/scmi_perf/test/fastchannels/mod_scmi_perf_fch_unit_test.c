@@ -52,6 +52,7 @@ static const struct mod_dvfs_domain_api dvfs_domain_api = {
     .get_sustained_opp = mod_dvfs_domain_api_get_sustained_opp,
     .get_nth_opp = mod_dvfs_domain_api_get_nth_opp,
     .get_level_id = mod_dvfs_domain_api_get_level_id,
+    .get_nearest_level_id = mod_dvfs_domain_api_get_nearest_level_id,
     .get_opp_count = mod_dvfs_domain_api_get_opp_count,
     .get_latency = mod_dvfs_domain_api_get_latency,
     .set_level = mod_dvfs_domain_api_set_level,
@@ -534,6 +535,240 @@ void utest_perf_fch_init_success(void)
         SCMI_PERF_FC_MIN_RATE_LIMIT, perf_fch_ctx.fast_channels_rate_limit);
 }
 
+static struct scmi_perf_domain_ctx fch_domain_ctx_table[PERF_DOMAINS_IDX_COUNT];
+static uint32_t fch_set_level;
+static struct mod_scmi_perf_fast_channel_limit fch_set_limit;
+
+static unsigned int set_level_count;
+static unsigned int set_limits_count;
+static uint32_t last_level;
+static int set_level_status;
+static int set_limits_status;
+
+/* The domain reaches the requested level and limits straight away */
+static int fake_perf_set_level(
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    uint32_t perf_level)
+{
+    set_level_count++;
+    last_level = perf_level;
+
+    if (set_level_status == FWK_SUCCESS) {
+        fch_domain_ctx_table[SCMI_PERF_ELEMENT_IDX_0].curr_level = perf_level;
+    }
+
+    return set_level_status;
+}
+
+static int fake_perf_set_limits(
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    const struct mod_scmi_perf_level_limits *limits)
+{
+    set_limits_count++;
+
+    if (set_limits_status == FWK_SUCCESS) {
+        fch_domain_ctx_table[SCMI_PERF_ELEMENT_IDX_0].level_limits = *limits;
+    }
+
+    return set_limits_status;
+}
+
+static struct mod_scmi_perf_private_api_perf_stub fch_api_stub = {
+    .perf_set_level = fake_perf_set_level,
+    .perf_set_limits = fake_perf_set_limits,
+};
+
+static void fch_process_setup(void)
+{
+    struct fast_channel_ctx *fch_ctx;
+
+    memset(fch_domain_ctx_table, 0, sizeof(fch_domain_ctx_table));
+    fch_ctx = fch_domain_ctx_table[SCMI_PERF_ELEMENT_IDX_0].fch_ctx;
+    fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET]
+        .fch_address.local_view_address = (uintptr_t)&fch_set_level;
+    fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET]
+        .fch_address.local_view_address = (uintptr_t)&fch_set_limit;
+
+    scmi_perf_ctx.domain_ctx_table = fch_domain_ctx_table;
+    perf_fch_ctx.api_fch_stub = &fch_api_stub;
+
+    fch_set_level = 0;
+    fch_set_limit = (struct mod_scmi_perf_fast_channel_limit){ 0 };
+    set_level_count = 0;
+    set_limits_count = 0;
+    last_level = 0;
+    set_level_status = FWK_SUCCESS;
+    set_limits_status = FWK_SUCCESS;
+}
+
+static int fch_process(enum scmi_perf_event_idx event_idx, uint32_t domain_idx)
+{
+    struct fwk_event event = { 0 };
+    struct perf_fch_doorbell_params *params =
+        (struct perf_fch_doorbell_params *)event.params;
+
+    params->domain_idx = domain_idx;
+
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(event_idx);
+
+    return perf_fch_process_event(&event);
+}
+
+void utest_perf_fch_process_changed_only(void)
+{
+    int status;
+
+    fch_process_setup();
+
+    /* Fast channels still holding their initial values are ignored */
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, set_level_count);
+    TEST_ASSERT_EQUAL(0, set_limits_count);
+
+    fch_set_level = 300 * 1000000UL;
+    fch_set_limit.range_max = 400 * 1000000UL;
+    fch_set_limit.range_min = 100 * 1000000UL;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, set_level_count);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+    TEST_ASSERT_EQUAL(fch_set_level, last_level);
+
+    /* Nothing has been written since */
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, set_level_count);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+
+    fch_set_level = 200 * 1000000UL;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, set_level_count);
+    TEST_ASSERT_EQUAL(fch_set_level, last_level);
+}
+
+void utest_perf_fch_process_retry(void)
+{
+    int status;
+
+    fch_process_setup();
+
+    fch_set_level = 500 * 1000000UL;
+    set_level_status = FWK_E_BUSY;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, set_level_count);
+
+    /* A request the domain was too busy for is made again, though unchanged */
+    set_level_status = FWK_PENDING;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, set_level_count);
+
+    /* A pending request has been accepted */
+    fch_domain_ctx_table[SCMI_PERF_ELEMENT_IDX_0].curr_level = fch_set_level;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, set_level_count);
+}
+
+void utest_perf_fch_process_refused(void)
+{
+    int status;
+
+    fch_process_setup();
+
+    fch_set_level = 500 * 1000000UL;
+    fch_set_limit.range_max = 400 * 1000000UL;
+    fch_set_limit.range_min = 100 * 1000000UL;
+    set_level_status = FWK_E_RANGE;
+    set_limits_status = FWK_E_PARAM;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, set_level_count);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+
+    /* Refused values are not requested again until they change */
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, set_level_count);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+
+    set_level_status = FWK_SUCCESS;
+    fch_set_level = 300 * 1000000UL;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, set_level_count);
+    TEST_ASSERT_EQUAL(fch_set_level, last_level);
+}
+
+void utest_perf_fch_process_domain_moved(void)
+{
+    struct scmi_perf_domain_ctx *domain_ctx;
+    int status;
+
+    fch_process_setup();
+    domain_ctx = &fch_domain_ctx_table[SCMI_PERF_ELEMENT_IDX_0];
+
+    fch_set_level = 300 * 1000000UL;
+    fch_set_limit.range_max = 400 * 1000000UL;
+    fch_set_limit.range_min = 100 * 1000000UL;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, set_level_count);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+
+    /* The domain was moved to another level through another path */
+    domain_ctx->curr_level = 200 * 1000000UL;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, set_level_count);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+    TEST_ASSERT_EQUAL(fch_set_level, last_level);
+
+    /* And was then given other limits */
+    domain_ctx->level_limits.maximum = 200 * 1000000UL;
+
+    status = fch_process(SCMI_PERF_EVENT_IDX_FAST_CHANNELS_PROCESS, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, set_level_count);
+    TEST_ASSERT_EQUAL(2, set_limits_count);
+    TEST_ASSERT_EQUAL(
+        fch_set_limit.range_max, domain_ctx->level_limits.maximum);
+}
+
+void utest_perf_fch_process_doorbell(void)
+{
+    int status;
+
+    fch_process_setup();
+
+    fch_set_level = 100 * 1000000UL;
+
+    status = fch_process(
+        SCMI_PERF_EVENT_IDX_FAST_CHANNELS_DOORBELL, SCMI_PERF_ELEMENT_IDX_0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, set_level_count);
+    TEST_ASSERT_EQUAL(fch_set_level, last_level);
+
+    status = fch_process(
+        SCMI_PERF_EVENT_IDX_FAST_CHANNELS_DOORBELL, scmi_perf_ctx.domain_count);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+    TEST_ASSERT_EQUAL(1, set_level_count);
+}
+
 int scmi_perf_fch_test_main(void)
 {
     UNITY_BEGIN();
@@ -550,6 +785,12 @@ int scmi_perf_fch_test_main(void)
 
     RUN_TEST(utest_perf_fch_init_success);
 
+    RUN_TEST(utest_perf_fch_process_changed_only);
+    RUN_TEST(utest_perf_fch_process_retry);
+    RUN_TEST(utest_perf_fch_process_refused);
+    RUN_TEST(utest_perf_fch_process_domain_moved);
+    RUN_TEST(utest_perf_fch_process_doorbell);
+
     return UNITY_END();
 }
 
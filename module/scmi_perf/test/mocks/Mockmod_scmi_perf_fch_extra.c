@@ -19,6 +19,7 @@ static const char* CMockString_message_id = "message_id";
 static const char* CMockString_mod_dvfs_domain_api_get_current_opp = "mod_dvfs_domain_api_get_current_opp";
 static const char* CMockString_mod_dvfs_domain_api_get_latency = "mod_dvfs_domain_api_get_latency";
 static const char* CMockString_mod_dvfs_domain_api_get_level_id = "mod_dvfs_domain_api_get_level_id";
+static const char* CMockString_mod_dvfs_domain_api_get_nearest_level_id = "mod_dvfs_domain_api_get_nearest_level_id";
 static const char* CMockString_mod_dvfs_domain_api_get_nth_opp = "mod_dvfs_domain_api_get_nth_opp";
 static const char* CMockString_mod_dvfs_domain_api_get_opp_count = "mod_dvfs_domain_api_get_opp_count";
 static const char* CMockString_mod_dvfs_domain_api_get_sustained_opp = "mod_dvfs_domain_api_get_sustained_opp";
@@ -277,6 +278,24 @@ typedef struct _CMOCK_mod_dvfs_domain_api_get_level_id_CALL_INSTANCE
 
 } CMOCK_mod_dvfs_domain_api_get_level_id_CALL_INSTANCE;
 
+typedef struct _CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_domain_id;
+  uint32_t Expected_level;
+  size_t* Expected_level_id;
+  int Expected_level_id_Depth;
+  char ReturnThruPtr_level_id_Used;
+  size_t* ReturnThruPtr_level_id_Val;
+  size_t ReturnThruPtr_level_id_Size;
+  char IgnoreArg_domain_id;
+  char IgnoreArg_level;
+  char IgnoreArg_level_id;
+
+} CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE;
+
 typedef struct _CMOCK_mod_dvfs_domain_api_get_latency_CALL_INSTANCE
 {
   UNITY_LINE_TYPE LineNumber;
@@ -419,6 +438,12 @@ static struct Mockmod_scmi_perf_fch_extraInstance
   CMOCK_mod_dvfs_domain_api_get_level_id_CALLBACK mod_dvfs_domain_api_get_level_id_CallbackFunctionPointer;
   int mod_dvfs_domain_api_get_level_id_CallbackCalls;
   CMOCK_MEM_INDEX_TYPE mod_dvfs_domain_api_get_level_id_CallInstance;
+  char mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool;
+  int mod_dvfs_domain_api_get_nearest_level_id_FinalReturn;
+  char mod_dvfs_domain_api_get_nearest_level_id_CallbackBool;
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALLBACK mod_dvfs_domain_api_get_nearest_level_id_CallbackFunctionPointer;
+  int mod_dvfs_domain_api_get_nearest_level_id_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mod_dvfs_domain_api_get_nearest_level_id_CallInstance;
   char mod_dvfs_domain_api_get_latency_IgnoreBool;
   int mod_dvfs_domain_api_get_latency_FinalReturn;
   char mod_dvfs_domain_api_get_latency_CallbackBool;
@@ -627,6 +652,19 @@ void Mockmod_scmi_perf_fch_extra_Verify(void)
     call_instance = CMOCK_GUTS_NONE;
     (void)call_instance;
   }
+  call_instance = Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance;
+  if (Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_mod_dvfs_domain_api_get_nearest_level_id);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
   call_instance = Mock.mod_dvfs_domain_api_get_latency_CallInstance;
   if (Mock.mod_dvfs_domain_api_get_latency_IgnoreBool)
     call_instance = CMOCK_GUTS_NONE;
@@ -3045,6 +3083,186 @@ void mod_dvfs_domain_api_get_level_id_CMockIgnoreArg_level_id(UNITY_LINE_TYPE cm
   cmock_call_instance->IgnoreArg_level_id = 1;
 }
 
+int mod_dvfs_domain_api_get_nearest_level_id(fwk_id_t domain_id, uint32_t level, size_t* level_id)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mod_dvfs_domain_api_get_nearest_level_id);
+  cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance);
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance = CMock_Guts_MemNext(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance);
+  if (Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.mod_dvfs_domain_api_get_nearest_level_id_FinalReturn;
+    Mock.mod_dvfs_domain_api_get_nearest_level_id_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackBool &&
+      Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackFunctionPointer(domain_id, level, level_id, Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_domain_id)
+  {
+    UNITY_SET_DETAILS(CMockString_mod_dvfs_domain_api_get_nearest_level_id,CMockString_domain_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_domain_id), (void*)(&domain_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_level)
+  {
+    UNITY_SET_DETAILS(CMockString_mod_dvfs_domain_api_get_nearest_level_id,CMockString_level);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_level, level, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_level_id)
+  {
+    UNITY_SET_DETAILS(CMockString_mod_dvfs_domain_api_get_nearest_level_id,CMockString_level_id);
+    if (cmock_call_instance->Expected_level_id == NULL)
+      { UNITY_TEST_ASSERT_NULL(level_id, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((void*)(cmock_call_instance->Expected_level_id), (void*)(level_id), sizeof(size_t), cmock_call_instance->Expected_level_id_Depth, cmock_line, CMockStringMismatch); }
+  }
+  }
+  if (Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackFunctionPointer(domain_id, level, level_id, Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackCalls++);
+  }
+  if (cmock_call_instance->ReturnThruPtr_level_id_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(level_id, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)level_id, (void*)cmock_call_instance->ReturnThruPtr_level_id_Val,
+      cmock_call_instance->ReturnThruPtr_level_id_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_mod_dvfs_domain_api_get_nearest_level_id(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance, fwk_id_t domain_id, uint32_t level, size_t* level_id, int level_id_Depth);
+void CMockExpectParameters_mod_dvfs_domain_api_get_nearest_level_id(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance, fwk_id_t domain_id, uint32_t level, size_t* level_id, int level_id_Depth)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_domain_id), (void*)(&domain_id),
+         sizeof(fwk_id_t[sizeof(domain_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_domain_id = 0;
+  cmock_call_instance->Expected_level = level;
+  cmock_call_instance->IgnoreArg_level = 0;
+  cmock_call_instance->Expected_level_id = level_id;
+  cmock_call_instance->Expected_level_id_Depth = level_id_Depth;
+  cmock_call_instance->IgnoreArg_level_id = 0;
+  cmock_call_instance->ReturnThruPtr_level_id_Used = 0;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE));
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance = CMock_Guts_MemChain(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance, cmock_guts_index);
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool = (char)1;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockStopIgnore(void)
+{
+  if(Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool)
+    Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance = CMock_Guts_MemNext(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance);
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool = (char)0;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE));
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance = CMock_Guts_MemChain(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance, cmock_guts_index);
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t domain_id, uint32_t level, size_t* level_id, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE));
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance = CMock_Guts_MemChain(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance, cmock_guts_index);
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_mod_dvfs_domain_api_get_nearest_level_id(cmock_call_instance, domain_id, level, level_id, 1);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_AddCallback(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALLBACK Callback)
+{
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool = (char)0;
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackBool = (char)1;
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackFunctionPointer = Callback;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_Stub(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALLBACK Callback)
+{
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool = (char)0;
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackBool = (char)0;
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallbackFunctionPointer = Callback;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t domain_id, uint32_t level, size_t* level_id, int level_id_Depth, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE));
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance = CMock_Guts_MemChain(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance, cmock_guts_index);
+  Mock.mod_dvfs_domain_api_get_nearest_level_id_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_mod_dvfs_domain_api_get_nearest_level_id(cmock_call_instance, domain_id, level, level_id, level_id_Depth);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockReturnMemThruPtr_level_id(UNITY_LINE_TYPE cmock_line, size_t* level_id, size_t cmock_size)
+{
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_level_id_Used = 1;
+  cmock_call_instance->ReturnThruPtr_level_id_Val = level_id;
+  cmock_call_instance->ReturnThruPtr_level_id_Size = cmock_size;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_domain_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_domain_id = 1;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_level = 1;
+}
+
+void mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_level_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mod_dvfs_domain_api_get_nearest_level_id_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_level_id = 1;
+}
+
 int mod_dvfs_domain_api_get_latency(fwk_id_t domain_id, uint16_t* latency)
 {
   UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
@@ -332,6 +332,30 @@ void mod_dvfs_domain_api_get_level_id_CMockIgnoreArg_domain_id(UNITY_LINE_TYPE c
 void mod_dvfs_domain_api_get_level_id_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line);
 #define mod_dvfs_domain_api_get_level_id_IgnoreArg_level_id() mod_dvfs_domain_api_get_level_id_CMockIgnoreArg_level_id(__LINE__)
 void mod_dvfs_domain_api_get_level_id_CMockIgnoreArg_level_id(UNITY_LINE_TYPE cmock_line);
+#define mod_dvfs_domain_api_get_nearest_level_id_IgnoreAndReturn(cmock_retval) mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define mod_dvfs_domain_api_get_nearest_level_id_StopIgnore() mod_dvfs_domain_api_get_nearest_level_id_CMockStopIgnore()
+void mod_dvfs_domain_api_get_nearest_level_id_CMockStopIgnore(void);
+#define mod_dvfs_domain_api_get_nearest_level_id_ExpectAnyArgsAndReturn(cmock_retval) mod_dvfs_domain_api_get_nearest_level_id_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void mod_dvfs_domain_api_get_nearest_level_id_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define mod_dvfs_domain_api_get_nearest_level_id_ExpectAndReturn(domain_id, level, level_id, cmock_retval) mod_dvfs_domain_api_get_nearest_level_id_CMockExpectAndReturn(__LINE__, domain_id, level, level_id, cmock_retval)
+void mod_dvfs_domain_api_get_nearest_level_id_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t domain_id, uint32_t level, size_t* level_id, int cmock_to_return);
+typedef int (* CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALLBACK)(fwk_id_t domain_id, uint32_t level, size_t* level_id, int cmock_num_calls);
+void mod_dvfs_domain_api_get_nearest_level_id_AddCallback(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALLBACK Callback);
+void mod_dvfs_domain_api_get_nearest_level_id_Stub(CMOCK_mod_dvfs_domain_api_get_nearest_level_id_CALLBACK Callback);
+#define mod_dvfs_domain_api_get_nearest_level_id_StubWithCallback mod_dvfs_domain_api_get_nearest_level_id_Stub
+#define mod_dvfs_domain_api_get_nearest_level_id_ExpectWithArrayAndReturn(domain_id, level, level_id, level_id_Depth, cmock_retval) mod_dvfs_domain_api_get_nearest_level_id_CMockExpectWithArrayAndReturn(__LINE__, domain_id, level, level_id, level_id_Depth, cmock_retval)
+void mod_dvfs_domain_api_get_nearest_level_id_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t domain_id, uint32_t level, size_t* level_id, int level_id_Depth, int cmock_to_return);
+#define mod_dvfs_domain_api_get_nearest_level_id_ReturnThruPtr_level_id(level_id) mod_dvfs_domain_api_get_nearest_level_id_CMockReturnMemThruPtr_level_id(__LINE__, level_id, sizeof(size_t))
+#define mod_dvfs_domain_api_get_nearest_level_id_ReturnArrayThruPtr_level_id(level_id, cmock_len) mod_dvfs_domain_api_get_nearest_level_id_CMockReturnMemThruPtr_level_id(__LINE__, level_id, cmock_len * sizeof(*level_id))
+#define mod_dvfs_domain_api_get_nearest_level_id_ReturnMemThruPtr_level_id(level_id, cmock_size) mod_dvfs_domain_api_get_nearest_level_id_CMockReturnMemThruPtr_level_id(__LINE__, level_id, cmock_size)
+void mod_dvfs_domain_api_get_nearest_level_id_CMockReturnMemThruPtr_level_id(UNITY_LINE_TYPE cmock_line, size_t* level_id, size_t cmock_size);
+#define mod_dvfs_domain_api_get_nearest_level_id_IgnoreArg_domain_id() mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_domain_id(__LINE__)
+void mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_domain_id(UNITY_LINE_TYPE cmock_line);
+#define mod_dvfs_domain_api_get_nearest_level_id_IgnoreArg_level() mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_level(__LINE__)
+void mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line);
+#define mod_dvfs_domain_api_get_nearest_level_id_IgnoreArg_level_id() mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_level_id(__LINE__)
+void mod_dvfs_domain_api_get_nearest_level_id_CMockIgnoreArg_level_id(UNITY_LINE_TYPE cmock_line);
 #define mod_dvfs_domain_api_get_latency_IgnoreAndReturn(cmock_retval) mod_dvfs_domain_api_get_latency_CMockIgnoreAndReturn(__LINE__, cmock_retval)
 void mod_dvfs_domain_api_get_latency_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
 #define mod_dvfs_domain_api_get_latency_StopIgnore() mod_dvfs_domain_api_get_latency_CMockStopIgnore()
@@ -62,6 +62,7 @@ static const struct mod_dvfs_domain_api dvfs_domain_api = {
     .get_sustained_opp = mod_dvfs_domain_api_get_sustained_opp,
     .get_nth_opp = mod_dvfs_domain_api_get_nth_opp,
     .get_level_id = mod_dvfs_domain_api_get_level_id,
+    .get_nearest_level_id = mod_dvfs_domain_api_get_nearest_level_id,
     .get_opp_count = mod_dvfs_domain_api_get_opp_count,
     .get_latency = mod_dvfs_domain_api_get_latency,
     .set_level = mod_dvfs_domain_api_set_level,
@@ -69,6 +70,47 @@ static const struct mod_dvfs_domain_api dvfs_domain_api = {
 
 char *name = "Test Name";
 
+/*
+ * As the DVFS level lookups are mocked, they are emulated on the test OPP
+ * table.
+ */
+static int get_level_id_callback(
+    fwk_id_t domain_id,
+    uint32_t level,
+    size_t *level_id,
+    int NumCalls)
+{
+    size_t i;
+
+    for (i = 0; i < TEST_OPP_COUNT; i++) {
+        if (test_dvfs_config.opps[i].level == level) {
+            *level_id = i;
+            return FWK_SUCCESS;
+        }
+    }
+
+    return FWK_E_PARAM;
+}
+
+static int get_nearest_level_id_callback(
+    fwk_id_t domain_id,
+    uint32_t level,
+    size_t *level_id,
+    int NumCalls)
+{
+    size_t i;
+
+    for (i = 0; i < (TEST_OPP_COUNT - 1); i++) {
+        if (test_dvfs_config.opps[i].level >= level) {
+            break;
+        }
+    }
+
+    *level_id = i;
+
+    return FWK_SUCCESS;
+}
+
 void setUp(void)
 {
     scmi_perf_ctx.scmi_api = &from_protocol_api;
@@ -85,6 +127,10 @@ void setUp(void)
 #endif
 
     scmi_perf_ctx.dvfs_api = &dvfs_domain_api;
+
+    mod_dvfs_domain_api_get_level_id_Stub(get_level_id_callback);
+    mod_dvfs_domain_api_get_nearest_level_id_Stub(
+        get_nearest_level_id_callback);
 }
 
 void tearDown(void)
@@ -873,6 +919,42 @@ void utest_find_opp_for_level_use_nearest(void)
     TEST_ASSERT_EQUAL(level_limits.maximum, approximate_level);
 }
 
+/*
+ * Test the find_opp_for_level function with use_nearest and a reduced maximum
+ * limit. In this case, expect the nearest OPP below the limit to be found.
+ */
+void utest_find_opp_for_level_use_nearest_within_limits(void)
+{
+    int status;
+
+    struct perf_opp_table opp_table = {
+        .opps = test_dvfs_config.opps,
+        .opp_count = TEST_OPP_COUNT,
+    };
+
+    struct mod_scmi_perf_level_limits level_limits = {
+        .minimum = test_dvfs_config.opps[0].level,
+        .maximum = test_dvfs_config.opps[2].level - 1UL,
+    };
+
+    struct scmi_perf_domain_ctx domain_ctx = {
+        .level_limits = level_limits,
+        .opp_table = &opp_table,
+    };
+
+    uint32_t approximate_level = test_dvfs_config.opps[3].level + 1UL;
+
+    status = find_opp_for_level(&domain_ctx, &approximate_level, true);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(test_dvfs_config.opps[1].level, approximate_level);
+
+    approximate_level = test_dvfs_config.opps[0].level + 1UL;
+
+    status = find_opp_for_level(&domain_ctx, &approximate_level, true);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(test_dvfs_config.opps[1].level, approximate_level);
+}
+
 /*
  * Test the validate_new_limits function with a valid set of limits, without
  * approximating the level.
@@ -1054,6 +1136,7 @@ int scmi_perf_protocol_ops_test_main(void)
     RUN_TEST(utest_find_opp_for_level_valid_level);
     RUN_TEST(utest_find_opp_for_level_invalid_level);
     RUN_TEST(utest_find_opp_for_level_use_nearest);
+    RUN_TEST(utest_find_opp_for_level_use_nearest_within_limits);
 
     RUN_TEST(utest_validate_new_limits_valid_limits);
     RUN_TEST(utest_validate_new_limits_invalid_limits);
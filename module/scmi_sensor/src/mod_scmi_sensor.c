@@ -59,6 +59,9 @@ struct mod_scmi_sensor_ctx {
     /* Array of sensor values */
     struct mod_sensor_data *sensor_values;
 
+    /* Array of the maximum age of the readings returned, in microseconds */
+    fwk_duration_us_t *sensor_max_age;
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
     /* SCMI Resource Permissions API */
     const struct mod_res_permissions_api *res_perms_api;
@@ -1033,6 +1036,9 @@ static int scmi_sensor_init(fwk_id_t module_id,
         scmi_sensor_ctx.sensor_ops_table[i].service_id = FWK_ID_NONE;
     }
 
+    scmi_sensor_ctx.sensor_max_age = fwk_mm_calloc(
+        scmi_sensor_ctx.sensor_count, sizeof(fwk_duration_us_t));
+
     return FWK_SUCCESS;
 }
 
@@ -1109,10 +1115,32 @@ static int scmi_sensor_bind(fwk_id_t id, unsigned int round)
     return FWK_SUCCESS;
 }
 
+/*
+ * The value of a sensor is not expected to change faster than its update
+ * interval, so a reading taken within it is returned without a new read.
+ */
+static fwk_duration_us_t get_sensor_max_age(fwk_id_t sensor_id)
+{
+    struct mod_sensor_complete_info info;
+
+    if (scmi_sensor_ctx.sensor_api->get_info(sensor_id, &info) !=
+        FWK_SUCCESS) {
+        return 0;
+    }
+
+    return (fwk_duration_us_t)mod_sensor_update_interval_ms(&info.hal_info) *
+        1000;
+}
+
 static int scmi_sensor_start(fwk_id_t id)
 {
     int status = FWK_SUCCESS;
 
+    for (unsigned int i = 0; i < scmi_sensor_ctx.sensor_count; i++) {
+        scmi_sensor_ctx.sensor_max_age[i] =
+            get_sensor_max_age(FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, i));
+    }
+
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     status = scmi_init_notifications((int)scmi_sensor_ctx.sensor_count);
     if (status != FWK_SUCCESS) {
@@ -1158,15 +1186,30 @@ static int scmi_sensor_process_event(const struct fwk_event *event,
                                      struct fwk_event *resp_event)
 {
     int status;
+    unsigned int sensor_idx;
     struct scmi_sensor_event_parameters *scmi_params;
     struct mod_sensor_data *sensor_data;
 
     /* Request event to sensor HAL */
     if (fwk_id_is_equal(event->id, mod_scmi_sensor_event_id_get_request)) {
         scmi_params = (struct scmi_sensor_event_parameters *)event->params;
-        sensor_data = get_sensor_data(scmi_params->sensor_id);
-        status = scmi_sensor_ctx.sensor_api->get_data(
-            scmi_params->sensor_id, sensor_data);
+        sensor_idx = fwk_id_get_element_idx(scmi_params->sensor_id);
+        sensor_data = &scmi_sensor_ctx.sensor_values[sensor_idx];
+
+        /* Sensors sampled in the background are answered without a read */
+        if (scmi_sensor_ctx.sensor_api->get_snapshot != NULL) {
+            status = scmi_sensor_ctx.sensor_api->get_snapshot(
+                scmi_params->sensor_id, sensor_data);
+            if (status == FWK_SUCCESS) {
+                return scmi_sensor_reading_respond(
+                    scmi_params->sensor_id, sensor_data);
+            }
+        }
+
+        status = scmi_sensor_ctx.sensor_api->get_data_max_age(
+            scmi_params->sensor_id,
+            scmi_sensor_ctx.sensor_max_age[sensor_idx],
+            sensor_data);
         if (status != FWK_PENDING) {
             /* Sensor value is ready (successfully or not) */
             return scmi_sensor_reading_respond(
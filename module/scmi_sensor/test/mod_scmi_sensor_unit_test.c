@@ -30,20 +30,41 @@
 
 #include <config_scmi_sensor.h>
 
+/* Update interval of the fake sensor, in milliseconds */
+#define SCMI_SENSOR_FAKE_UPDATE_INTERVAL_MS 20
+
+static fwk_duration_us_t requested_max_age;
+static fwk_duration_us_t sensor_max_age[SCMI_SENSOR_VALUES];
+static unsigned int get_info_calls;
+
 static int scmi_sensor_driver_get_data_pass(
     fwk_id_t id,
+    fwk_duration_us_t max_age,
     struct mod_sensor_data *data)
 {
+    requested_max_age = max_age;
     return FWK_SUCCESS;
 }
 
 static int scmi_sensor_driver_get_data_fail(
     fwk_id_t id,
+    fwk_duration_us_t max_age,
     struct mod_sensor_data *data)
 {
+    requested_max_age = max_age;
     return FWK_PENDING;
 }
 
+static int scmi_sensor_driver_get_info(
+    fwk_id_t id,
+    struct mod_sensor_complete_info *info)
+{
+    info->hal_info.update_interval = SCMI_SENSOR_FAKE_UPDATE_INTERVAL_MS;
+    info->hal_info.update_interval_multiplier = -3;
+    get_info_calls++;
+    return FWK_SUCCESS;
+}
+
 static int scmi_sensor_driver_respond(
     fwk_id_t service_id,
     const void *payload,
@@ -75,8 +96,14 @@ static struct mod_scmi_from_protocol_api scmi_driver_api;
 
 void setUp(void)
 {
-    scmi_sensor_driver_api.get_data = scmi_sensor_driver_get_data_pass;
+    scmi_sensor_driver_api.get_data_max_age = scmi_sensor_driver_get_data_pass;
+    scmi_sensor_driver_api.get_info = scmi_sensor_driver_get_info;
+    requested_max_age = 0;
+    get_info_calls = 0;
     scmi_driver_api.respond = scmi_sensor_driver_respond;
+
+    memset(sensor_max_age, 0, sizeof(sensor_max_age));
+    scmi_sensor_ctx.sensor_max_age = sensor_max_age;
 }
 
 void tearDown(void)
@@ -125,6 +152,10 @@ void utest_scmi_sensor_init_success(void)
         SCMI_SENSOR_ELEMENT_COUNT_SINGLE,
         sizeof(struct sensor_operations),
         (void *)test_sensor_operations);
+    fwk_mm_calloc_ExpectAndReturn(
+        SCMI_SENSOR_ELEMENT_COUNT_SINGLE,
+        sizeof(fwk_duration_us_t),
+        (void *)sensor_max_age);
 
     test_sensor_operations[0].service_id = fwk_module_id_scmi_sensor;
 
@@ -159,6 +190,10 @@ void utest_scmi_sensor_init_success_cap_elem_count(void)
         SCMI_SENSOR_ELEMENT_COUNT_MAXIMUM,
         sizeof(struct sensor_operations),
         (void *)test_sensor_operations);
+    fwk_mm_calloc_ExpectAndReturn(
+        SCMI_SENSOR_ELEMENT_COUNT_MAXIMUM,
+        sizeof(fwk_duration_us_t),
+        (void *)sensor_max_age);
 
     test_sensor_operations[SCMI_SENSOR_ELEMENT_INDEX_ZERO].service_id =
         fwk_module_id_scmi_sensor;
@@ -258,10 +293,17 @@ void utest_scmi_sensor_start(void)
 
     fwk_id_t elem_id = FWK_ID_NONE;
 
-    /* nothing to do without SCMI notifications */
+    scmi_sensor_ctx.sensor_count = SCMI_SENSOR_VALUES;
+    scmi_sensor_ctx.sensor_api = &scmi_sensor_driver_api;
+
+    /* readings up to the update interval old are accepted */
     status = scmi_sensor_start(elem_id);
 
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(SCMI_SENSOR_VALUES, get_info_calls);
+    TEST_ASSERT_EQUAL(
+        SCMI_SENSOR_FAKE_UPDATE_INTERVAL_MS * 1000,
+        sensor_max_age[SCMI_SENSOR_FAKE_INDEX_0]);
 }
 
 void utest_scmi_sensor_process_bind_request_invalid_source_id(void)
@@ -472,9 +514,15 @@ void utest_scmi_sensor_process_event_is_hal_request_not_pending(void)
     fwk_id_get_element_idx_ExpectAndReturn(
         scmi_params->sensor_id, SCMI_SENSOR_FAKE_INDEX_0);
 
+    sensor_max_age[SCMI_SENSOR_FAKE_INDEX_0] =
+        SCMI_SENSOR_FAKE_UPDATE_INTERVAL_MS * 1000;
+
     status = scmi_sensor_process_event(&event, &response_event);
 
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(
+        SCMI_SENSOR_FAKE_UPDATE_INTERVAL_MS * 1000, requested_max_age);
+    TEST_ASSERT_EQUAL(0, get_info_calls);
 }
 
 void utest_scmi_sensor_process_event_is_hal_request_pending(void)
@@ -500,7 +548,7 @@ void utest_scmi_sensor_process_event_is_hal_request_pending(void)
 
     local_sensor_op[SCMI_SENSOR_FAKE_INDEX_0].service_id = service_id;
 
-    scmi_sensor_driver_api.get_data = scmi_sensor_driver_get_data_fail;
+    scmi_sensor_driver_api.get_data_max_age = scmi_sensor_driver_get_data_fail;
 
     scmi_sensor_ctx.sensor_api = &scmi_sensor_driver_api;
     scmi_sensor_ctx.scmi_api = &scmi_driver_api;
@@ -10,6 +10,7 @@
 
 #include <fwk_id.h>
 #include <fwk_module_idx.h>
+#include <fwk_time.h>
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -300,6 +301,32 @@ struct mod_sensor_info {
 #endif
 };
 
+/*!
+ * \brief Get the update interval of a sensor in milliseconds.
+ *
+ * \param info Sensor information.
+ *
+ * \pre \p info must not be NULL
+ *
+ * \return The update interval in milliseconds, rounded down and saturated to
+ *      UINT32_MAX, or zero if the sensor has no minimum update interval.
+ */
+static inline uint32_t mod_sensor_update_interval_ms(
+    const struct mod_sensor_info *info)
+{
+    uint64_t interval = info->update_interval;
+    int exponent = info->update_interval_multiplier + 3;
+
+    for (; exponent > 0 && interval <= UINT32_MAX; exponent--) {
+        interval *= 10;
+    }
+    for (; exponent < 0; exponent++) {
+        interval /= 10;
+    }
+
+    return (interval > UINT32_MAX) ? UINT32_MAX : (uint32_t)interval;
+}
+
 /*!
  * \brief Structure containing all sensor information for SCMI requests.
  *
@@ -413,6 +440,27 @@ struct mod_sensor_data {
 #endif
 };
 
+/*!
+ * \brief Sensor reading cache statistics.
+ *
+ * \details Every data request is accounted for in exactly one of the
+ *      counters, so the hit rate of a sensor is given by:
+ *
+ *      ```none
+ *      hits / (hits + shared_reads + driver_reads)
+ *      ```
+ */
+struct mod_sensor_cache_stats {
+    /*! Requests served from a reading recent enough for the caller */
+    uint32_t hits;
+
+    /*! Requests served by a driver reading already in progress */
+    uint32_t shared_reads;
+
+    /*! Requests which started a new driver reading */
+    uint32_t driver_reads;
+};
+
 /*!
  * \brief Sensor module configuration.
  *
@@ -424,6 +472,26 @@ struct mod_sensor_config {
 
     /*! Trip point API identifier */
     fwk_id_t trip_point_api_id;
+
+    /*!
+     * \brief Alarm ticking the background sampling of the sensors.
+     *
+     * \details Only used when ::mod_sensor_config::sampling_tick_ms is not
+     *      zero.
+     */
+    fwk_id_t sampling_alarm_id;
+
+    /*!
+     * \brief Period of the sampling alarm in milliseconds, or zero to disable
+     *      background sampling.
+     *
+     * \details When enabled, every single-axis sensor is read at its update
+     *      interval, rounded up to a multiple of this period, and the reading
+     *      is published to a snapshot which can be read through
+     *      ::mod_sensor_api::get_snapshot without accessing the driver. The
+     *      trip points of these sensors are then only evaluated on sampling.
+     */
+    unsigned int sampling_tick_ms;
 };
 
 /*!
@@ -509,6 +577,27 @@ struct mod_sensor_driver_api {
         unsigned int *update_interval,
         int *update_interval_multiplier);
 
+    /*!
+     * \brief Get the values of several sensors at once.
+     *
+     * \details Optional. The sensors bound to the same driver API which are
+     *      due for background sampling at the same time are read through this
+     *      function, so that the driver can group the accesses into a single
+     *      transaction. The read must complete synchronously.
+     *
+     * \param id Table of \p count sensor device ids.
+     * \param[out] value Table receiving the \p count sensor values.
+     * \param count Number of sensors to read.
+     *
+     * \retval ::FWK_SUCCESS All the values were read successfully.
+     * \return One of the standard framework error codes. The sensors are then
+     *      read one at a time through ::mod_sensor_driver_api::get_value.
+     */
+    int (*get_value_batch)(
+        const fwk_id_t *id,
+        mod_sensor_value_t *value,
+        unsigned int count);
+
 #ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     /*!
      * \brief Get number of axis.
@@ -672,6 +761,62 @@ struct mod_sensor_api {
         unsigned int *time_interval,
         int *time_interval_multiplier);
 
+    /*!
+     * \brief Read sensor data, accepting a recent reading.
+     *
+     * \details Behaves as ::mod_sensor_api::get_data, except that the last
+     *      successful reading of the sensor is returned without accessing the
+     *      driver when it is not older than \p max_age. When a new reading is
+     *      needed and one is already in progress, the request waits for it
+     *      rather than starting another one. Readings are timestamped with
+     *      ::fwk_time_current, so without a time source every request reads
+     *      the sensor.
+     *
+     * \param id Specific sensor device id.
+     * \param max_age Maximum age of an acceptable reading, in microseconds.
+     *      Zero always requests a new reading.
+     * \param[out] data Sensor struct data will be returned.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_DEVICE Driver error.
+     * \retval ::FWK_E_BUSY Too many requests are waiting for a reading.
+     * \retval ::FWK_PENDING The request is pending. The requested data will be
+     *      provided via a response event.
+     * \return One of the standard framework error codes.
+     */
+    int (*get_data_max_age)(
+        fwk_id_t id,
+        fwk_duration_us_t max_age,
+        struct mod_sensor_data *data);
+
+    /*!
+     * \brief Get the reading cache statistics of a sensor.
+     *
+     * \param id Specific sensor device id.
+     * \param[out] stats Cache statistics of the sensor.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM \p stats is NULL.
+     */
+    int (*get_cache_stats)(fwk_id_t id, struct mod_sensor_cache_stats *stats);
+
+    /*!
+     * \brief Get the last reading of a sensor taken by background sampling.
+     *
+     * \details The driver is not accessed, and the call can be made from any
+     *      context. The status of the reading is returned in \p data.
+     *
+     * \param id Specific sensor device id.
+     * \param[out] data Sensor struct data will be returned.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM \p data is NULL.
+     * \retval ::FWK_E_SUPPORT The sensor is not sampled in the background.
+     * \retval ::FWK_E_INIT The sensor has not been sampled yet.
+     * \retval ::FWK_E_BUSY The snapshot kept changing while being read.
+     */
+    int (*get_snapshot)(fwk_id_t id, struct mod_sensor_data *data);
+
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
     /*!
      * \brief Configure timestamp
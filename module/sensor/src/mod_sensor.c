@@ -16,11 +16,13 @@
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 #include <fwk_status.h>
 #include <fwk_string.h>
+#include <fwk_time.h>
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -132,6 +134,11 @@ static void trip_point_process(fwk_id_t id, struct mod_sensor_data *data)
 }
 #endif
 
+static inline bool is_sensor_sampled(const struct sensor_dev_ctx *ctx)
+{
+    return ctx->sampling.interval_ms != 0;
+}
+
 static int is_sensor_enabled(fwk_id_t id, bool *sensor_is_enabled)
 {
     int status;
@@ -157,10 +164,263 @@ static int is_sensor_enabled(fwk_id_t id, bool *sensor_is_enabled)
     return FWK_E_PARAM;
 }
 
+/*
+ * Check whether the last reading can be returned to a caller accepting readings
+ * up to max_age microseconds old. Without a time source fwk_time_current()
+ * returns zero, and a reading with a zero timestamp is never fresh.
+ */
+static bool is_last_read_fresh(
+    const struct sensor_dev_ctx *ctx,
+    fwk_duration_us_t max_age)
+{
+    if ((max_age == 0) || (ctx->last_read.status != FWK_SUCCESS) ||
+        (ctx->last_read_time == 0)) {
+        return false;
+    }
+
+    return (fwk_time_current() - ctx->last_read_time) <= FWK_US(max_age);
+}
+
+/*
+ * Background sampling
+ */
+
+static int sampling_set_interval(struct sensor_dev_ctx *ctx)
+{
+    int status;
+    struct mod_sensor_info info;
+    uint32_t tick_ms = sensor_mod_ctx.config->sampling_tick_ms;
+    uint32_t interval_ms;
+
+    /* Only single-axis sensors are sampled */
+    if (ctx->axis_count > 1) {
+        return FWK_SUCCESS;
+    }
+
+    status = ctx->driver_api->get_info(ctx->config->driver_id, &info);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* Sensors without a minimum interval are read on every tick */
+    interval_ms = FWK_MAX(mod_sensor_update_interval_ms(&info), tick_ms);
+
+    /* Sensors are only read on ticks, so the interval is made whole ticks */
+    ctx->sampling.interval_ms = (interval_ms > (UINT32_MAX - tick_ms)) ?
+        FWK_ALIGN_PREVIOUS(UINT32_MAX, tick_ms) :
+        FWK_ALIGN_NEXT(interval_ms, tick_ms);
+
+    /* Read the sensor on the next tick */
+    ctx->sampling.elapsed_ms = ctx->sampling.interval_ms - tick_ms;
+
+    return FWK_SUCCESS;
+}
+
+static void sampling_publish(fwk_id_t id, struct sensor_dev_ctx *ctx)
+{
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+    if (ctx->last_read.status == FWK_SUCCESS) {
+        trip_point_process(id, &ctx->last_read);
+    }
+#endif
+
+    ctx->snapshot.seq++;
+    __sync_synchronize();
+    ctx->snapshot.data = ctx->last_read;
+    __sync_synchronize();
+    ctx->snapshot.seq++;
+}
+
+static void sampling_complete(
+    fwk_id_t id,
+    struct sensor_dev_ctx *ctx,
+    int status)
+{
+    ctx->last_read.status = status;
+    if (status == FWK_SUCCESS) {
+        ctx->last_read_time = fwk_time_current();
+#ifdef BUILD_HAS_SENSOR_TIMESTAMP
+        ctx->last_read.timestamp = sensor_get_timestamp(id);
+#endif
+    }
+
+    sampling_publish(id, ctx);
+}
+
+static void sampling_read(unsigned int idx)
+{
+    int status;
+    struct sensor_dev_ctx *ctx = &ctx_table[idx];
+    fwk_id_t id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, idx);
+
+    status = ctx->driver_api->get_value(
+        ctx->config->driver_id, &ctx->last_read.value);
+    if (status == FWK_PENDING) {
+        /* Published when the read complete event is processed */
+        ctx->sampling.read_pending = true;
+        return;
+    }
+
+    sampling_complete(id, ctx, status);
+}
+
+static bool sampling_is_due(struct sensor_dev_ctx *ctx)
+{
+    struct mod_sensor_info info;
+
+    if (!is_sensor_sampled(ctx)) {
+        return false;
+    }
+
+    ctx->sampling.elapsed_ms += sensor_mod_ctx.config->sampling_tick_ms;
+    if (ctx->sampling.elapsed_ms < ctx->sampling.interval_ms) {
+        return false;
+    }
+
+    /* Wait for the reading in progress rather than starting another one */
+    if (ctx->sampling.read_pending ||
+        (ctx->concurrency_readings.pending_requests != 0) ||
+        ctx->concurrency_readings.dequeuing) {
+        return false;
+    }
+
+    ctx->sampling.elapsed_ms = 0;
+
+    if (ctx->driver_api->get_info(ctx->config->driver_id, &info) !=
+        FWK_SUCCESS) {
+        return false;
+    }
+
+    return !info.disabled;
+}
+
+/*
+ * Read the sensors which are due, grouping the ones sharing a driver API which
+ * supports batched reads.
+ */
+static int sampling_process(void)
+{
+    int status;
+    unsigned int i, j, count;
+    struct sensor_dev_ctx *ctx, *other;
+
+    sensor_mod_ctx.sampling.tick_pending = false;
+
+    for (i = 0; i < sensor_mod_ctx.element_count; i++) {
+        ctx_table[i].sampling.due = sampling_is_due(&ctx_table[i]);
+    }
+
+    for (i = 0; i < sensor_mod_ctx.element_count; i++) {
+        ctx = &ctx_table[i];
+        if (!ctx->sampling.due) {
+            continue;
+        }
+
+        count = 0;
+        if (ctx->driver_api->get_value_batch != NULL) {
+            for (j = i; j < sensor_mod_ctx.element_count; j++) {
+                other = &ctx_table[j];
+                if (other->sampling.due &&
+                    (other->driver_api == ctx->driver_api)) {
+                    other->sampling.due = false;
+                    sensor_mod_ctx.sampling.batch_idx[count] = j;
+                    sensor_mod_ctx.sampling.batch_ids[count] =
+                        other->config->driver_id;
+                    count++;
+                }
+            }
+        }
+
+        if (count <= 1) {
+            ctx->sampling.due = false;
+            sampling_read(i);
+            continue;
+        }
+
+        status = ctx->driver_api->get_value_batch(
+            sensor_mod_ctx.sampling.batch_ids,
+            sensor_mod_ctx.sampling.batch_values,
+            count);
+
+        for (j = 0; j < count; j++) {
+            if (status != FWK_SUCCESS) {
+                sampling_read(sensor_mod_ctx.sampling.batch_idx[j]);
+                continue;
+            }
+
+            other = &ctx_table[sensor_mod_ctx.sampling.batch_idx[j]];
+            other->last_read.value = sensor_mod_ctx.sampling.batch_values[j];
+            sampling_complete(
+                FWK_ID_ELEMENT(
+                    FWK_MODULE_IDX_SENSOR, sensor_mod_ctx.sampling.batch_idx[j]),
+                other,
+                FWK_SUCCESS);
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+#ifdef BUILD_HAS_MOD_TIMER
+static void sampling_alarm_callback(uintptr_t param)
+{
+    struct fwk_event_light event;
+
+    if (sensor_mod_ctx.sampling.tick_pending) {
+        return;
+    }
+
+    event = (struct fwk_event_light){
+        .id = mod_sensor_event_id_sample,
+        .source_id = fwk_module_id_sensor,
+        .target_id = fwk_module_id_sensor,
+    };
+
+    sensor_mod_ctx.sampling.tick_pending = true;
+
+    if (fwk_put_event(&event) != FWK_SUCCESS) {
+        sensor_mod_ctx.sampling.tick_pending = false;
+    }
+}
+#endif
+
+static int sampling_start(void)
+{
+    unsigned int count = sensor_mod_ctx.element_count;
+
+    if ((sensor_mod_ctx.config == NULL) ||
+        (sensor_mod_ctx.config->sampling_tick_ms == 0)) {
+        return FWK_SUCCESS;
+    }
+
+#ifdef BUILD_HAS_MOD_TIMER
+    sensor_mod_ctx.sampling.batch_ids =
+        fwk_mm_calloc(count, sizeof(sensor_mod_ctx.sampling.batch_ids[0]));
+    sensor_mod_ctx.sampling.batch_values =
+        fwk_mm_calloc(count, sizeof(sensor_mod_ctx.sampling.batch_values[0]));
+    sensor_mod_ctx.sampling.batch_idx =
+        fwk_mm_calloc(count, sizeof(sensor_mod_ctx.sampling.batch_idx[0]));
+
+    return sensor_mod_ctx.sampling.alarm_api->start(
+        sensor_mod_ctx.config->sampling_alarm_id,
+        sensor_mod_ctx.config->sampling_tick_ms,
+        MOD_TIMER_ALARM_TYPE_PERIODIC,
+        sampling_alarm_callback,
+        0);
+#else
+    (void)count;
+
+    return FWK_E_SUPPORT;
+#endif
+}
+
 /*
  * Module API
  */
-static int get_data(fwk_id_t id, struct mod_sensor_data *data)
+static int read_data(
+    fwk_id_t id,
+    fwk_duration_us_t max_age,
+    struct mod_sensor_data *data)
 {
     int status;
     bool sensor_enabled;
@@ -168,6 +428,7 @@ static int get_data(fwk_id_t id, struct mod_sensor_data *data)
     struct fwk_event req;
     struct mod_sensor_event_params *event_params =
         (struct mod_sensor_event_params *)req.params;
+    bool read_in_progress;
 
     status = get_ctx_if_valid_call(id, data, &ctx);
     if (status != FWK_SUCCESS) {
@@ -183,21 +444,36 @@ static int get_data(fwk_id_t id, struct mod_sensor_data *data)
         return FWK_E_SUPPORT;
     }
 
+    if (is_last_read_fresh(ctx, max_age)) {
+        ctx->cache_stats.hits++;
+        sensor_data_copy(data, &ctx->last_read);
+        return FWK_SUCCESS;
+    }
+
     if (ctx->concurrency_readings.dequeuing) {
         /* Prevent new reading request while dequeuing pending readings
          * cached data is returned
          */
+        ctx->cache_stats.shared_reads++;
         sensor_data_copy(data, &ctx->last_read);
         return ctx->last_read.status;
     }
 
-    if (ctx->concurrency_readings.pending_requests == 0) {
+    read_in_progress = (ctx->concurrency_readings.pending_requests != 0) ||
+        ctx->sampling.read_pending;
+
+    if (!read_in_progress) {
+        ctx->cache_stats.driver_reads++;
+
         status = ctx->driver_api->get_value(
             ctx->config->driver_id, &ctx->last_read.value);
         ctx->last_read.status = status;
         if (status == FWK_SUCCESS) {
+            ctx->last_read_time = fwk_time_current();
 #ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
-            trip_point_process(id, &ctx->last_read);
+            if (!is_sensor_sampled(ctx)) {
+                trip_point_process(id, &ctx->last_read);
+            }
 #endif
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
             ctx->last_read.timestamp = sensor_get_timestamp(id);
@@ -229,6 +505,11 @@ static int get_data(fwk_id_t id, struct mod_sensor_data *data)
         return status;
     }
 
+    if (read_in_progress) {
+        /* The request is served by the reading already in progress */
+        ctx->cache_stats.shared_reads++;
+    }
+
     ctx->concurrency_readings.pending_requests++;
     /*
      * We return FWK_PENDING here to indicate to the caller that the
@@ -238,6 +519,74 @@ static int get_data(fwk_id_t id, struct mod_sensor_data *data)
     return FWK_PENDING;
 }
 
+static int get_data(fwk_id_t id, struct mod_sensor_data *data)
+{
+    return read_data(id, 0, data);
+}
+
+static int get_data_max_age(
+    fwk_id_t id,
+    fwk_duration_us_t max_age,
+    struct mod_sensor_data *data)
+{
+    return read_data(id, max_age, data);
+}
+
+static int get_cache_stats(fwk_id_t id, struct mod_sensor_cache_stats *stats)
+{
+    int status;
+    struct sensor_dev_ctx *ctx;
+
+    status = get_ctx_if_valid_call(id, stats, &ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *stats = ctx->cache_stats;
+
+    return FWK_SUCCESS;
+}
+
+static int get_snapshot(fwk_id_t id, struct mod_sensor_data *data)
+{
+    int status;
+    unsigned int retry;
+    uint32_t seq;
+    struct sensor_dev_ctx *ctx;
+    struct mod_sensor_data sample;
+
+    status = get_ctx_if_valid_call(id, data, &ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    if (!is_sensor_sampled(ctx)) {
+        return FWK_E_SUPPORT;
+    }
+
+    /*
+     * The snapshot is read without locking. The copy is only valid when the
+     * sequence number was even and did not change while it was taken.
+     */
+    for (retry = 0; retry < SENSOR_SNAPSHOT_READ_RETRIES; retry++) {
+        seq = ctx->snapshot.seq;
+        if (seq == 0) {
+            return FWK_E_INIT;
+        }
+
+        __sync_synchronize();
+        sample = ctx->snapshot.data;
+        __sync_synchronize();
+
+        if (((seq & 1u) == 0) && (seq == ctx->snapshot.seq)) {
+            sensor_data_copy(data, &sample);
+            return FWK_SUCCESS;
+        }
+    }
+
+    return FWK_E_BUSY;
+}
+
 static int get_info(fwk_id_t id, struct mod_sensor_complete_info *info)
 {
     int status;
@@ -347,6 +696,7 @@ static int sensor_set_update_interval(
     unsigned int time_interval,
     int time_interval_multiplier)
 {
+    int status;
     struct sensor_dev_ctx *ctx;
 
     if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
@@ -359,8 +709,13 @@ static int sensor_set_update_interval(
         return FWK_E_SUPPORT;
     }
 
-    return ctx->driver_api->set_update_interval(
+    status = ctx->driver_api->set_update_interval(
         id, time_interval, time_interval_multiplier);
+    if ((status != FWK_SUCCESS) || !is_sensor_sampled(ctx)) {
+        return status;
+    }
+
+    return sampling_set_interval(ctx);
 }
 
 static int sensor_get_update_interval(
@@ -401,6 +756,9 @@ static struct mod_sensor_api sensor_api = {
     .disable = sensor_disable,
     .set_update_interval = sensor_set_update_interval,
     .get_update_interval = sensor_get_update_interval,
+    .get_data_max_age = get_data_max_age,
+    .get_cache_stats = get_cache_stats,
+    .get_snapshot = get_snapshot,
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
     .set_timestamp_config = sensor_set_timestamp_config,
     .get_timestamp_config = sensor_get_timestamp_config,
@@ -433,6 +791,7 @@ static void reading_complete(fwk_id_t dev_id,
 
     if (response != NULL) {
         ctx->last_read.status = response->status;
+        ctx->last_read_time = fwk_time_current();
 
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
         ctx->last_read.timestamp = sensor_get_timestamp(dev_id);
@@ -451,7 +810,10 @@ static void reading_complete(fwk_id_t dev_id,
 #endif
 
 #ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
-        trip_point_process(dev_id, &ctx->last_read);
+        /* The trip points of sampled sensors are evaluated by the sampler */
+        if (!is_sensor_sampled(ctx)) {
+            trip_point_process(dev_id, &ctx->last_read);
+        }
 #endif
     } else {
         ctx->last_read.status = FWK_E_DEVICE;
@@ -482,6 +844,7 @@ static int sensor_init(
     config = (struct mod_sensor_config *)data;
 
     sensor_mod_ctx.config = config;
+    sensor_mod_ctx.element_count = element_count;
     return FWK_SUCCESS;
 }
 
@@ -537,6 +900,21 @@ static int sensor_bind(fwk_id_t id, unsigned int round)
             return FWK_SUCCESS;
         }
 
+        if (sensor_mod_ctx.config->sampling_tick_ms != 0) {
+#ifdef BUILD_HAS_MOD_TIMER
+            status = fwk_module_bind(
+                sensor_mod_ctx.config->sampling_alarm_id,
+                MOD_TIMER_API_ID_ALARM,
+                &sensor_mod_ctx.sampling.alarm_api);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+#else
+            /* Background sampling needs the timer module */
+            return FWK_E_SUPPORT;
+#endif
+        }
+
 #ifdef BUILD_HAS_NOTIFICATION
         if (fwk_id_is_equal(
                 sensor_mod_ctx.config->notification_id, FWK_ID_NONE)) {
@@ -570,22 +948,32 @@ static int sensor_bind(fwk_id_t id, unsigned int round)
     return FWK_SUCCESS;
 }
 
-#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
-int sensor_start(fwk_id_t id)
+static int sensor_start(fwk_id_t id)
 {
+    struct sensor_dev_ctx *ctx;
+#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     int status;
+#endif
 
     if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
-        return FWK_SUCCESS;
+        return sampling_start();
     }
+#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     status = sensor_axis_start(id);
     if (status != FWK_SUCCESS) {
         return status;
     }
+#endif
 
-    return FWK_SUCCESS;
+    if ((sensor_mod_ctx.config == NULL) ||
+        (sensor_mod_ctx.config->sampling_tick_ms == 0)) {
+        return FWK_SUCCESS;
+    }
+
+    ctx = sensor_get_ctx(id);
+
+    return sampling_set_interval(ctx);
 }
-#endif
 
 static int sensor_process_bind_request(fwk_id_t source_id,
                                        fwk_id_t target_id,
@@ -681,6 +1069,10 @@ static int sensor_process_event(const struct fwk_event *event,
     enum mod_sensor_event_idx event_id_type;
 
     if (!fwk_module_is_valid_element_id(event->target_id)) {
+        if (fwk_id_is_equal(event->id, mod_sensor_event_id_sample)) {
+            return sampling_process();
+        }
+
         return FWK_E_PARAM;
     }
 
@@ -702,6 +1094,17 @@ static int sensor_process_event(const struct fwk_event *event,
         return FWK_SUCCESS;
 
     case SENSOR_EVENT_IDX_READ_COMPLETE:
+        if (ctx->sampling.read_pending) {
+            ctx->sampling.read_pending = false;
+            sampling_publish(event->target_id, ctx);
+
+            if (ctx->concurrency_readings.pending_requests == 0) {
+                /* Nobody is waiting for the reading taken by the sampler */
+                ctx->concurrency_readings.dequeuing = false;
+                return FWK_SUCCESS;
+            }
+        }
+
         status = fwk_get_delayed_response(
             event->target_id, ctx->cookie, &read_req_event);
         if (status != FWK_SUCCESS) {
@@ -737,9 +1140,7 @@ const struct fwk_module module_sensor = {
     .init = sensor_init,
     .element_init = sensor_dev_init,
     .bind = sensor_bind,
-#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     .start = sensor_start,
-#endif
     .process_bind_request = sensor_process_bind_request,
     .process_event = sensor_process_event,
 };
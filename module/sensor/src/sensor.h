@@ -9,8 +9,12 @@
 #define SENSOR_H
 
 #include <mod_sensor.h>
+#ifdef BUILD_HAS_MOD_TIMER
+#    include <mod_timer.h>
+#endif
 
 #include <fwk_id.h>
+#include <fwk_time.h>
 
 #include <stdint.h>
 
@@ -23,6 +27,11 @@
  */
 #define SENSOR_MAX_PENDING_REQUESTS 3
 
+/*
+ * Number of attempts at reading a snapshot while it is being updated.
+ */
+#define SENSOR_SNAPSHOT_READ_RETRIES 3
+
 /*
  * Sensor trip point element context
  */
@@ -55,6 +64,29 @@ struct sensor_dev_ctx {
 
     struct mod_sensor_data last_read;
 
+    /* Time at which last_read was taken from the driver */
+    fwk_timestamp_t last_read_time;
+
+    /* Reading cache statistics */
+    struct mod_sensor_cache_stats cache_stats;
+
+    /* Background sampling, the sensor is not sampled if interval_ms is 0 */
+    struct {
+        uint32_t interval_ms;
+        uint32_t elapsed_ms;
+        bool due;
+        bool read_pending;
+    } sampling;
+
+    /*
+     * Last reading taken by the sampler. The sequence number is odd while the
+     * data is being updated and zero until the first reading is published.
+     */
+    struct {
+        volatile uint32_t seq;
+        struct mod_sensor_data data;
+    } snapshot;
+
     unsigned int axis_count;
 
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
@@ -71,6 +103,21 @@ struct sensor_dev_ctx {
 struct mod_sensor_ctx {
     struct mod_sensor_config *config;
     struct mod_sensor_trip_point_api *sensor_trip_point_api;
+    unsigned int element_count;
+
+    struct {
+#ifdef BUILD_HAS_MOD_TIMER
+        const struct mod_timer_alarm_api *alarm_api;
+#endif
+
+        /* Set by the alarm until the sampling event has been processed */
+        volatile bool tick_pending;
+
+        /* Scratch tables for the sensors read in one batch */
+        fwk_id_t *batch_ids;
+        mod_sensor_value_t *batch_values;
+        unsigned int *batch_idx;
+    } sampling;
 };
 
 struct sensor_dev_ctx *sensor_get_ctx(fwk_id_t id);
@@ -81,6 +128,7 @@ struct sensor_dev_ctx *sensor_get_ctx(fwk_id_t id);
 enum mod_sensor_event_idx {
     SENSOR_EVENT_IDX_READ_REQUEST = MOD_SENSOR_EVENT_IDX_READ_REQUEST,
     SENSOR_EVENT_IDX_READ_COMPLETE,
+    SENSOR_EVENT_IDX_SAMPLE,
     SENSOR_EVENT_IDX_COUNT
 };
 
@@ -91,6 +139,9 @@ static const fwk_id_t mod_sensor_event_id_read_complete =
     FWK_ID_EVENT_INIT(FWK_MODULE_IDX_SENSOR,
                       SENSOR_EVENT_IDX_READ_COMPLETE);
 
+static const fwk_id_t mod_sensor_event_id_sample =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_SENSOR, SENSOR_EVENT_IDX_SAMPLE);
+
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
 
 int sensor_timestamp_dev_init(fwk_id_t id, struct sensor_dev_ctx *ctx);
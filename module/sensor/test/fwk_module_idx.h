@@ -14,6 +14,7 @@ enum fwk_module_idx {
     FWK_MODULE_IDX_SENSOR,
     FWK_MODULE_IDX_REG_SENSOR,
     FWK_MODULE_IDX_FAKE_MODULE,
+    FWK_MODULE_IDX_TIMER,
     FWK_MODULE_IDX_COUNT,
 };
 
@@ -13,6 +13,7 @@
 #include <Mockfwk_mm.h>
 #include <Mockfwk_module.h>
 #include <Mockfwk_string.h>
+#include <Mockfwk_time.h>
 #include <internal/Mockfwk_core_internal.h>
 
 #include <fwk_assert.h>
@@ -47,6 +48,24 @@ static struct sensor_trip_point_ctx
 static unsigned int updated_update_interval = 0;
 static unsigned int updated_update_interval_multiplier = 0;
 
+static fwk_timestamp_t fake_time;
+static unsigned int driver_get_value_count;
+
+static fwk_timestamp_t fake_time_current(int cmock_num_calls)
+{
+    return fake_time;
+}
+
+static int sensor_driver_get_value_counted(
+    fwk_id_t id,
+    mod_sensor_value_t *value)
+{
+    driver_get_value_count++;
+    *value = FAKE_RETURN_VALUE;
+
+    return FWK_SUCCESS;
+}
+
 static int sensor_driver_get_value(fwk_id_t id, mod_sensor_value_t *value)
 {
     return FWK_SUCCESS;
@@ -165,6 +184,10 @@ void setUp(void)
         &sensor_trip_point_context[SENSOR_FAKE_INDEX_0];
     sensor_dev_context[SENSOR_FAKE_INDEX_1].trip_point_ctx =
         &sensor_trip_point_context[SENSOR_FAKE_INDEX_1];
+
+    fake_time = 0;
+    driver_get_value_count = 0;
+    fwk_time_current_Stub(fake_time_current);
 }
 
 void tearDown(void)
@@ -490,8 +513,11 @@ void utest_sensor_process_event_invalid_element_id(void)
     fwk_id_t event_id = FWK_ID_EVENT(FWK_MODULE_IDX_SENSOR, 0);
 
     event.target_id = event_id;
+    event.id = event_id;
 
     fwk_module_is_valid_element_id_ExpectAndReturn(event_id, false);
+    fwk_id_is_equal_ExpectAndReturn(
+        event_id, mod_sensor_event_id_sample, false);
 
     status = sensor_process_event(&event, &response_event);
 
@@ -782,6 +808,568 @@ void utest_sensor_get_data_valid_call_zero_pending_requests(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+static struct mod_sensor_driver_api sensor_driver_api_counted = {
+    .get_value = sensor_driver_get_value_counted,
+    .get_info = sensor_driver_get_info_enabled,
+};
+
+static void setup_cached_reading(fwk_timestamp_t read_time)
+{
+    struct sensor_dev_ctx *ctx = &ctx_table[SENSOR_FAKE_INDEX_0];
+
+    ctx->driver_api = &sensor_driver_api_counted;
+    ctx->last_read.status = FWK_SUCCESS;
+    ctx->last_read.value = FAKE_RETURN_VALUE;
+    ctx->last_read_time = read_time;
+
+    fwk_str_memcpy_StubWithCallback(memcpy_callback);
+}
+
+static void expect_read_data(fwk_id_t elem_id)
+{
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    fwk_id_is_type_ExpectAndReturn(elem_id, FWK_ID_TYPE_ELEMENT, true);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+}
+
+void utest_sensor_get_data_max_age_fresh(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    setup_cached_reading(FWK_US(1000));
+    fake_time = FWK_US(1500);
+
+    expect_read_data(elem_id);
+    status = get_data_max_age(elem_id, 500, &returned_data);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(FAKE_RETURN_VALUE, returned_data.value);
+    TEST_ASSERT_EQUAL(0, driver_get_value_count);
+    TEST_ASSERT_EQUAL(1, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.hits);
+    TEST_ASSERT_EQUAL(
+        0, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.driver_reads);
+}
+
+void utest_sensor_get_data_max_age_stale(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    setup_cached_reading(FWK_US(1000));
+    fake_time = FWK_US(1501);
+
+    expect_read_data(elem_id);
+    status = get_data_max_age(elem_id, 500, &returned_data);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, driver_get_value_count);
+    TEST_ASSERT_EQUAL(0, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.hits);
+    TEST_ASSERT_EQUAL(
+        1, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.driver_reads);
+    TEST_ASSERT_EQUAL(
+        FWK_US(1501), ctx_table[SENSOR_FAKE_INDEX_0].last_read_time);
+
+    /* The new reading is then served to callers accepting its age */
+    expect_read_data(elem_id);
+    status = get_data_max_age(elem_id, 1, &returned_data);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, driver_get_value_count);
+    TEST_ASSERT_EQUAL(1, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.hits);
+}
+
+void utest_sensor_get_data_max_age_zero(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    setup_cached_reading(FWK_US(1000));
+    fake_time = FWK_US(1000);
+
+    expect_read_data(elem_id);
+    status = get_data(elem_id, &returned_data);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, driver_get_value_count);
+    TEST_ASSERT_EQUAL(0, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.hits);
+}
+
+void utest_sensor_get_data_max_age_failed_reading(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    /* A failed reading is never served from the cache */
+    setup_cached_reading(FWK_US(1000));
+    ctx_table[SENSOR_FAKE_INDEX_0].last_read.status = FWK_E_DEVICE;
+    fake_time = FWK_US(1000);
+
+    expect_read_data(elem_id);
+    status = get_data_max_age(elem_id, 500, &returned_data);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, driver_get_value_count);
+}
+
+void utest_sensor_get_data_max_age_no_time_source(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    /* Without a time driver every reading is timestamped zero */
+    setup_cached_reading(0);
+    fake_time = 0;
+
+    expect_read_data(elem_id);
+    status = get_data_max_age(elem_id, 500, &returned_data);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, driver_get_value_count);
+    TEST_ASSERT_EQUAL(0, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.hits);
+}
+
+void utest_sensor_get_data_max_age_shared_reading(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    setup_cached_reading(FWK_US(1000));
+    ctx_table[SENSOR_FAKE_INDEX_0].concurrency_readings.pending_requests = 1;
+    fake_time = FWK_US(2000);
+
+    expect_read_data(elem_id);
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status = get_data_max_age(elem_id, 500, &returned_data);
+
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    TEST_ASSERT_EQUAL(0, driver_get_value_count);
+    TEST_ASSERT_EQUAL(
+        2, ctx_table[SENSOR_FAKE_INDEX_0].concurrency_readings.pending_requests);
+    TEST_ASSERT_EQUAL(
+        1, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.shared_reads);
+    TEST_ASSERT_EQUAL(
+        0, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.driver_reads);
+}
+
+void utest_sensor_get_cache_stats(void)
+{
+    int status;
+    struct mod_sensor_cache_stats stats;
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    status = get_cache_stats(elem_id, NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    ctx_table[SENSOR_FAKE_INDEX_0].cache_stats =
+        (struct mod_sensor_cache_stats){
+            .hits = 3,
+            .shared_reads = 2,
+            .driver_reads = 1,
+        };
+
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    status = get_cache_stats(elem_id, &stats);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(3, stats.hits);
+    TEST_ASSERT_EQUAL(2, stats.shared_reads);
+    TEST_ASSERT_EQUAL(1, stats.driver_reads);
+}
+
+#define SAMPLING_TICK_MS 10
+
+static struct mod_sensor_config sampling_configuration = {
+    .sampling_alarm_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, 0),
+    .sampling_tick_ms = SAMPLING_TICK_MS,
+};
+
+static fwk_id_t sampling_batch_ids[SENSOR_ELEMENT_COUNT];
+static mod_sensor_value_t sampling_batch_values[SENSOR_ELEMENT_COUNT];
+static unsigned int sampling_batch_idx[SENSOR_ELEMENT_COUNT];
+
+static unsigned int driver_batch_calls;
+static unsigned int driver_batch_size;
+static int driver_batch_status;
+
+static unsigned int alarm_start_ms;
+static void (*alarm_start_callback)(uintptr_t param);
+
+static int sensor_driver_get_value_batch(
+    const fwk_id_t *id,
+    mod_sensor_value_t *value,
+    unsigned int count)
+{
+    unsigned int i;
+
+    driver_batch_calls++;
+    driver_batch_size = count;
+
+    for (i = 0; i < count; i++) {
+        value[i] = FAKE_RETURN_VALUE + i;
+    }
+
+    return driver_batch_status;
+}
+
+static int sensor_driver_get_value_pending(
+    fwk_id_t id,
+    mod_sensor_value_t *value)
+{
+    driver_get_value_count++;
+
+    return FWK_PENDING;
+}
+
+static int sensor_driver_get_info_interval(
+    fwk_id_t id,
+    struct mod_sensor_info *info)
+{
+    /* 25ms */
+    info->update_interval = 25;
+    info->update_interval_multiplier = -3;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_alarm_start(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
+{
+    alarm_start_ms = milliseconds;
+    alarm_start_callback = callback;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_timer_alarm_api fake_alarm_api = {
+    .start = fake_alarm_start,
+};
+
+static struct mod_sensor_driver_api sensor_driver_api_batch = {
+    .get_value = sensor_driver_get_value_counted,
+    .get_info = sensor_driver_get_info_enabled,
+    .get_value_batch = sensor_driver_get_value_batch,
+};
+
+static struct mod_sensor_driver_api sensor_driver_api_pending = {
+    .get_value = sensor_driver_get_value_pending,
+    .get_info = sensor_driver_get_info_enabled,
+};
+
+static void setup_sampling(
+    struct mod_sensor_driver_api *driver_api,
+    uint32_t interval_ms)
+{
+    unsigned int i;
+
+    sensor_mod_ctx.config = &sampling_configuration;
+    sensor_mod_ctx.element_count = SENSOR_ELEMENT_COUNT;
+    sensor_mod_ctx.sampling.batch_ids = sampling_batch_ids;
+    sensor_mod_ctx.sampling.batch_values = sampling_batch_values;
+    sensor_mod_ctx.sampling.batch_idx = sampling_batch_idx;
+    sensor_mod_ctx.sampling.tick_pending = false;
+
+    for (i = 0; i < SENSOR_ELEMENT_COUNT; i++) {
+        ctx_table[i].driver_api = driver_api;
+        ctx_table[i].axis_count = 1;
+        ctx_table[i].sampling.interval_ms = interval_ms;
+    }
+
+    driver_batch_calls = 0;
+    driver_batch_status = FWK_SUCCESS;
+
+    fwk_str_memcpy_StubWithCallback(memcpy_callback);
+}
+
+void utest_sensor_sampling_start(void)
+{
+    int status;
+    fwk_id_t module_id = FWK_ID_MODULE(FWK_MODULE_IDX_SENSOR);
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    setup_sampling(&sensor_driver_api_counted, 0);
+    sensor_mod_ctx.sampling.alarm_api = &fake_alarm_api;
+
+    fwk_id_is_type_ExpectAndReturn(module_id, FWK_ID_TYPE_MODULE, true);
+    fwk_mm_calloc_ExpectAndReturn(
+        SENSOR_ELEMENT_COUNT, sizeof(fwk_id_t), sampling_batch_ids);
+    fwk_mm_calloc_ExpectAndReturn(
+        SENSOR_ELEMENT_COUNT,
+        sizeof(mod_sensor_value_t),
+        sampling_batch_values);
+    fwk_mm_calloc_ExpectAndReturn(
+        SENSOR_ELEMENT_COUNT, sizeof(unsigned int), sampling_batch_idx);
+
+    status = sensor_start(module_id);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SAMPLING_TICK_MS, alarm_start_ms);
+    TEST_ASSERT_EQUAL_PTR(sampling_alarm_callback, alarm_start_callback);
+
+    /* The interval of the sensor is rounded up to whole ticks */
+    ctx_table[SENSOR_FAKE_INDEX_0].driver_api->get_info =
+        sensor_driver_get_info_interval;
+
+    fwk_id_is_type_ExpectAndReturn(elem_id, FWK_ID_TYPE_MODULE, false);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+
+    status = sensor_start(elem_id);
+
+    sensor_driver_api_counted.get_info = sensor_driver_get_info_enabled;
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(30, ctx_table[SENSOR_FAKE_INDEX_0].sampling.interval_ms);
+    TEST_ASSERT_EQUAL(20, ctx_table[SENSOR_FAKE_INDEX_0].sampling.elapsed_ms);
+}
+
+void utest_sensor_update_interval_ms(void)
+{
+    struct mod_sensor_info info = { 0 };
+
+    TEST_ASSERT_EQUAL(0, mod_sensor_update_interval_ms(&info));
+
+    info.update_interval = 25;
+    info.update_interval_multiplier = -3;
+    TEST_ASSERT_EQUAL(25, mod_sensor_update_interval_ms(&info));
+
+    info.update_interval_multiplier = 0;
+    TEST_ASSERT_EQUAL(25000, mod_sensor_update_interval_ms(&info));
+
+    /* Sub-millisecond intervals are rounded down */
+    info.update_interval_multiplier = -5;
+    TEST_ASSERT_EQUAL(0, mod_sensor_update_interval_ms(&info));
+
+    info.update_interval_multiplier = 9;
+    TEST_ASSERT_EQUAL(UINT32_MAX, mod_sensor_update_interval_ms(&info));
+}
+
+void utest_sensor_sampling_interval(void)
+{
+    struct sensor_dev_ctx *ctx = &ctx_table[SENSOR_FAKE_INDEX_0];
+
+    setup_sampling(&sensor_driver_api_counted, 3 * SAMPLING_TICK_MS);
+    ctx_table[SENSOR_FAKE_INDEX_1].sampling.interval_ms = 0;
+    fake_time = FWK_US(100);
+
+    sampling_process();
+    sampling_process();
+    TEST_ASSERT_EQUAL(0, driver_get_value_count);
+    TEST_ASSERT_EQUAL(0, ctx->snapshot.seq);
+
+    sampling_process();
+    TEST_ASSERT_EQUAL(1, driver_get_value_count);
+    TEST_ASSERT_EQUAL(2, ctx->snapshot.seq);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, ctx->snapshot.data.status);
+    TEST_ASSERT_EQUAL(FAKE_RETURN_VALUE, ctx->snapshot.data.value);
+    TEST_ASSERT_EQUAL(FWK_US(100), ctx->last_read_time);
+
+    /* Sampling does not account for requests */
+    TEST_ASSERT_EQUAL(0, ctx->cache_stats.driver_reads);
+}
+
+void utest_sensor_sampling_disabled_sensor(void)
+{
+    setup_sampling(&sensor_driver_api_counted, SAMPLING_TICK_MS);
+    sensor_driver_api_counted.get_info = sensor_driver_get_info_disabled;
+
+    sampling_process();
+
+    sensor_driver_api_counted.get_info = sensor_driver_get_info_enabled;
+
+    TEST_ASSERT_EQUAL(0, driver_get_value_count);
+    TEST_ASSERT_EQUAL(0, ctx_table[SENSOR_FAKE_INDEX_0].snapshot.seq);
+}
+
+void utest_sensor_sampling_batch(void)
+{
+    setup_sampling(&sensor_driver_api_batch, SAMPLING_TICK_MS);
+
+    sampling_process();
+
+    TEST_ASSERT_EQUAL(1, driver_batch_calls);
+    TEST_ASSERT_EQUAL(SENSOR_ELEMENT_COUNT, driver_batch_size);
+    TEST_ASSERT_EQUAL(0, driver_get_value_count);
+    TEST_ASSERT_EQUAL(
+        FAKE_RETURN_VALUE,
+        ctx_table[SENSOR_FAKE_INDEX_0].snapshot.data.value);
+    TEST_ASSERT_EQUAL(
+        FAKE_RETURN_VALUE + 1,
+        ctx_table[SENSOR_FAKE_INDEX_1].snapshot.data.value);
+}
+
+void utest_sensor_sampling_batch_error(void)
+{
+    setup_sampling(&sensor_driver_api_batch, SAMPLING_TICK_MS);
+    driver_batch_status = FWK_E_DEVICE;
+
+    sampling_process();
+
+    /* The sensors are read one at a time instead */
+    TEST_ASSERT_EQUAL(1, driver_batch_calls);
+    TEST_ASSERT_EQUAL(SENSOR_ELEMENT_COUNT, driver_get_value_count);
+    TEST_ASSERT_EQUAL(
+        FAKE_RETURN_VALUE,
+        ctx_table[SENSOR_FAKE_INDEX_1].snapshot.data.value);
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, ctx_table[SENSOR_FAKE_INDEX_1].snapshot.data.status);
+}
+
+void utest_sensor_sampling_pending_reading(void)
+{
+    int status;
+    struct fwk_event event;
+    struct fwk_event response_event;
+    struct sensor_dev_ctx *ctx = &ctx_table[SENSOR_FAKE_INDEX_0];
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    setup_sampling(&sensor_driver_api_pending, SAMPLING_TICK_MS);
+    ctx_table[SENSOR_FAKE_INDEX_1].sampling.interval_ms = 0;
+
+    sampling_process();
+
+    TEST_ASSERT_EQUAL(1, driver_get_value_count);
+    TEST_ASSERT_TRUE(ctx->sampling.read_pending);
+    TEST_ASSERT_EQUAL(0, ctx->snapshot.seq);
+
+    /* The sensor is not sampled again while the reading is in progress */
+    sampling_process();
+    TEST_ASSERT_EQUAL(1, driver_get_value_count);
+
+    /* The driver completes the reading, nobody else is waiting for it */
+    ctx->last_read.status = FWK_SUCCESS;
+    ctx->last_read.value = FAKE_RETURN_VALUE;
+    ctx->concurrency_readings.dequeuing = true;
+
+    event = (struct fwk_event){
+        .target_id = elem_id,
+        .id = mod_sensor_event_id_read_complete,
+    };
+
+    fwk_module_is_valid_element_id_ExpectAndReturn(elem_id, true);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    fwk_id_get_event_idx_ExpectAndReturn(
+        event.id, SENSOR_EVENT_IDX_READ_COMPLETE);
+
+    status = sensor_process_event(&event, &response_event);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(ctx->sampling.read_pending);
+    TEST_ASSERT_FALSE(ctx->concurrency_readings.dequeuing);
+    TEST_ASSERT_EQUAL(2, ctx->snapshot.seq);
+    TEST_ASSERT_EQUAL(FAKE_RETURN_VALUE, ctx->snapshot.data.value);
+}
+
+void utest_sensor_sampling_request_joins_pending_reading(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    struct sensor_dev_ctx *ctx = &ctx_table[SENSOR_FAKE_INDEX_0];
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    setup_sampling(&sensor_driver_api_pending, SAMPLING_TICK_MS);
+    ctx->sampling.read_pending = true;
+
+    expect_read_data(elem_id);
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = get_data(elem_id, &returned_data);
+
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    TEST_ASSERT_EQUAL(0, driver_get_value_count);
+    TEST_ASSERT_EQUAL(1, ctx->concurrency_readings.pending_requests);
+    TEST_ASSERT_EQUAL(1, ctx->cache_stats.shared_reads);
+}
+
+void utest_sensor_sampling_event(void)
+{
+    int status;
+    struct fwk_event event;
+    struct fwk_event response_event;
+    fwk_id_t module_id = FWK_ID_MODULE(FWK_MODULE_IDX_SENSOR);
+
+    setup_sampling(&sensor_driver_api_counted, SAMPLING_TICK_MS);
+
+    /* The alarm raises a single event until it has been processed */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    sampling_alarm_callback(0);
+    sampling_alarm_callback(0);
+    TEST_ASSERT_TRUE(sensor_mod_ctx.sampling.tick_pending);
+
+    event = (struct fwk_event){
+        .target_id = module_id,
+        .id = mod_sensor_event_id_sample,
+    };
+
+    fwk_module_is_valid_element_id_ExpectAndReturn(module_id, false);
+    fwk_id_is_equal_ExpectAndReturn(
+        event.id, mod_sensor_event_id_sample, true);
+
+    status = sensor_process_event(&event, &response_event);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(sensor_mod_ctx.sampling.tick_pending);
+    TEST_ASSERT_EQUAL(SENSOR_ELEMENT_COUNT, driver_get_value_count);
+}
+
+void utest_sensor_get_snapshot(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    struct sensor_dev_ctx *ctx = &ctx_table[SENSOR_FAKE_INDEX_0];
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    status = get_snapshot(elem_id, NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    /* The sensor is not sampled */
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    status = get_snapshot(elem_id, &returned_data);
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, status);
+
+    /* The sensor has not been sampled yet */
+    setup_sampling(&sensor_driver_api_counted, SAMPLING_TICK_MS);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    status = get_snapshot(elem_id, &returned_data);
+    TEST_ASSERT_EQUAL(FWK_E_INIT, status);
+
+    /* The snapshot is being updated */
+    ctx->snapshot.seq = 3;
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    status = get_snapshot(elem_id, &returned_data);
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+
+    ctx->snapshot.seq = 4;
+    ctx->snapshot.data.status = FWK_E_DEVICE;
+    ctx->snapshot.data.value = FAKE_RETURN_VALUE;
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    status = get_snapshot(elem_id, &returned_data);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(FWK_E_DEVICE, returned_data.status);
+    TEST_ASSERT_EQUAL(FAKE_RETURN_VALUE, returned_data.value);
+    TEST_ASSERT_EQUAL(0, driver_get_value_count);
+}
+
 void utest_sensor_get_info_get_ctx_if_valid_call_returns_error(void)
 {
     int status;
@@ -1199,6 +1787,23 @@ int sensor_test_main(void)
 
     RUN_TEST(utest_sensor_get_data_not_valid);
     RUN_TEST(utest_sensor_get_data_sensor_disabled);
+    RUN_TEST(utest_sensor_get_data_max_age_fresh);
+    RUN_TEST(utest_sensor_get_data_max_age_stale);
+    RUN_TEST(utest_sensor_get_data_max_age_zero);
+    RUN_TEST(utest_sensor_get_data_max_age_failed_reading);
+    RUN_TEST(utest_sensor_get_data_max_age_no_time_source);
+    RUN_TEST(utest_sensor_get_data_max_age_shared_reading);
+    RUN_TEST(utest_sensor_get_cache_stats);
+    RUN_TEST(utest_sensor_sampling_start);
+    RUN_TEST(utest_sensor_update_interval_ms);
+    RUN_TEST(utest_sensor_sampling_interval);
+    RUN_TEST(utest_sensor_sampling_disabled_sensor);
+    RUN_TEST(utest_sensor_sampling_batch);
+    RUN_TEST(utest_sensor_sampling_batch_error);
+    RUN_TEST(utest_sensor_sampling_pending_reading);
+    RUN_TEST(utest_sensor_sampling_request_joins_pending_reading);
+    RUN_TEST(utest_sensor_sampling_event);
+    RUN_TEST(utest_sensor_get_snapshot);
     RUN_TEST(utest_sensor_get_data_valid_dequeue);
     RUN_TEST(utest_sensor_get_data_valid_call_zero_pending_requests);
 
@@ -12,15 +12,115 @@
 
 #include <stddef.h>
 
+/*
+ * Copy kernels
+ *
+ * The data window may be device memory, so every source word is read exactly
+ * once and in order. The position of the first sample of the monitor is
+ * computed once per copy, and whole source words are unpacked without any
+ * per-sample division.
+ */
+
+/* Number of packed samples held by a 32-bit word */
+#define SAMPLES_PER_WORD(align) (DATA_WIDTH_32_BITS / (align))
+
 static void smcf_memcpy_32bit(
     uint32_t *dest,
     volatile const uint32_t *src,
     size_t count)
 {
-    uint32_t copy_index;
+    for (; count >= 4; count -= 4, dest += 4, src += 4) {
+        dest[0] = src[0];
+        dest[1] = src[1];
+        dest[2] = src[2];
+        dest[3] = src[3];
+    }
 
-    for (copy_index = 0; copy_index < count; copy_index++) {
-        dest[copy_index] = src[copy_index];
+    for (; count > 0; count--) {
+        *dest++ = *src++;
+    }
+}
+
+static void smcf_unpack_word(
+    uint32_t *dest,
+    uint32_t word,
+    uint32_t sample_shift,
+    size_t count,
+    uint32_t align,
+    uint32_t mask)
+{
+    for (; count > 0; count--, sample_shift += align) {
+        *dest++ = (word >> sample_shift) & mask;
+    }
+}
+
+static void smcf_unpack_8bit(
+    uint32_t *dest,
+    volatile const uint32_t *src,
+    size_t first,
+    size_t count,
+    uint32_t mask)
+{
+    const uint32_t per_word = SAMPLES_PER_WORD(PACKED_DATA_ALIGN_8_BITS);
+    size_t lead = first % per_word;
+    uint32_t word;
+
+    src += first / per_word;
+
+    /* Samples sharing their first word with the previous monitor */
+    if (lead != 0) {
+        lead = FWK_MIN(per_word - lead, count);
+        smcf_unpack_word(
+            dest,
+            *src++,
+            (first % per_word) * PACKED_DATA_ALIGN_8_BITS,
+            lead,
+            PACKED_DATA_ALIGN_8_BITS,
+            mask);
+        dest += lead;
+        count -= lead;
+    }
+
+    for (; count >= per_word; count -= per_word, dest += per_word) {
+        word = *src++;
+        dest[0] = word & mask;
+        dest[1] = (word >> 8) & mask;
+        dest[2] = (word >> 16) & mask;
+        dest[3] = (word >> 24) & mask;
+    }
+
+    if (count > 0) {
+        smcf_unpack_word(
+            dest, *src, 0, count, PACKED_DATA_ALIGN_8_BITS, mask);
+    }
+}
+
+static void smcf_unpack_16bit(
+    uint32_t *dest,
+    volatile const uint32_t *src,
+    size_t first,
+    size_t count,
+    uint32_t mask)
+{
+    const uint32_t per_word = SAMPLES_PER_WORD(PACKED_DATA_ALIGN_16_BITS);
+    uint32_t word;
+
+    src += first / per_word;
+
+    /* The first sample is in the upper half of a word */
+    if (((first % per_word) != 0) && (count > 0)) {
+        *dest++ = (*src++ >> PACKED_DATA_ALIGN_16_BITS) & mask;
+        count--;
+    }
+
+    for (; count >= per_word; count -= per_word, dest += per_word) {
+        word = *src++;
+        dest[0] = word & mask;
+        dest[1] = (word >> 16) & mask;
+    }
+
+    if (count > 0) {
+        *dest = *src & mask;
     }
 }
 
@@ -54,21 +154,12 @@ static void smcf_memcpy_packed(
     uint32_t data_width)
 {
     uint32_t mask = DATA_BITS_MASK(data_width);
-    uint32_t sample_shift;
-    uint32_t copy_index;
-    uint32_t word_idx;
-    uint32_t factor;
-    uint32_t align;
-
-    align =
-        ((data_width > DATA_WIDTH_8_BITS) ? PACKED_DATA_ALIGN_16_BITS :
-                                            PACKED_DATA_ALIGN_8_BITS);
-
-    for (copy_index = 0; copy_index < count; copy_index++) {
-        factor = (align * (copy_index + (monitor_index * count)));
-        sample_shift = factor % DATA_WIDTH_32_BITS;
-        word_idx = factor / DATA_WIDTH_32_BITS;
-        dest[copy_index] = (src[word_idx] >> sample_shift) & mask;
+    size_t first = monitor_index * count;
+
+    if (data_width > DATA_WIDTH_8_BITS) {
+        smcf_unpack_16bit(dest, src, first, count, mask);
+    } else {
+        smcf_unpack_8bit(dest, src, first, count, mask);
     }
 }
 
@@ -30,3 +30,20 @@ include(${SCP_ROOT}/unit_test/module_common.cmake)
 
 target_sources(${UNIT_TEST_TARGET}
         PRIVATE ${MODULE_UT_MOCK_SRC}/Mockmgi.c)
+
+if(UNIT_TEST_BENCHMARKS)
+    set(TEST_SRC smcf_data)
+    set(TEST_FILE smcf_data)
+    set(TEST_BENCHMARK TRUE)
+
+    set(UNIT_TEST_TARGET ${TEST_FILE}_benchmark)
+
+    list(APPEND MOCK_REPLACEMENTS fwk_module)
+    list(APPEND MOCK_REPLACEMENTS fwk_id)
+    list(APPEND MOCK_REPLACEMENTS fwk_mm)
+
+    include(${SCP_ROOT}/unit_test/module_common.cmake)
+
+    target_sources(${UNIT_TEST_TARGET}
+            PRIVATE ${MODULE_UT_MOCK_SRC}/Mockmgi.c)
+endif()
@@ -0,0 +1,154 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockmgi.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include UNIT_TEST_SRC
+
+#define BENCHMARK_NUM_DATA   64
+#define BENCHMARK_ITERATIONS 20000
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/*
+ * Reference implementation computing the position of every sample from
+ * scratch, as was done before the copy kernels were specialised.
+ */
+static void reference_memcpy_packed(
+    uint32_t *dest,
+    volatile const uint32_t *src,
+    const unsigned int monitor_index,
+    size_t count,
+    uint32_t data_width)
+{
+    uint32_t mask = DATA_BITS_MASK(data_width);
+    uint32_t align = (data_width > DATA_WIDTH_8_BITS) ?
+        PACKED_DATA_ALIGN_16_BITS :
+        PACKED_DATA_ALIGN_8_BITS;
+    uint32_t factor;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        factor = align * (i + monitor_index * count);
+        dest[i] = (src[factor / 32] >> (factor % 32)) & mask;
+    }
+}
+
+static void reference_copy_data(
+    const struct smcf_data_attr data_attr,
+    const unsigned int monitor_index,
+    uint32_t *dest)
+{
+    uint32_t words;
+    uint32_t i;
+
+    if (data_attr.packed && (data_attr.data_width <= DATA_WIDTH_16_BITS)) {
+        reference_memcpy_packed(
+            dest,
+            data_attr.data_addr,
+            monitor_index,
+            data_attr.num_of_data,
+            data_attr.data_width);
+        return;
+    }
+
+    words = data_attr.num_of_data;
+    if (data_attr.data_width > DATA_WIDTH_32_BITS) {
+        words *= 2;
+    }
+
+    for (i = 0; i < words; i++) {
+        dest[i] = data_attr.data_addr[monitor_index * words + i];
+    }
+}
+
+static void populate_random_hardware_data(uint32_t *data, size_t count)
+{
+    uint32_t seed = 0x2545F491;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        data[i] = seed;
+    }
+}
+
+/* Average cost of copying the samples of one monitor, in nanoseconds */
+static double copy_cost(
+    void (*copy_fn)(
+        const struct smcf_data_attr data_attr,
+        const unsigned int monitor_index,
+        uint32_t *dest),
+    const struct smcf_data_attr data_attr)
+{
+    static uint32_t buffer[BENCHMARK_NUM_DATA];
+    unsigned int iteration;
+    clock_t start;
+
+    start = clock();
+    for (iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        copy_fn(data_attr, iteration % 2, buffer);
+    }
+
+    return ((double)(clock() - start) * 1e9) /
+        ((double)CLOCKS_PER_SEC * BENCHMARK_ITERATIONS);
+}
+
+/*
+ * Compare the copy kernels with computing the position of every sample, for
+ * the packed sample widths.
+ */
+void benchmark_smcf_copy_data(void)
+{
+    static uint32_t hardware[BENCHMARK_NUM_DATA];
+    struct smcf_data_attr data_attr = {
+        .data_addr = hardware,
+        .num_of_data = BENCHMARK_NUM_DATA,
+        .packed = true,
+    };
+    uint32_t width;
+
+    populate_random_hardware_data(hardware, FWK_ARRAY_SIZE(hardware));
+
+    for (width = 8; width <= DATA_WIDTH_16_BITS; width += 8) {
+        data_attr.data_width = width;
+        printf(
+            "smcf copy, %d %d-bit packed samples: "
+            "reference %.0f ns, kernel %.0f ns\n",
+            BENCHMARK_NUM_DATA,
+            (int)width,
+            copy_cost(reference_copy_data, data_attr),
+            copy_cost(smcf_copy_data, data_attr));
+    }
+}
+
+int smcf_data_benchmark_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(benchmark_smcf_copy_data);
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return smcf_data_benchmark_main();
+}
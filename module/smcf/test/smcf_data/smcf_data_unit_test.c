@@ -10,6 +10,7 @@
 #include "unity.h"
 
 #include <Mockmgi.h>
+#include <string.h>
 #include <strings.h>
 
 #include UNIT_TEST_SRC
@@ -21,6 +22,9 @@
 #define DATA_PATTERN_16_BITS 0x1600
 #define DATA_PATTERN_8_BITS  0x80
 
+#define REFERENCE_MAX_MLI  8
+#define REFERENCE_MAX_DATA 19
+
 void setUp(void)
 {
 }
@@ -1524,6 +1528,118 @@ void utest_smcf_data_get_tag_length_correct_value(void)
     TEST_ASSERT_EQUAL(tag_length, 4);
 }
 
+/*
+ * Reference implementation computing the position of every sample from
+ * scratch, as was done before the copy kernels were specialised.
+ */
+static void reference_memcpy_packed(
+    uint32_t *dest,
+    volatile const uint32_t *src,
+    const unsigned int monitor_index,
+    size_t count,
+    uint32_t data_width)
+{
+    uint32_t mask = DATA_BITS_MASK(data_width);
+    uint32_t align = (data_width > DATA_WIDTH_8_BITS) ?
+        PACKED_DATA_ALIGN_16_BITS :
+        PACKED_DATA_ALIGN_8_BITS;
+    uint32_t factor;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        factor = align * (i + monitor_index * count);
+        dest[i] = (src[factor / 32] >> (factor % 32)) & mask;
+    }
+}
+
+static void reference_copy_data(
+    const struct smcf_data_attr data_attr,
+    const unsigned int monitor_index,
+    uint32_t *dest)
+{
+    uint32_t words;
+    uint32_t i;
+
+    if (data_attr.packed && (data_attr.data_width <= DATA_WIDTH_16_BITS)) {
+        reference_memcpy_packed(
+            dest,
+            data_attr.data_addr,
+            monitor_index,
+            data_attr.num_of_data,
+            data_attr.data_width);
+        return;
+    }
+
+    words = data_attr.num_of_data;
+    if (data_attr.data_width > DATA_WIDTH_32_BITS) {
+        words *= 2;
+    }
+
+    for (i = 0; i < words; i++) {
+        dest[i] = data_attr.data_addr[monitor_index * words + i];
+    }
+}
+
+static void populate_random_hardware_data(uint32_t *data, size_t count)
+{
+    uint32_t seed = 0x2545F491;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        data[i] = seed;
+    }
+}
+
+static void check_copy_data_matches_reference(uint32_t width, bool packed)
+{
+    static uint32_t hardware[2 * REFERENCE_MAX_MLI * REFERENCE_MAX_DATA];
+    uint32_t expected[2 * REFERENCE_MAX_DATA];
+    uint32_t actual[2 * REFERENCE_MAX_DATA];
+    struct smcf_data_attr data_attr = {
+        .data_addr = hardware,
+        .data_width = width,
+        .packed = packed,
+    };
+    unsigned int num_of_data, mli_idx;
+
+    populate_random_hardware_data(hardware, FWK_ARRAY_SIZE(hardware));
+
+    for (num_of_data = 1; num_of_data <= REFERENCE_MAX_DATA; num_of_data++) {
+        data_attr.num_of_data = num_of_data;
+
+        for (mli_idx = 0; mli_idx < REFERENCE_MAX_MLI; mli_idx++) {
+            memset(expected, 0xA5, sizeof(expected));
+            memset(actual, 0xA5, sizeof(actual));
+
+            reference_copy_data(data_attr, mli_idx, expected);
+            smcf_copy_data(data_attr, mli_idx, actual);
+
+            TEST_ASSERT_EQUAL_HEX32_ARRAY(
+                expected, actual, FWK_ARRAY_SIZE(expected));
+        }
+    }
+}
+
+void utest_smcf_copy_data_packed_matches_reference(void)
+{
+    uint32_t width;
+
+    for (width = 1; width <= DATA_WIDTH_16_BITS; width++) {
+        check_copy_data_matches_reference(width, true);
+    }
+}
+
+void utest_smcf_copy_data_unpacked_matches_reference(void)
+{
+    check_copy_data_matches_reference(16, false);
+    check_copy_data_matches_reference(32, false);
+    check_copy_data_matches_reference(48, false);
+    check_copy_data_matches_reference(64, false);
+}
+
 int smcf_data_test_main(void)
 {
     UNITY_BEGIN();
@@ -1547,6 +1663,8 @@ int smcf_data_test_main(void)
     RUN_TEST(utest_smcf_data_sample_width_1_to_8_packed_num_data_4);
     RUN_TEST(utest_smcf_data_sample_width_1_to_8_packed_num_data_3);
     RUN_TEST(utest_smcf_data_sample_width_1_to_8_packed_num_data_5);
+    RUN_TEST(utest_smcf_copy_data_packed_matches_reference);
+    RUN_TEST(utest_smcf_copy_data_unpacked_matches_reference);
     RUN_TEST(utest_smcf_data_copy_tag);
     RUN_TEST(utest_smcf_sample_header_get_group_id_not_supported);
     RUN_TEST(utest_smcf_sample_header_get_group_id);
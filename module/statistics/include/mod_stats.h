@@ -19,9 +19,22 @@
  * \ingroup GroupModules
  * \defgroup GroupStatistics Statistics for Performance and Power domains
  *      of operating level changes
+ *
+ * \details Besides the SCMI performance and power domain statistics, any
+ *      module can publish level residencies, counters and histograms in the
+ *      statistics region. The region starts with a
+ *      ::mod_stats_region_header, followed by sections that each start with
+ *      a ::mod_stats_section_header, so that a host can decode the region
+ *      without knowing the firmware configuration.
  * \{
  */
 
+/*! Signature of the statistics region - 'STAT' = 0x53544154 */
+#define MOD_STATS_REGION_SIGNATURE UINT32_C(0x53544154)
+
+/*! Revision of the layout of the statistics region */
+#define MOD_STATS_REGION_REVISION UINT16_C(1)
+
 /*!
  * \defgroup GroupStatisticsTypes Types
  * \{
@@ -42,6 +55,10 @@ struct FWK_PACKED mod_stats_config_info {
 
     /*! Alarm used for period updates */
     fwk_id_t alarm_id;
+
+    /*! Maximum number of counter and histogram sections that the modules
+     * can add. */
+    unsigned int max_entries;
 };
 
 /*!
@@ -135,7 +152,8 @@ struct mod_stats_info {
  *      specification
  */
 struct mod_stats_desc_header {
-    /*! Signature - 0x50455246 (‘PERF’) or 0x504F5752 ('POWR'). */
+    /*! Signature - 0x50455246 (‘PERF’) or 0x504F5752 ('POWR'), or
+     * 0x4C45564C ('LEVL') for the other modules. */
     uint32_t signature;
 
     /*! The revision value aligned with the SCMI specification. */
@@ -149,7 +167,16 @@ struct mod_stats_desc_header {
     uint16_t domain_count;
 
     /*! Empty space just for memory alignment as per SCMI specification. */
-    uint16_t reserved[3];
+    uint16_t reserved;
+
+    /*! Sequence count of the updates to the residency sections of the
+     * domains listed in \ref domain_offset, as defined by the SCMI
+     * specification. It is odd while the SCP is writing the statistics, and
+     * the statistics read by the agent are only consistent if the sequence
+     * was even and unchanged before and after reading them. It does not
+     * cover the counter and histogram sections, see
+     * mod_stats_region_header::sequence. */
+    volatile uint32_t sequence;
 
     /*! For each domain this array provides 4B offset from start addr of the
      * statistics memory region to the particular performance or power domain
@@ -201,6 +228,96 @@ struct FWK_PACKED mod_stats_domain_stats_data {
     struct mod_stats_level_stats level[];
 };
 
+/*!
+ * \brief Header at the start of the statistics region.
+ */
+struct mod_stats_region_header {
+    /*! Signature - ::MOD_STATS_REGION_SIGNATURE. */
+    uint32_t signature;
+
+    /*! Revision - ::MOD_STATS_REGION_REVISION. */
+    uint16_t revision;
+
+    /*! Number of sections following the header. */
+    uint16_t section_count;
+
+    /*! Size in bytes of the used part of the region, header included. */
+    uint32_t size;
+
+    /*! Sequence count of the updates to all the counter and histogram
+     * sections of the region. It follows the same protocol as
+     * mod_stats_desc_header::sequence, but does not cover the residency
+     * sections: those are only protected by the sequence of the descriptor
+     * header that lists their domain. */
+    volatile uint32_t sequence;
+};
+
+/*!
+ * \brief Types of the sections of the statistics region.
+ */
+enum mod_stats_section_type {
+    /*! A ::mod_stats_desc_header. */
+    MOD_STATS_SECTION_TYPE_DESC,
+
+    /*! A ::mod_stats_domain_stats_data with the level residencies of the
+     * domain given by the section identifier. */
+    MOD_STATS_SECTION_TYPE_RESIDENCY,
+
+    /*! An array of 64-bit counters. */
+    MOD_STATS_SECTION_TYPE_COUNTERS,
+
+    /*! A ::mod_stats_histogram. */
+    MOD_STATS_SECTION_TYPE_HISTOGRAM,
+
+    /*! Number of section types. */
+    MOD_STATS_SECTION_TYPE_COUNT
+};
+
+/*!
+ * \brief Header of a section of the statistics region.
+ *
+ * \details The section data follows the header. Sections are 8-byte aligned
+ *      and sized, so the next section starts \ref size bytes after this one.
+ */
+struct mod_stats_section_header {
+    /*! Type of the section, see ::mod_stats_section_type. */
+    uint16_t type;
+
+    /*! Index of the module that owns the section. */
+    uint16_t module_idx;
+
+    /*! Size in bytes of the section, header included. */
+    uint32_t size;
+
+    /*! Index of the domain for residency sections, or tag given by the
+     * module for counter and histogram sections. */
+    uint32_t id;
+
+    /*! Number of levels, counters or histogram buckets in the section. */
+    uint32_t count;
+};
+
+/*!
+ * \brief Histogram of values recorded by a module.
+ *
+ * \details Bucket 0 counts the values equal to 0, and bucket N counts the
+ *      values in the range [2^(N-1), 2^N). The last bucket also counts all
+ *      the values above its range.
+ */
+struct FWK_PACKED mod_stats_histogram {
+    /*! Number of recorded values. */
+    uint64_t count;
+
+    /*! Sum of the recorded values. */
+    uint64_t total;
+
+    /*! Largest recorded value. */
+    uint64_t max;
+
+    /*! Number of recorded values in each bucket. */
+    uint64_t buckets[];
+};
+
 /*!
  * \}
  */
@@ -258,6 +375,79 @@ struct mod_stats_api {
         fwk_id_t domain_id,
         uint32_t level_id);
 
+    /*!
+     * \brief Add a section of counters for the given module.
+     *
+     * \details The counters are published under the statistics region
+     *      sequence count, and start at 0.
+     *
+     * \param module_id Identifier of the module owning the counters.
+     * \param tag Tag identifying the section within the module.
+     * \param count Number of counters in the section.
+     * \param [out] entry_id Identifier to update the counters with.
+     *
+     * \retval ::FWK_SUCCESS The section was added.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_SUPPORT Statistics are not configured.
+     * \retval ::FWK_E_NOMEM The statistics region is too small, or
+     *      mod_stats_config_info::max_entries sections were already added.
+     */
+    int (*add_counters)(
+        fwk_id_t module_id,
+        uint32_t tag,
+        unsigned int count,
+        unsigned int *entry_id);
+
+    /*!
+     * \brief Add a histogram section for the given module.
+     *
+     * \param module_id Identifier of the module owning the histogram.
+     * \param tag Tag identifying the section within the module.
+     * \param bucket_count Number of buckets of the histogram.
+     * \param [out] entry_id Identifier to record values with.
+     *
+     * \retval ::FWK_SUCCESS The section was added.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_SUPPORT Statistics are not configured.
+     * \retval ::FWK_E_NOMEM The statistics region is too small, or
+     *      mod_stats_config_info::max_entries sections were already added.
+     */
+    int (*add_histogram)(
+        fwk_id_t module_id,
+        uint32_t tag,
+        unsigned int bucket_count,
+        unsigned int *entry_id);
+
+    /*!
+     * \brief Add a value to a counter.
+     *
+     * \note Statistics are only written from the event context.
+     *
+     * \param entry_id Identifier of the counter section.
+     * \param index Index of the counter in the section.
+     * \param value Value to add.
+     *
+     * \retval ::FWK_SUCCESS The counter was updated.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*counter_add)(
+        unsigned int entry_id,
+        unsigned int index,
+        uint64_t value);
+
+    /*!
+     * \brief Record a value in a histogram.
+     *
+     * \note Statistics are only written from the event context.
+     *
+     * \param entry_id Identifier of the histogram section.
+     * \param value Value to record, in a unit chosen by the module.
+     *
+     * \retval ::FWK_SUCCESS The value was recorded.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*histogram_record)(unsigned int entry_id, uint64_t value);
+
     /*!
      * \brief Get low and high addresses of statistics in AP address space
      *          with length of the memory region
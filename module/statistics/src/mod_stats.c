@@ -9,8 +9,10 @@
 #include <mod_timer.h>
 
 #include <fwk_assert.h>
-#include <fwk_interrupt.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
 #include <fwk_log.h>
+#include <fwk_math.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
@@ -18,13 +20,43 @@
 #include <fwk_string.h>
 #include <fwk_time.h>
 
+#include <inttypes.h>
+#include <stdbool.h>
+
 /* 'PERF' = 0x50455246 in SCP little-endian */
 #define STATS_SIGN_PERF 0x50455246
 /* 'POWR' = 0x504F5752 in SCP little-endian */
 #define STATS_SIGN_POWR 0x504F5752
+/* 'LEVL' = 0x4C45564C in SCP little-endian */
+#define STATS_SIGN_LEVL 0x4C45564C
 
 #define STATS_UPDATE_PERIOD_MS  100
 
+enum stats_event_idx {
+    /* Periodic update of the residency of the current levels */
+    STATS_EVENT_IDX_UPDATE,
+
+    STATS_EVENT_IDX_COUNT
+};
+
+static const fwk_id_t stats_event_id_update =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_STATISTICS, STATS_EVENT_IDX_UPDATE);
+
+/* Counter or histogram section registered by a module */
+struct stats_entry {
+    /* Type of the section */
+    enum mod_stats_section_type type;
+
+    /* Number of counters or histogram buckets */
+    unsigned int count;
+
+    /* Section data in the shared region */
+    union {
+        uint64_t *counters;
+        struct mod_stats_histogram *histogram;
+    };
+};
+
 struct mod_stats_ctx {
     /* Platform specific memory configuration data */
     const struct mod_stats_config_info *config;
@@ -32,64 +64,113 @@ struct mod_stats_ctx {
     /* Offset of the available memory in the statistics region */
     uint32_t avail_mem_offset;
 
-    /* Context of performance statistics */
-    struct mod_stats_info *perf_stats;
+    /* Header at the start of the statistics region */
+    struct mod_stats_region_header *region;
+
+    /* Level statistics of each module, indexed by module index */
+    struct mod_stats_info *module_stats[FWK_MODULE_IDX_COUNT];
+
+    /* Counter and histogram sections, indexed by entry identifier, sized
+     * for mod_stats_config_info::max_entries at initialization */
+    struct stats_entry *entries;
 
-    /* Context of power domain statistics */
-    struct mod_stats_info *power_stats;
+    /* Number of counter and histogram sections */
+    unsigned int entry_count;
 
     /* Alarm API for periodic shared memory updates */
     const struct mod_timer_alarm_api *alarm_api;
+
+    /* A periodic update has been requested but not yet processed */
+    volatile bool update_pending;
 };
 
 static struct mod_stats_ctx stats_ctx;
 
 static struct mod_stats_info *get_module_stats_info(fwk_id_t module_id)
 {
-    if (fwk_id_get_module_idx(module_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_perf)) {
-        return stats_ctx.perf_stats;
-    }
+    unsigned int module_idx = fwk_id_get_module_idx(module_id);
 
-    if (fwk_id_get_module_idx(module_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_power_domain)) {
-        return stats_ctx.power_stats;
+    if (module_idx >= FWK_MODULE_IDX_COUNT) {
+        return NULL;
     }
 
-    return NULL;
+    return stats_ctx.module_stats[module_idx];
 }
 
 static int set_module_stats_info(fwk_id_t module_id,
     struct mod_stats_info *stats)
 {
-    int ret = FWK_E_PARAM;
+    unsigned int module_idx = fwk_id_get_module_idx(module_id);
 
-    if (fwk_id_get_module_idx(module_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_perf)) {
-        stats_ctx.perf_stats = stats;
-        stats->type_signature = STATS_SIGN_PERF;
-        ret = FWK_SUCCESS;
+    if (module_idx >= FWK_MODULE_IDX_COUNT) {
+        return FWK_E_PARAM;
     }
 
-    if (fwk_id_get_module_idx(module_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_power_domain)) {
-        stats_ctx.power_stats = stats;
+    if (module_idx == fwk_id_get_module_idx(fwk_module_id_scmi_perf)) {
+        stats->type_signature = STATS_SIGN_PERF;
+    } else if (
+        module_idx == fwk_id_get_module_idx(fwk_module_id_scmi_power_domain)) {
         stats->type_signature = STATS_SIGN_POWR;
-        ret = FWK_SUCCESS;
+    } else {
+        stats->type_signature = STATS_SIGN_LEVL;
     }
 
-    return ret;
+    stats_ctx.module_stats[module_idx] = stats;
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Allocate a section at the end of the used part of the statistics region
+ * and return a pointer to its data, or NULL if the region is too small.
+ */
+static void *allocate_section(
+    fwk_id_t module_id,
+    enum mod_stats_section_type type,
+    uint32_t id,
+    uint32_t count,
+    size_t data_size)
+{
+    struct mod_stats_section_header *section;
+    size_t section_size;
+
+    section_size = FWK_ALIGN_NEXT(
+        sizeof(struct mod_stats_section_header) + data_size,
+        sizeof(uint64_t));
+
+    if (section_size > (stats_ctx.config->stats_region_size -
+        stats_ctx.avail_mem_offset)) {
+        FWK_LOG_ERR("[STATS]: Error, size of statistics region too small");
+        return NULL;
+    }
+
+    section = (struct mod_stats_section_header *)
+              (stats_ctx.config->scp_stats_addr +
+               stats_ctx.avail_mem_offset);
+
+    section->type = (uint16_t)type;
+    section->module_idx = (uint16_t)fwk_id_get_module_idx(module_id);
+    section->size = (uint32_t)section_size;
+    section->id = id;
+    section->count = count;
+
+    /* Shrink the free space in the shared region */
+    stats_ctx.avail_mem_offset += section_size;
+
+    stats_ctx.region->section_count++;
+    stats_ctx.region->size = stats_ctx.avail_mem_offset;
+
+    return section + 1;
 }
 
 static int allocate_domain_stats(fwk_id_t module_id,
     fwk_id_t domain_id,
     int level_count)
 {
+    struct mod_stats_domain_stats_data *domain_stats;
     struct mod_stats_desc_header *desc_header;
     struct mod_stats_info *stats;
     struct mod_stats_map *se_map;
-    uintptr_t scp_stats_addr;
-    uint32_t stats_offset;
     uint32_t stats_size;
     int stats_id;
     uint32_t idx;
@@ -114,59 +195,60 @@ static int allocate_domain_stats(fwk_id_t module_id,
     stats_size = sizeof(struct mod_stats_level_stats) * level_count;
     stats_size += sizeof(struct mod_stats_domain_stats_data);
 
-    if (stats_size > (stats_ctx.config->stats_region_size -
-        stats_ctx.avail_mem_offset)) {
-        FWK_LOG_ERR("[STATS]: Error, size of statistics region too small");
+    domain_stats = allocate_section(
+        module_id,
+        MOD_STATS_SECTION_TYPE_RESIDENCY,
+        idx,
+        (uint32_t)level_count,
+        stats_size);
+    if (domain_stats == NULL) {
         stats->mode = STATS_INTERNAL_ERROR;
         return FWK_E_NOMEM;
     }
 
     se_map = stats->context->se_stats_map;
-    se_map->se_level_count[idx] = level_count;
-    se_map->se_curr_level[idx] = 0;
+    se_map->se_level_count[stats_id] = level_count;
+    se_map->se_curr_level[stats_id] = 0;
+    se_map->se_stats[stats_id] = domain_stats;
 
     /* Offset from the beginning of statistics header used by AP */
-    stats_offset = stats_ctx.avail_mem_offset - stats->desc_header_offset;
-    desc_header->domain_offset[idx] = stats_offset;
+    desc_header->domain_offset[idx] =
+        (uint32_t)((uintptr_t)domain_stats - (uintptr_t)desc_header);
 
-    /* Address used in SCP to get domain statistics in the shared region */
-    scp_stats_addr = stats_ctx.config->scp_stats_addr +
-                     stats_ctx.avail_mem_offset;
-    se_map->se_stats[idx] = (struct mod_stats_domain_stats_data *)
-                            scp_stats_addr;
-
-    /* Shrink the free space in the shared region */
-    stats_ctx.avail_mem_offset += stats_size;
-
-    stats->used_mem_size += stats_size;
+    /* The statistics of the module span up to the end of this section */
+    stats->used_mem_size =
+        stats_ctx.avail_mem_offset - stats->desc_header_offset;
 
     FWK_LOG_DEBUG(
-        "[STATS]: stats addr %lx, stats_size=%luB",
-        (uint32_t)scp_stats_addr,
+        "[STATS]: stats addr %" PRIxPTR ", stats_size=%" PRIu32 "B",
+        (uintptr_t)domain_stats,
         stats_size);
 
     return FWK_SUCCESS;
 }
 
-static int _allocate_header(struct mod_stats_info *stats, int domain_count)
+static int _allocate_header(
+    fwk_id_t module_id,
+    struct mod_stats_info *stats,
+    int domain_count)
 {
     stats->desc_header_size = sizeof(struct mod_stats_desc_header);
     stats->desc_header_size += domain_count * sizeof(uint32_t);
 
-    if (stats->desc_header_size > (stats_ctx.config->stats_region_size -
-        stats_ctx.avail_mem_offset)) {
-        FWK_LOG_ERR("[STATS]: Error, size of statistics region too small");
+    stats->desc_header = allocate_section(
+        module_id,
+        MOD_STATS_SECTION_TYPE_DESC,
+        stats->type_signature,
+        (uint32_t)domain_count,
+        stats->desc_header_size);
+    if (stats->desc_header == NULL) {
         stats->mode = STATS_INTERNAL_ERROR;
         return FWK_E_NOMEM;
     }
 
-    stats->desc_header_offset = stats_ctx.avail_mem_offset;
-    stats->desc_header = (struct mod_stats_desc_header *)
-                         (stats_ctx.config->scp_stats_addr +
-                          stats_ctx.avail_mem_offset);
-
-    stats->used_mem_size += stats->desc_header_size;
-    stats_ctx.avail_mem_offset += stats->desc_header_size;
+    stats->desc_header_offset =
+        (uintptr_t)stats->desc_header - stats_ctx.config->scp_stats_addr;
+    stats->used_mem_size = stats->desc_header_size;
 
     return FWK_SUCCESS;
 }
@@ -221,6 +303,15 @@ static int stats_init_module(fwk_id_t module_id,
     struct mod_stats_info *stats;
     int ret;
 
+    if (stats_ctx.config == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    if ((fwk_id_get_module_idx(module_id) >= FWK_MODULE_IDX_COUNT) ||
+        (get_module_stats_info(module_id) != NULL)) {
+        return FWK_E_PARAM;
+    }
+
     FWK_LOG_INFO(
         "[STATS]: init module, total_domains=%d used=%d",
         domain_count,
@@ -231,7 +322,7 @@ static int stats_init_module(fwk_id_t module_id,
 
     fwk_assert(ret == FWK_SUCCESS);
 
-    ret = _allocate_header(stats, domain_count);
+    ret = _allocate_header(module_id, stats, domain_count);
     if (ret != FWK_SUCCESS) {
         return ret;
     }
@@ -340,6 +431,25 @@ static uint64_t _get_curret_ts_us(void)
     return ts_us;
 }
 
+/*
+ * The statistics are only written from the event context, so writers never
+ * race with each other. The agent reading the region retries whenever the
+ * sequence is odd or has changed while it was reading. Residency sections are
+ * written under the sequence of their descriptor header, as SCMI requires, and
+ * counter and histogram sections under the sequence of the region header.
+ */
+static void stats_write_begin(volatile uint32_t *sequence)
+{
+    (*sequence)++;
+    __sync_synchronize();
+}
+
+static void stats_write_end(volatile uint32_t *sequence)
+{
+    __sync_synchronize();
+    (*sequence)++;
+}
+
 static int
 stats_update_domain(fwk_id_t module_id, fwk_id_t domain_id, uint32_t level_id)
 {
@@ -350,7 +460,6 @@ stats_update_domain(fwk_id_t module_id, fwk_id_t domain_id, uint32_t level_id)
     uint64_t ts_now_us;
     uint32_t old_level_id, idx;
     int stats_id;
-    unsigned int flags;
 
     stats = get_module_stats_info(module_id);
     if (stats == NULL) {
@@ -377,7 +486,7 @@ stats_update_domain(fwk_id_t module_id, fwk_id_t domain_id, uint32_t level_id)
 
     ts_now_us = _get_curret_ts_us();
 
-    flags = fwk_interrupt_global_disable();
+    stats_write_begin(&stats->desc_header->sequence);
 
     /* Update old performance level statistics */
     old_level_id = se_map->se_curr_level[stats_id];
@@ -392,7 +501,7 @@ stats_update_domain(fwk_id_t module_id, fwk_id_t domain_id, uint32_t level_id)
     domain_stats->curr_level_id = (uint16_t)level_id;
     se_map->se_curr_level[stats_id] = level_id;
 
-    fwk_interrupt_global_enable(flags);
+    stats_write_end(&stats->desc_header->sequence);
 
     return FWK_SUCCESS;
 }
@@ -425,74 +534,224 @@ get_statistics_desc(fwk_id_t module_id,
     return FWK_SUCCESS;
 }
 
+static int add_entry(
+    fwk_id_t module_id,
+    enum mod_stats_section_type type,
+    uint32_t tag,
+    unsigned int count,
+    size_t data_size,
+    unsigned int *entry_id)
+{
+    struct stats_entry *entry;
+    void *data;
+
+    if ((count == 0) || (entry_id == NULL) ||
+        (fwk_id_get_module_idx(module_id) >= FWK_MODULE_IDX_COUNT)) {
+        return FWK_E_PARAM;
+    }
+
+    if (stats_ctx.config == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    if (stats_ctx.entry_count >= stats_ctx.config->max_entries) {
+        FWK_LOG_ERR("[STATS]: Error, no statistics entry left");
+        return FWK_E_NOMEM;
+    }
+
+    data = allocate_section(module_id, type, tag, count, data_size);
+    if (data == NULL) {
+        return FWK_E_NOMEM;
+    }
+
+    entry = &stats_ctx.entries[stats_ctx.entry_count];
+    entry->type = type;
+    entry->count = count;
+    entry->counters = data;
+
+    *entry_id = stats_ctx.entry_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int stats_add_counters(
+    fwk_id_t module_id,
+    uint32_t tag,
+    unsigned int count,
+    unsigned int *entry_id)
+{
+    if ((stats_ctx.config != NULL) &&
+        (count > (stats_ctx.config->stats_region_size / sizeof(uint64_t)))) {
+        return FWK_E_NOMEM;
+    }
+
+    return add_entry(
+        module_id,
+        MOD_STATS_SECTION_TYPE_COUNTERS,
+        tag,
+        count,
+        count * sizeof(uint64_t),
+        entry_id);
+}
+
+static int stats_add_histogram(
+    fwk_id_t module_id,
+    uint32_t tag,
+    unsigned int bucket_count,
+    unsigned int *entry_id)
+{
+    if ((stats_ctx.config != NULL) &&
+        (bucket_count >
+         (stats_ctx.config->stats_region_size / sizeof(uint64_t)))) {
+        return FWK_E_NOMEM;
+    }
+
+    return add_entry(
+        module_id,
+        MOD_STATS_SECTION_TYPE_HISTOGRAM,
+        tag,
+        bucket_count,
+        sizeof(struct mod_stats_histogram) + (bucket_count * sizeof(uint64_t)),
+        entry_id);
+}
+
+static struct stats_entry *get_entry(
+    unsigned int entry_id,
+    enum mod_stats_section_type type)
+{
+    if ((entry_id >= stats_ctx.entry_count) ||
+        (stats_ctx.entries[entry_id].type != type)) {
+        return NULL;
+    }
+
+    return &stats_ctx.entries[entry_id];
+}
+
+static int stats_counter_add(
+    unsigned int entry_id,
+    unsigned int index,
+    uint64_t value)
+{
+    struct stats_entry *entry;
+
+    entry = get_entry(entry_id, MOD_STATS_SECTION_TYPE_COUNTERS);
+    if ((entry == NULL) || (index >= entry->count)) {
+        return FWK_E_PARAM;
+    }
+
+    stats_write_begin(&stats_ctx.region->sequence);
+
+    entry->counters[index] += value;
+
+    stats_write_end(&stats_ctx.region->sequence);
+
+    return FWK_SUCCESS;
+}
+
+static int stats_histogram_record(unsigned int entry_id, uint64_t value)
+{
+    struct mod_stats_histogram *histogram;
+    struct stats_entry *entry;
+    unsigned int bucket = 0;
+
+    entry = get_entry(entry_id, MOD_STATS_SECTION_TYPE_HISTOGRAM);
+    if (entry == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (value != 0) {
+        bucket = (unsigned int)fwk_math_log2(value) + 1u;
+        if (bucket >= entry->count) {
+            bucket = entry->count - 1u;
+        }
+    }
+
+    histogram = entry->histogram;
+
+    stats_write_begin(&stats_ctx.region->sequence);
+
+    histogram->count++;
+    histogram->total += value;
+    if (value > histogram->max) {
+        histogram->max = value;
+    }
+    histogram->buckets[bucket]++;
+
+    stats_write_end(&stats_ctx.region->sequence);
+
+    return FWK_SUCCESS;
+}
+
 static const struct mod_stats_api mod_statistics_api = {
     .init_stats = stats_init_module,
     .start_stats = stats_start_module,
     .add_domain = stats_add_domain,
     .update_domain = stats_update_domain,
+    .add_counters = stats_add_counters,
+    .add_histogram = stats_add_histogram,
+    .counter_add = stats_counter_add,
+    .histogram_record = stats_histogram_record,
     .get_statistics_desc = get_statistics_desc,
 };
 
-static void update_all_domains_current_level(fwk_id_t module_id)
+static void update_all_domains_current_level(struct mod_stats_info *stats)
 {
-    struct mod_stats_domain_stats_data *domain_stats;
+    struct mod_stats_domain_stats_data *const *se_stats;
+    const uint32_t *se_curr_level;
     struct mod_stats_level_stats *level_stats;
-    struct mod_stats_info *stats;
-    struct mod_stats_map *se_map;
-    uint64_t ts_now_us, delta_t;
-    uint32_t curr_level_id;
-    fwk_id_t domain_id;
-    int stats_id, i;
-    unsigned int flags;
-
-    stats = get_module_stats_info(module_id);
-    if (stats == NULL) {
-        return;
-    }
+    struct mod_stats_domain_stats_data *domain_stats;
+    uint64_t ts_now_us;
+    int stats_id, stats_count;
 
-    if (stats->mode != STATS_INITIALIZED) {
+    if ((stats == NULL) || (stats->mode != STATS_INITIALIZED)) {
         return;
     }
 
-    for (i = 0; i < stats->context->se_total_num; i++) {
-        domain_id = FWK_ID_ELEMENT(fwk_id_get_module_idx(module_id), i);
-        domain_stats = get_domain_section_data(module_id, domain_id);
-        if (domain_stats == NULL) {
-            continue;
-        }
+    /*
+     * Tracked domains occupy the first entries of the map, so walk them
+     * directly instead of translating every domain identifier.
+     */
+    se_stats = stats->context->se_stats_map->se_stats;
+    se_curr_level = stats->context->se_stats_map->se_curr_level;
+    stats_count = stats->context->last_stats_id;
 
-        se_map = stats->context->se_stats_map;
-        stats_id = stats->context->se_index_map[i];
+    ts_now_us = _get_curret_ts_us();
 
-        flags = fwk_interrupt_global_disable();
+    stats_write_begin(&stats->desc_header->sequence);
 
-        ts_now_us = _get_curret_ts_us();
+    for (stats_id = 0; stats_id < stats_count; stats_id++) {
+        domain_stats = se_stats[stats_id];
 
         /* Update current operation level statistics */
-        delta_t = ts_now_us - domain_stats->ts_last_change_us;
-
-        curr_level_id = se_map->se_curr_level[stats_id];
-        level_stats = &domain_stats->level[curr_level_id];
-        level_stats->total_residency_us += delta_t;
+        level_stats = &domain_stats->level[se_curr_level[stats_id]];
+        level_stats->total_residency_us +=
+            ts_now_us - domain_stats->ts_last_change_us;
         domain_stats->ts_last_change_us = ts_now_us;
-
-        fwk_interrupt_global_enable(flags);
     }
 
+    stats_write_end(&stats->desc_header->sequence);
 }
 
 static void periodic_update_callback(uintptr_t param)
 {
-    /* Update current level stats in all tracked domains in the perf module */
-    update_all_domains_current_level(fwk_module_id_scmi_perf);
+    struct fwk_event_light event;
 
-    /* Update current level stats in all tracked domains in the power module */
-    update_all_domains_current_level(fwk_module_id_scmi_power_domain);
-}
+    /* Defer the update to the event context, where the other writers run */
+    if (stats_ctx.update_pending) {
+        return;
+    }
 
-static int register_module_stats(fwk_id_t module_id)
-{
-    return FWK_SUCCESS;
+    event = (struct fwk_event_light){
+        .id = stats_event_id_update,
+        .source_id = fwk_module_id_statistics,
+        .target_id = fwk_module_id_statistics,
+    };
+
+    stats_ctx.update_pending = true;
+
+    if (fwk_put_event(&event) != FWK_SUCCESS) {
+        stats_ctx.update_pending = false;
+    }
 }
 
 static int stats_init(fwk_id_t module_id, unsigned int element_count,
@@ -500,7 +759,8 @@ static int stats_init(fwk_id_t module_id, unsigned int element_count,
 {
     const struct mod_stats_config_info *config = data;
 
-    if (config == NULL || config->stats_region_size == 0) {
+    if (config == NULL ||
+        config->stats_region_size < sizeof(struct mod_stats_region_header)) {
         FWK_LOG_INFO("STATS: statistics are not configured");
         return FWK_E_SUPPORT;
     }
@@ -515,7 +775,19 @@ static int stats_init(fwk_id_t module_id, unsigned int element_count,
         (void *)config->scp_stats_addr, 0, config->stats_region_size);
 
     stats_ctx.config = config;
-    stats_ctx.avail_mem_offset = 0;
+
+    if (config->max_entries != 0) {
+        stats_ctx.entries =
+            fwk_mm_calloc(config->max_entries, sizeof(struct stats_entry));
+    }
+
+    stats_ctx.region =
+        (struct mod_stats_region_header *)config->scp_stats_addr;
+    stats_ctx.region->signature = MOD_STATS_REGION_SIGNATURE;
+    stats_ctx.region->revision = MOD_STATS_REGION_REVISION;
+    stats_ctx.region->size = sizeof(struct mod_stats_region_header);
+
+    stats_ctx.avail_mem_offset = sizeof(struct mod_stats_region_header);
 
     return FWK_SUCCESS;
 }
@@ -571,6 +843,26 @@ static int stats_bind(fwk_id_t id, unsigned int round)
     return FWK_SUCCESS;
 }
 
+static int stats_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    unsigned int module_idx;
+
+    if (!fwk_id_is_equal(event->id, stats_event_id_update)) {
+        return FWK_E_PARAM;
+    }
+
+    stats_ctx.update_pending = false;
+
+    /* Update current level stats in all tracked domains of every module */
+    for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
+        update_all_domains_current_level(stats_ctx.module_stats[module_idx]);
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int process_bind_request(fwk_id_t source_id,
     fwk_id_t target_id,
     fwk_id_t api_id,
@@ -581,21 +873,10 @@ static int process_bind_request(fwk_id_t source_id,
         return FWK_E_PARAM;
     }
 
+    /* Any module can publish its statistics */
     *api = &mod_statistics_api;
 
-    /* Request from SCMI Performance domain statistics */
-    if (fwk_id_get_module_idx(source_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_perf)) {
-        return register_module_stats(fwk_module_id_scmi_perf);
-    }
-
-    /* Request from SCMI Power domain statistics*/
-    if (fwk_id_get_module_idx(source_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_power_domain)) {
-        return register_module_stats(fwk_module_id_scmi_power_domain);
-    }
-
-    return FWK_E_PARAM;
+    return FWK_SUCCESS;
 }
 
 const struct fwk_module module_statistics = {
@@ -606,5 +887,7 @@ const struct fwk_module module_statistics = {
     .start = stats_start,
     .bind = stats_bind,
     .process_bind_request = process_bind_request,
+    .process_event = stats_process_event,
     .api_count = (unsigned int)MOD_STATS_API_IDX_COUNT,
+    .event_count = (unsigned int)STATS_EVENT_IDX_COUNT,
 };
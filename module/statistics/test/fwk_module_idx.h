@@ -0,0 +1,37 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TEST_FWK_MODULE_MODULE_IDX_H
+#define TEST_FWK_MODULE_MODULE_IDX_H
+
+#include <fwk_id.h>
+
+enum fwk_module_idx {
+    FWK_MODULE_IDX_TIMER,
+    FWK_MODULE_IDX_SCMI_PERF,
+    FWK_MODULE_IDX_SCMI_POWER_DOMAIN,
+    FWK_MODULE_IDX_STATISTICS,
+    FWK_MODULE_IDX_FAKE,
+    FWK_MODULE_IDX_COUNT,
+};
+
+static const fwk_id_t fwk_module_id_timer =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_TIMER);
+
+static const fwk_id_t fwk_module_id_scmi_perf =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI_PERF);
+
+static const fwk_id_t fwk_module_id_scmi_power_domain =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI_POWER_DOMAIN);
+
+static const fwk_id_t fwk_module_id_statistics =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_STATISTICS);
+
+static const fwk_id_t fwk_module_id_fake =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_FAKE);
+
+#endif /* TEST_FWK_MODULE_MODULE_IDX_H */
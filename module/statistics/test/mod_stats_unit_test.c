@@ -0,0 +1,343 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <mod_stats.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define FAKE_REGION_SIZE 1024
+#define FAKE_MAX_ENTRIES 3
+
+#define FAKE_TAG_COUNTERS  0x10
+#define FAKE_TAG_HISTOGRAM 0x20
+
+#define HISTOGRAM_BUCKET_COUNT 8
+
+static uint64_t fake_region[FAKE_REGION_SIZE / sizeof(uint64_t)];
+
+static struct stats_entry fake_entries[FAKE_MAX_ENTRIES];
+
+static struct mod_stats_config_info fake_config = {
+    .ap_stats_addr = 0x80000000,
+    .stats_region_size = FAKE_REGION_SIZE,
+    .alarm_id = FWK_ID_NONE_INIT,
+    .max_entries = FAKE_MAX_ENTRIES,
+};
+
+static void *fake_calloc(size_t num, size_t size, int num_calls)
+{
+    return calloc(num, size);
+}
+
+/* Initialize the module with its entry table taken from fake_entries */
+static void stats_init_success(void)
+{
+    fwk_mm_calloc_ExpectAndReturn(
+        FAKE_MAX_ENTRIES, sizeof(struct stats_entry), fake_entries);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, stats_init(fwk_module_id_statistics, 0, &fake_config));
+}
+
+void setUp(void)
+{
+    memset(&stats_ctx, 0, sizeof(stats_ctx));
+    memset(fake_entries, 0, sizeof(fake_entries));
+
+    fake_config.scp_stats_addr = (uintptr_t)fake_region;
+    fake_config.max_entries = FAKE_MAX_ENTRIES;
+}
+
+void tearDown(void)
+{
+}
+
+void utest_stats_init_not_configured(void)
+{
+    unsigned int entry_id;
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_SUPPORT, stats_init(fwk_module_id_statistics, 0, NULL));
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_SUPPORT,
+        stats_add_counters(
+            fwk_module_id_fake, FAKE_TAG_COUNTERS, 1, &entry_id));
+}
+
+void utest_stats_init_region_header(void)
+{
+    struct mod_stats_region_header *region = (void *)fake_region;
+
+    stats_init_success();
+
+    TEST_ASSERT_EQUAL_HEX32(MOD_STATS_REGION_SIGNATURE, region->signature);
+    TEST_ASSERT_EQUAL(MOD_STATS_REGION_REVISION, region->revision);
+    TEST_ASSERT_EQUAL(0, region->section_count);
+    TEST_ASSERT_EQUAL(sizeof(*region), region->size);
+    TEST_ASSERT_EQUAL(0, region->sequence);
+}
+
+void utest_stats_add_entries_up_to_max_entries(void)
+{
+    unsigned int entry_id, idx;
+
+    /* The entry table is only allocated at initialization */
+    stats_init_success();
+
+    for (idx = 0; idx < FAKE_MAX_ENTRIES; idx++) {
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS,
+            stats_add_counters(
+                fwk_module_id_fake, FAKE_TAG_COUNTERS + idx, 1, &entry_id));
+        TEST_ASSERT_EQUAL(idx, entry_id);
+    }
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_NOMEM,
+        stats_add_histogram(
+            fwk_module_id_fake,
+            FAKE_TAG_HISTOGRAM,
+            HISTOGRAM_BUCKET_COUNT,
+            &entry_id));
+    TEST_ASSERT_EQUAL(FAKE_MAX_ENTRIES, stats_ctx.entry_count);
+}
+
+void utest_stats_add_entries_none_configured(void)
+{
+    unsigned int entry_id;
+
+    fake_config.max_entries = 0;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, stats_init(fwk_module_id_statistics, 0, &fake_config));
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_NOMEM,
+        stats_add_counters(
+            fwk_module_id_fake, FAKE_TAG_COUNTERS, 1, &entry_id));
+}
+
+void utest_stats_add_entries_rejected(void)
+{
+    unsigned int entry_id;
+
+    stats_init_success();
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_PARAM,
+        stats_add_counters(
+            fwk_module_id_fake, FAKE_TAG_COUNTERS, 0, &entry_id));
+    TEST_ASSERT_EQUAL(
+        FWK_E_PARAM,
+        stats_add_histogram(
+            fwk_module_id_fake,
+            FAKE_TAG_HISTOGRAM,
+            HISTOGRAM_BUCKET_COUNT,
+            NULL));
+    TEST_ASSERT_EQUAL(
+        FWK_E_NOMEM,
+        stats_add_counters(
+            fwk_module_id_fake,
+            FAKE_TAG_COUNTERS,
+            FAKE_REGION_SIZE / sizeof(uint64_t),
+            &entry_id));
+    TEST_ASSERT_EQUAL(0, stats_ctx.entry_count);
+}
+
+void utest_stats_counter_add(void)
+{
+    struct mod_stats_region_header *region = (void *)fake_region;
+    unsigned int counters_id, histogram_id;
+
+    stats_init_success();
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        stats_add_counters(
+            fwk_module_id_fake, FAKE_TAG_COUNTERS, 2, &counters_id));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        stats_add_histogram(
+            fwk_module_id_fake,
+            FAKE_TAG_HISTOGRAM,
+            HISTOGRAM_BUCKET_COUNT,
+            &histogram_id));
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, stats_counter_add(counters_id, 0, 3));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, stats_counter_add(counters_id, 0, 4));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, stats_counter_add(counters_id, 1, 1));
+
+    TEST_ASSERT_EQUAL_UINT64(7, stats_ctx.entries[counters_id].counters[0]);
+    TEST_ASSERT_EQUAL_UINT64(1, stats_ctx.entries[counters_id].counters[1]);
+
+    /* Every write leaves the sequence even */
+    TEST_ASSERT_EQUAL(6, region->sequence);
+
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, stats_counter_add(counters_id, 2, 1));
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, stats_counter_add(histogram_id, 0, 1));
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, stats_counter_add(FAKE_MAX_ENTRIES, 0, 1));
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, stats_histogram_record(counters_id, 1));
+    TEST_ASSERT_EQUAL(6, region->sequence);
+}
+
+void utest_stats_histogram_record_buckets(void)
+{
+    static const struct {
+        uint64_t value;
+        unsigned int bucket;
+    } records[] = {
+        { 0, 0 },
+        { 1, 1 },
+        { 2, 2 },
+        { 3, 2 },
+        { 4, 3 },
+        { 63, 6 },
+        /* 2^6 opens the last bucket, which also takes everything above */
+        { 64, 7 },
+        { 1000, 7 },
+        { UINT64_C(1) << 40, 7 },
+    };
+    struct mod_stats_histogram *histogram;
+    uint64_t expected[HISTOGRAM_BUCKET_COUNT] = { 0 };
+    uint64_t total = 0;
+    unsigned int entry_id, idx;
+
+    stats_init_success();
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        stats_add_histogram(
+            fwk_module_id_fake,
+            FAKE_TAG_HISTOGRAM,
+            HISTOGRAM_BUCKET_COUNT,
+            &entry_id));
+
+    for (idx = 0; idx < FWK_ARRAY_SIZE(records); idx++) {
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS, stats_histogram_record(entry_id, records[idx].value));
+        expected[records[idx].bucket]++;
+        total += records[idx].value;
+    }
+
+    histogram = stats_ctx.entries[entry_id].histogram;
+
+    TEST_ASSERT_EQUAL_UINT64(FWK_ARRAY_SIZE(records), histogram->count);
+    TEST_ASSERT_EQUAL_UINT64(total, histogram->total);
+    TEST_ASSERT_EQUAL_UINT64(UINT64_C(1) << 40, histogram->max);
+
+    for (idx = 0; idx < HISTOGRAM_BUCKET_COUNT; idx++) {
+        TEST_ASSERT_EQUAL_UINT64(expected[idx], histogram->buckets[idx]);
+    }
+}
+
+void utest_stats_region_section_walk(void)
+{
+    static const struct {
+        enum mod_stats_section_type type;
+        unsigned int module_idx;
+        uint32_t id;
+        uint32_t count;
+    } expected[] = {
+        { MOD_STATS_SECTION_TYPE_DESC, FWK_MODULE_IDX_FAKE, 0x4C45564C, 2 },
+        { MOD_STATS_SECTION_TYPE_RESIDENCY, FWK_MODULE_IDX_FAKE, 1, 3 },
+        { MOD_STATS_SECTION_TYPE_COUNTERS,
+          FWK_MODULE_IDX_FAKE,
+          FAKE_TAG_COUNTERS,
+          5 },
+        { MOD_STATS_SECTION_TYPE_HISTOGRAM,
+          FWK_MODULE_IDX_FAKE,
+          FAKE_TAG_HISTOGRAM,
+          HISTOGRAM_BUCKET_COUNT },
+    };
+    struct mod_stats_region_header *region = (void *)fake_region;
+    struct mod_stats_section_header *section;
+    uintptr_t offset;
+    unsigned int entry_id, idx;
+
+    stats_init_success();
+
+    fwk_mm_calloc_StubWithCallback(fake_calloc);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, stats_init_module(fwk_module_id_fake, 2, 1));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        stats_add_domain(
+            fwk_module_id_fake, FWK_ID_ELEMENT(FWK_MODULE_IDX_FAKE, 1), 3));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        stats_add_counters(
+            fwk_module_id_fake, FAKE_TAG_COUNTERS, 5, &entry_id));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        stats_add_histogram(
+            fwk_module_id_fake,
+            FAKE_TAG_HISTOGRAM,
+            HISTOGRAM_BUCKET_COUNT,
+            &entry_id));
+
+    TEST_ASSERT_EQUAL(FWK_ARRAY_SIZE(expected), region->section_count);
+
+    offset = sizeof(*region);
+    for (idx = 0; idx < region->section_count; idx++) {
+        section = (void *)((uintptr_t)fake_region + offset);
+
+        TEST_ASSERT_EQUAL(expected[idx].type, section->type);
+        TEST_ASSERT_EQUAL(expected[idx].module_idx, section->module_idx);
+        TEST_ASSERT_EQUAL_HEX32(expected[idx].id, section->id);
+        TEST_ASSERT_EQUAL(expected[idx].count, section->count);
+        TEST_ASSERT_EQUAL(0, section->size % sizeof(uint64_t));
+        TEST_ASSERT_TRUE(section->size > sizeof(*section));
+
+        offset += section->size;
+    }
+
+    TEST_ASSERT_EQUAL(region->size, offset);
+    TEST_ASSERT_EQUAL(stats_ctx.avail_mem_offset, offset);
+}
+
+int stats_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(utest_stats_init_not_configured);
+    RUN_TEST(utest_stats_init_region_header);
+
+    RUN_TEST(utest_stats_add_entries_up_to_max_entries);
+    RUN_TEST(utest_stats_add_entries_none_configured);
+    RUN_TEST(utest_stats_add_entries_rejected);
+
+    RUN_TEST(utest_stats_counter_add);
+    RUN_TEST(utest_stats_histogram_record_buckets);
+
+    RUN_TEST(utest_stats_region_section_walk);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return stats_test_main();
+}
+#endif
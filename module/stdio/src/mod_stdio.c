@@ -124,6 +124,42 @@ static int mod_stdio_putc(const struct fwk_io_stream *stream, char ch)
     return FWK_SUCCESS;
 }
 
+static int mod_stdio_read(
+    const struct fwk_io_stream *stream,
+    char *buffer,
+    size_t size,
+    size_t *read)
+{
+    struct mod_stdio_element_ctx *ctx =
+        &mod_stdio_ctx.elements[fwk_id_get_element_idx(stream->id)];
+
+    *read = fread(buffer, sizeof(buffer[0]), size, ctx->stream);
+
+    if (ferror(ctx->stream))
+        return FWK_E_OS;
+    else if (*read == 0)
+        return FWK_PENDING;
+
+    return FWK_SUCCESS;
+}
+
+static int mod_stdio_write(
+    const struct fwk_io_stream *stream,
+    const char *buffer,
+    size_t size,
+    size_t *written)
+{
+    struct mod_stdio_element_ctx *ctx =
+        &mod_stdio_ctx.elements[fwk_id_get_element_idx(stream->id)];
+
+    *written = fwrite(buffer, sizeof(buffer[0]), size, ctx->stream);
+
+    if (ferror(ctx->stream))
+        return FWK_E_OS;
+
+    return FWK_SUCCESS;
+}
+
 static int mod_stdio_close(const struct fwk_io_stream *stream)
 {
     int status = FWK_SUCCESS;
@@ -154,6 +190,8 @@ const struct fwk_module module_stdio = {
         .open = mod_stdio_open,
         .getch = mod_stdio_getc,
         .putch = mod_stdio_putc,
+        .read = mod_stdio_read,
+        .write = mod_stdio_write,
         .close = mod_stdio_close,
     },
 };
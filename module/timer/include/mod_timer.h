@@ -82,6 +82,17 @@ struct mod_timer_dev_config {
 
     /*! Timer device IRQ number */
     unsigned int timer_irq;
+
+    /*!
+     * \brief Alarm coalescing slack in microseconds.
+     *
+     * \details When the timer interrupt fires, every alarm due within this
+     *      many microseconds of the current counter value is triggered in the
+     *      same pass instead of re-arming the device for each one. Alarms may
+     *      therefore fire up to this long before their nominal deadline.
+     *      Zero, the default, only triggers alarms that have already expired.
+     */
+    uint32_t slack_us;
 };
 
 /*!
@@ -11,10 +11,8 @@
 #include <mod_timer.h>
 
 #include <fwk_assert.h>
-#include <fwk_dlist.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
-#include <fwk_list.h>
 #include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
@@ -36,14 +34,23 @@ struct timer_dev_ctx {
     fwk_id_t driver_dev_id;
     /* Storage for all alarms */
     struct alarm_sub_element_ctx *alarm_pool;
-    /* Queue of active alarms */
-    struct fwk_dlist alarms_active;
+    /* Number of alarms in the pool */
+    unsigned int alarm_count;
+    /*
+     * Queue of active alarms, kept as a binary min-heap ordered by timestamp
+     * so that the next alarm to expire is always at index zero.
+     */
+    struct alarm_sub_element_ctx **alarms_active;
+    /* Number of alarms in the active queue */
+    unsigned int active_count;
+    /* Coalescing slack in timer ticks */
+    uint64_t slack_ticks;
 };
 
 /* Alarm item context (sub-element) */
 struct alarm_sub_element_ctx {
-    /* List node */
-    struct fwk_dlist_node node;
+    /* Position of this alarm in the active queue when activated */
+    unsigned int heap_idx;
     /* Time between starting this alarm and it triggering */
     uint32_t microseconds;
     /* Timestamp of the time this alarm will trigger */
@@ -148,6 +155,74 @@ static int _remaining(
     return FWK_SUCCESS;
 }
 
+static bool _alarm_before(
+    const struct alarm_sub_element_ctx *a,
+    const struct alarm_sub_element_ctx *b)
+{
+    return a->timestamp < b->timestamp;
+}
+
+static void _heap_place(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm,
+    unsigned int idx)
+{
+    ctx->alarms_active[idx] = alarm;
+    alarm->heap_idx = idx;
+}
+
+static void _heap_sift_up(struct timer_dev_ctx *ctx, unsigned int idx)
+{
+    struct alarm_sub_element_ctx *alarm = ctx->alarms_active[idx];
+    unsigned int parent;
+
+    while (idx > 0) {
+        parent = (idx - 1) / 2;
+        if (!_alarm_before(alarm, ctx->alarms_active[parent])) {
+            break;
+        }
+
+        _heap_place(ctx, ctx->alarms_active[parent], idx);
+        idx = parent;
+    }
+
+    _heap_place(ctx, alarm, idx);
+}
+
+static void _heap_sift_down(struct timer_dev_ctx *ctx, unsigned int idx)
+{
+    struct alarm_sub_element_ctx *alarm = ctx->alarms_active[idx];
+    unsigned int child;
+
+    for (;;) {
+        child = (2 * idx) + 1;
+        if (child >= ctx->active_count) {
+            break;
+        }
+
+        if (((child + 1) < ctx->active_count) &&
+            _alarm_before(
+                ctx->alarms_active[child + 1], ctx->alarms_active[child])) {
+            child++;
+        }
+
+        if (!_alarm_before(ctx->alarms_active[child], alarm)) {
+            break;
+        }
+
+        _heap_place(ctx, ctx->alarms_active[child], idx);
+        idx = child;
+    }
+
+    _heap_place(ctx, alarm, idx);
+}
+
+static struct alarm_sub_element_ctx *_active_queue_head(
+    const struct timer_dev_ctx *ctx)
+{
+    return (ctx->active_count == 0) ? NULL : ctx->alarms_active[0];
+}
+
 static void _configure_timer_with_next_alarm(struct timer_dev_ctx *ctx)
 {
     int status;
@@ -155,8 +230,7 @@ static void _configure_timer_with_next_alarm(struct timer_dev_ctx *ctx)
 
     fwk_assert(ctx != NULL);
 
-    alarm_head =
-        (struct alarm_sub_element_ctx *)fwk_list_head(&ctx->alarms_active);
+    alarm_head = _active_queue_head(ctx);
     if (alarm_head != NULL) {
         /* Configure timer device */
         status =
@@ -176,32 +250,43 @@ static void _insert_alarm_ctx_into_active_queue(
     struct timer_dev_ctx *ctx,
     struct alarm_sub_element_ctx *alarm_new)
 {
-    struct fwk_dlist_node *alarm_node;
-    struct alarm_sub_element_ctx *alarm;
-
     fwk_assert(ctx != NULL);
     fwk_assert(alarm_new != NULL);
+    fwk_assert(ctx->active_count < ctx->alarm_count);
 
-    /*
-     * Search though the active queue to find the correct place to insert the
-     * new alarm item
-     */
-    alarm_node = fwk_list_head(&ctx->alarms_active);
-    alarm = FWK_LIST_GET(alarm_node, struct alarm_sub_element_ctx, node);
-
-    while ((alarm_node != NULL) && (alarm_new->timestamp > alarm->timestamp)) {
-        alarm_node = fwk_list_next(&ctx->alarms_active, alarm_node);
-        alarm = FWK_LIST_GET(alarm_node, struct alarm_sub_element_ctx, node);
-    }
-
-    /* Insert alarm_new just BEFORE the alarm that was found */
-    fwk_list_insert(&ctx->alarms_active,
-                    &(alarm_new->node),
-                    alarm_node);
+    _heap_place(ctx, alarm_new, ctx->active_count++);
+    _heap_sift_up(ctx, alarm_new->heap_idx);
 
     alarm_new->activated = true;
 }
 
+static void _remove_alarm_ctx_from_active_queue(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    struct alarm_sub_element_ctx *last;
+    unsigned int idx;
+
+    fwk_assert(ctx != NULL);
+    fwk_assert(alarm != NULL);
+    fwk_assert(alarm->activated);
+
+    idx = alarm->heap_idx;
+    last = ctx->alarms_active[--ctx->active_count];
+    alarm->activated = false;
+
+    if (last == alarm) {
+        return;
+    }
+
+    /* Move the last alarm into the hole and restore the heap ordering */
+    _heap_place(ctx, last, idx);
+    if ((idx > 0) && _alarm_before(last, ctx->alarms_active[(idx - 1) / 2])) {
+        _heap_sift_up(ctx, idx);
+    } else {
+        _heap_sift_down(ctx, idx);
+    }
+}
 
 /*
  * Functions fulfilling the timer API
@@ -333,7 +418,7 @@ static int get_next_alarm_remaining(fwk_id_t dev_id,
     int status, exit_status;
     const struct timer_dev_ctx *ctx;
     const struct alarm_sub_element_ctx *alarm_ctx;
-    const struct fwk_dlist_node *alarm_ctx_node;
+
     if (has_alarm == NULL) {
         return FWK_E_PARAM;
     }
@@ -353,13 +438,10 @@ static int get_next_alarm_remaining(fwk_id_t dev_id,
         return FWK_E_DEVICE;
     }
 
-    *has_alarm = !fwk_list_is_empty(&ctx->alarms_active);
+    alarm_ctx = _active_queue_head(ctx);
+    *has_alarm = (alarm_ctx != NULL);
 
     if (*has_alarm) {
-        alarm_ctx_node = fwk_list_head(&ctx->alarms_active);
-        alarm_ctx =
-            FWK_LIST_GET(alarm_ctx_node, struct alarm_sub_element_ctx, node);
-
         exit_status = _remaining(ctx, alarm_ctx->timestamp, remaining_ticks);
     } else {
         exit_status = FWK_E_PARAM;
@@ -457,8 +539,7 @@ static int alarm_stop(fwk_id_t alarm_id)
         return status;
     }
 
-    fwk_list_remove(&ctx->alarms_active, (struct fwk_dlist_node *)alarm);
-    alarm->activated = false;
+    _remove_alarm_ctx_from_active_queue(ctx, alarm);
 
     _configure_timer_with_next_alarm(ctx);
 
@@ -539,6 +620,8 @@ static void timer_isr(uintptr_t ctx_ptr)
     struct alarm_sub_element_ctx *alarm;
     struct timer_dev_ctx *ctx = (struct timer_dev_ctx *)ctx_ptr;
     uint64_t timestamp = 0;
+    uint64_t counter = 0;
+    unsigned int fired;
 
     fwk_assert(ctx != NULL);
 
@@ -553,10 +636,7 @@ static void timer_isr(uintptr_t ctx_ptr)
         FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
     }
 
-    alarm =
-        (struct alarm_sub_element_ctx *)fwk_list_pop_head(&ctx->alarms_active);
-
-    if (alarm == NULL) {
+    if (_active_queue_head(ctx) == NULL) {
         if (ctx->driver->overflow_handler != NULL) {
             ctx->driver->overflow_handler(ctx->driver_dev_id);
         } else {
@@ -569,22 +649,47 @@ static void timer_isr(uintptr_t ctx_ptr)
         return;
     }
 
-    alarm->activated = false;
+    /*
+     * The head of the queue is the alarm that raised the interrupt. Every
+     * other alarm due within the coalescing slack is triggered in the same
+     * pass. The number of callbacks per pass is bounded by the pool size so
+     * that a periodic alarm that keeps falling due cannot starve the caller.
+     */
+    for (fired = 0; fired < ctx->alarm_count; fired++) {
+        alarm = _active_queue_head(ctx);
+        if (alarm == NULL) {
+            break;
+        }
 
-    /* Execute the callback function */
-    alarm->callback(alarm->param);
+        if (fired > 0) {
+            if ((fired == 1) &&
+                (ctx->driver->get_counter(ctx->driver_dev_id, &counter) !=
+                 FWK_SUCCESS)) {
+                break;
+            }
 
-    if (alarm->periodic && alarm->started) {
-        /* Put this alarm back into the active queue */
-        status = _time_to_timestamp(ctx, alarm->microseconds, &timestamp);
+            if (alarm->timestamp > (counter + ctx->slack_ticks)) {
+                break;
+            }
+        }
 
-        if (status == FWK_SUCCESS) {
-            alarm->timestamp += timestamp;
-            _insert_alarm_ctx_into_active_queue(ctx, alarm);
-        } else {
-            FWK_LOG_ERR(
-                "[Timer] Error: Periodic alarm could not be added "
-                "back into queue.");
+        _remove_alarm_ctx_from_active_queue(ctx, alarm);
+
+        /* Execute the callback function */
+        alarm->callback(alarm->param);
+
+        if (alarm->periodic && alarm->started) {
+            /* Put this alarm back into the active queue */
+            status = _time_to_timestamp(ctx, alarm->microseconds, &timestamp);
+
+            if (status == FWK_SUCCESS) {
+                alarm->timestamp += timestamp;
+                _insert_alarm_ctx_into_active_queue(ctx, alarm);
+            } else {
+                FWK_LOG_ERR(
+                    "[Timer] Error: Periodic alarm could not be added "
+                    "back into queue.");
+            }
         }
     }
 
@@ -617,6 +722,9 @@ static int timer_device_init(fwk_id_t element_id, unsigned int alarm_count,
     if (alarm_count > 0) {
         ctx->alarm_pool =
             fwk_mm_calloc(alarm_count, sizeof(struct alarm_sub_element_ctx));
+        ctx->alarms_active =
+            fwk_mm_calloc(alarm_count, sizeof(ctx->alarms_active[0]));
+        ctx->alarm_count = alarm_count;
     }
 
     return FWK_SUCCESS;
@@ -711,7 +819,12 @@ static int timer_start(fwk_id_t id)
 
     ctx = ctx_table + fwk_id_get_element_idx(id);
 
-    fwk_list_init(&ctx->alarms_active);
+    ctx->active_count = 0;
+
+    status = _time_to_timestamp(ctx, ctx->config->slack_us, &ctx->slack_ticks);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
 
     status = fwk_interrupt_set_isr_param(
         ctx->config->timer_irq, timer_isr, (uintptr_t)ctx);
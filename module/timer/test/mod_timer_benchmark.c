@@ -0,0 +1,185 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_interrupt.h>
+#include <Mockfwk_module.h>
+
+#include <mod_timer.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include <stdio.h>
+#include <time.h>
+
+#include UNIT_TEST_SRC
+
+/* The fake counter runs at 1MHz so that one tick is one microsecond */
+#define FAKE_TIMER_FREQUENCY 1000000
+
+#define FAKE_TIMER_IRQ 42
+
+/* Number of interrupts measured per alarm count */
+#define BENCHMARK_ISR_COUNT 20000
+
+static uint64_t fake_counter;
+static uint64_t fake_compare;
+
+static unsigned int fired_count;
+
+static int fake_enable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_disable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_get_counter(fwk_id_t dev_id, uint64_t *value)
+{
+    *value = fake_counter;
+    return FWK_SUCCESS;
+}
+
+static int fake_set_timer(fwk_id_t dev_id, uint64_t timestamp)
+{
+    fake_compare = timestamp;
+    return FWK_SUCCESS;
+}
+
+static int fake_get_frequency(fwk_id_t dev_id, uint32_t *value)
+{
+    *value = FAKE_TIMER_FREQUENCY;
+    return FWK_SUCCESS;
+}
+
+static struct mod_timer_driver_api fake_driver = {
+    .name = "fake",
+    .enable = fake_enable,
+    .disable = fake_disable,
+    .set_timer = fake_set_timer,
+    .get_counter = fake_get_counter,
+    .get_frequency = fake_get_frequency,
+};
+
+static struct mod_timer_dev_config dev_config = {
+    .id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DRIVER, 0),
+    .timer_irq = FAKE_TIMER_IRQ,
+};
+
+static void alarm_callback(uintptr_t param)
+{
+    fired_count++;
+}
+
+static void setup_device(unsigned int alarm_count)
+{
+    fwk_id_t element_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, timer_init(fwk_module_id_timer, 1, NULL));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, timer_device_init(element_id, alarm_count, &dev_config));
+
+    ctx_table[0].driver = &fake_driver;
+    ctx_table[0].driver_dev_id = dev_config.id;
+
+    fwk_module_is_valid_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_set_isr_param_IgnoreAndReturn(FWK_SUCCESS);
+    fwk_interrupt_enable_IgnoreAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, timer_start(element_id));
+}
+
+/* Advance the counter to the programmed compare value and take the IRQ */
+static void fire_next_interrupt(void)
+{
+    fake_counter = FWK_MAX(fake_counter, fake_compare);
+    timer_isr((uintptr_t)&ctx_table[0]);
+}
+
+void setUp(void)
+{
+    fake_counter = 0;
+    fake_compare = 0;
+    fired_count = 0;
+
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_get_current_IgnoreAndReturn(FWK_E_STATE);
+    fwk_interrupt_clear_pending_IgnoreAndReturn(FWK_SUCCESS);
+}
+
+void tearDown(void)
+{
+}
+
+/*
+ * Measure the cost of servicing the timer interrupt as the number of periodic
+ * alarms sharing the device grows. Each alarm uses a distinct period so that
+ * every interrupt re-inserts alarms into a fully populated queue.
+ */
+void benchmark_timer_isr_cost(void)
+{
+    static const unsigned int alarm_counts[] = { 4, 16, 64, 256 };
+    unsigned int count_idx, alarm_count, idx;
+    unsigned int isr_count;
+    clock_t start, elapsed;
+
+    for (count_idx = 0; count_idx < FWK_ARRAY_SIZE(alarm_counts);
+         count_idx++) {
+        alarm_count = alarm_counts[count_idx];
+
+        fake_counter = 0;
+        fired_count = 0;
+        setup_device(alarm_count);
+
+        for (idx = 0; idx < alarm_count; idx++) {
+            TEST_ASSERT_EQUAL(
+                FWK_SUCCESS,
+                alarm_start(
+                    FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_TIMER, 0, idx),
+                    10 + idx,
+                    MOD_TIMER_ALARM_TYPE_PERIODIC,
+                    alarm_callback,
+                    (uintptr_t)idx));
+        }
+
+        start = clock();
+        for (isr_count = 0; isr_count < BENCHMARK_ISR_COUNT; isr_count++) {
+            fire_next_interrupt();
+        }
+        elapsed = clock() - start;
+
+        TEST_ASSERT_EQUAL(alarm_count, ctx_table[0].active_count);
+        TEST_ASSERT_GREATER_OR_EQUAL(BENCHMARK_ISR_COUNT, fired_count);
+
+        printf(
+            "timer isr: %4u alarms, %u interrupts, %u callbacks, "
+            "%.1f ns/interrupt\n",
+            alarm_count,
+            BENCHMARK_ISR_COUNT,
+            fired_count,
+            ((double)elapsed * 1e9) / CLOCKS_PER_SEC / BENCHMARK_ISR_COUNT);
+    }
+}
+
+int timer_benchmark_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(benchmark_timer_isr_cost);
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return timer_benchmark_main();
+}
@@ -0,0 +1,346 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_interrupt.h>
+#include <Mockfwk_module.h>
+
+#include <mod_timer.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+/* The fake counter runs at 1MHz so that one tick is one microsecond */
+#define FAKE_TIMER_FREQUENCY 1000000
+
+#define FAKE_TIMER_IRQ 42
+
+/* Largest alarm pool addressable through a sub-element identifier */
+#define ALARM_COUNT_MAX 256
+
+static uint64_t fake_counter;
+static uint64_t fake_compare;
+static unsigned int fake_disable_calls;
+
+static unsigned int fired_count;
+static uintptr_t fired_order[ALARM_COUNT_MAX];
+static uint64_t fired_at[ALARM_COUNT_MAX];
+
+static int fake_enable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_disable(fwk_id_t dev_id)
+{
+    fake_disable_calls++;
+    return FWK_SUCCESS;
+}
+
+static int fake_get_counter(fwk_id_t dev_id, uint64_t *value)
+{
+    *value = fake_counter;
+    return FWK_SUCCESS;
+}
+
+static int fake_set_timer(fwk_id_t dev_id, uint64_t timestamp)
+{
+    fake_compare = timestamp;
+    return FWK_SUCCESS;
+}
+
+static int fake_get_frequency(fwk_id_t dev_id, uint32_t *value)
+{
+    *value = FAKE_TIMER_FREQUENCY;
+    return FWK_SUCCESS;
+}
+
+static struct mod_timer_driver_api fake_driver = {
+    .name = "fake",
+    .enable = fake_enable,
+    .disable = fake_disable,
+    .set_timer = fake_set_timer,
+    .get_counter = fake_get_counter,
+    .get_frequency = fake_get_frequency,
+};
+
+static struct mod_timer_dev_config dev_config = {
+    .id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DRIVER, 0),
+    .timer_irq = FAKE_TIMER_IRQ,
+};
+
+static void alarm_callback(uintptr_t param)
+{
+    if (fired_count < FWK_ARRAY_SIZE(fired_order)) {
+        fired_order[fired_count] = param;
+        fired_at[fired_count] = fake_counter;
+    }
+    fired_count++;
+}
+
+static fwk_id_t alarm_id(unsigned int idx)
+{
+    return FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_TIMER, 0, idx);
+}
+
+static void setup_device(unsigned int alarm_count, uint32_t slack_us)
+{
+    fwk_id_t element_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0);
+
+    dev_config.slack_us = slack_us;
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, timer_init(fwk_module_id_timer, 1, NULL));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, timer_device_init(element_id, alarm_count, &dev_config));
+
+    ctx_table[0].driver = &fake_driver;
+    ctx_table[0].driver_dev_id = dev_config.id;
+
+    fwk_module_is_valid_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_set_isr_param_IgnoreAndReturn(FWK_SUCCESS);
+    fwk_interrupt_enable_IgnoreAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, timer_start(element_id));
+}
+
+static void start_alarm(
+    unsigned int idx,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type)
+{
+    int status;
+
+    status = alarm_start(
+        alarm_id(idx), milliseconds, type, alarm_callback, (uintptr_t)idx);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+/* Advance the counter to the programmed compare value and take the IRQ */
+static void fire_next_interrupt(void)
+{
+    fake_counter = FWK_MAX(fake_counter, fake_compare);
+    timer_isr((uintptr_t)&ctx_table[0]);
+}
+
+void setUp(void)
+{
+    fake_counter = 0;
+    fake_compare = 0;
+    fake_disable_calls = 0;
+    fired_count = 0;
+
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_get_current_IgnoreAndReturn(FWK_E_STATE);
+    fwk_interrupt_clear_pending_IgnoreAndReturn(FWK_SUCCESS);
+}
+
+void tearDown(void)
+{
+}
+
+void test_timer_alarms_fire_in_deadline_order(void)
+{
+    static const unsigned int delays_ms[] = { 7, 3, 9, 1, 5, 2, 8, 4, 6 };
+    unsigned int idx;
+
+    setup_device(FWK_ARRAY_SIZE(delays_ms), 0);
+
+    for (idx = 0; idx < FWK_ARRAY_SIZE(delays_ms); idx++) {
+        start_alarm(idx, delays_ms[idx], MOD_TIMER_ALARM_TYPE_ONCE);
+    }
+
+    for (idx = 0; idx < FWK_ARRAY_SIZE(delays_ms); idx++) {
+        fire_next_interrupt();
+        TEST_ASSERT_EQUAL(idx + 1, fired_count);
+        TEST_ASSERT_EQUAL(idx + 1, delays_ms[fired_order[idx]]);
+        TEST_ASSERT_EQUAL((idx + 1) * 1000, fired_at[idx]);
+    }
+
+    TEST_ASSERT_EQUAL(0, ctx_table[0].active_count);
+}
+
+void test_timer_isr_fires_every_expired_alarm(void)
+{
+    setup_device(4, 0);
+
+    start_alarm(0, 1, MOD_TIMER_ALARM_TYPE_ONCE);
+    start_alarm(1, 2, MOD_TIMER_ALARM_TYPE_ONCE);
+    start_alarm(2, 3, MOD_TIMER_ALARM_TYPE_ONCE);
+    start_alarm(3, 10, MOD_TIMER_ALARM_TYPE_ONCE);
+
+    /* The interrupt was serviced late: three alarms are already due */
+    fake_counter = 3500;
+    timer_isr((uintptr_t)&ctx_table[0]);
+
+    TEST_ASSERT_EQUAL(3, fired_count);
+    TEST_ASSERT_EQUAL(0, fired_order[0]);
+    TEST_ASSERT_EQUAL(1, fired_order[1]);
+    TEST_ASSERT_EQUAL(2, fired_order[2]);
+    TEST_ASSERT_EQUAL(1, ctx_table[0].active_count);
+    TEST_ASSERT_EQUAL(10000, fake_compare);
+}
+
+void test_timer_isr_coalesces_alarms_within_slack(void)
+{
+    setup_device(4, 500);
+
+    start_alarm(0, 1, MOD_TIMER_ALARM_TYPE_ONCE);
+    fake_counter = 200;
+    start_alarm(1, 1, MOD_TIMER_ALARM_TYPE_ONCE);
+    fake_counter = 400;
+    start_alarm(2, 1, MOD_TIMER_ALARM_TYPE_ONCE);
+    fake_counter = 600;
+    start_alarm(3, 1, MOD_TIMER_ALARM_TYPE_ONCE);
+
+    TEST_ASSERT_EQUAL(1000, fake_compare);
+
+    /* Alarms due at 1000, 1200 and 1400 share one interrupt */
+    fire_next_interrupt();
+    TEST_ASSERT_EQUAL(3, fired_count);
+    TEST_ASSERT_EQUAL(1600, fake_compare);
+
+    fire_next_interrupt();
+    TEST_ASSERT_EQUAL(4, fired_count);
+    TEST_ASSERT_EQUAL(3, fired_order[3]);
+}
+
+void test_timer_alarm_stop_removes_from_queue(void)
+{
+    unsigned int idx;
+
+    setup_device(6, 0);
+
+    for (idx = 0; idx < 6; idx++) {
+        start_alarm(idx, idx + 1, MOD_TIMER_ALARM_TYPE_ONCE);
+    }
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(0)));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(3)));
+    TEST_ASSERT_EQUAL(FWK_E_STATE, alarm_stop(alarm_id(3)));
+    TEST_ASSERT_EQUAL(4, ctx_table[0].active_count);
+    TEST_ASSERT_EQUAL(2000, fake_compare);
+
+    fake_counter = 10000;
+    timer_isr((uintptr_t)&ctx_table[0]);
+
+    TEST_ASSERT_EQUAL(4, fired_count);
+    TEST_ASSERT_EQUAL(1, fired_order[0]);
+    TEST_ASSERT_EQUAL(2, fired_order[1]);
+    TEST_ASSERT_EQUAL(4, fired_order[2]);
+    TEST_ASSERT_EQUAL(5, fired_order[3]);
+}
+
+void test_timer_alarm_restart_reorders_queue(void)
+{
+    setup_device(3, 0);
+
+    start_alarm(0, 1, MOD_TIMER_ALARM_TYPE_ONCE);
+    start_alarm(1, 2, MOD_TIMER_ALARM_TYPE_ONCE);
+    start_alarm(2, 3, MOD_TIMER_ALARM_TYPE_ONCE);
+
+    /* Push the earliest alarm to the back of the queue */
+    start_alarm(0, 5, MOD_TIMER_ALARM_TYPE_ONCE);
+    TEST_ASSERT_EQUAL(3, ctx_table[0].active_count);
+    TEST_ASSERT_EQUAL(2000, fake_compare);
+
+    fake_counter = 5000;
+    timer_isr((uintptr_t)&ctx_table[0]);
+
+    TEST_ASSERT_EQUAL(3, fired_count);
+    TEST_ASSERT_EQUAL(1, fired_order[0]);
+    TEST_ASSERT_EQUAL(2, fired_order[1]);
+    TEST_ASSERT_EQUAL(0, fired_order[2]);
+}
+
+void test_timer_periodic_alarm_rearms(void)
+{
+    unsigned int idx;
+
+    setup_device(2, 0);
+
+    start_alarm(0, 2, MOD_TIMER_ALARM_TYPE_PERIODIC);
+    start_alarm(1, 3, MOD_TIMER_ALARM_TYPE_PERIODIC);
+
+    /* Deadlines: 2, 3, 4, 6, 6, 8, 9 ms */
+    for (idx = 0; idx < 6; idx++) {
+        fire_next_interrupt();
+    }
+
+    TEST_ASSERT_EQUAL(7, fired_count);
+    TEST_ASSERT_EQUAL(2000, fired_at[0]);
+    TEST_ASSERT_EQUAL(3000, fired_at[1]);
+    TEST_ASSERT_EQUAL(4000, fired_at[2]);
+    TEST_ASSERT_EQUAL(6000, fired_at[3]);
+    TEST_ASSERT_EQUAL(6000, fired_at[4]);
+    TEST_ASSERT_EQUAL(8000, fired_at[5]);
+    TEST_ASSERT_EQUAL(9000, fired_at[6]);
+    TEST_ASSERT_EQUAL(2, ctx_table[0].active_count);
+}
+
+void test_timer_isr_bounds_callbacks_per_pass(void)
+{
+    setup_device(4, 0);
+
+    /* A zero period alarm is always due; the ISR must still return */
+    start_alarm(0, 0, MOD_TIMER_ALARM_TYPE_PERIODIC);
+    fire_next_interrupt();
+
+    TEST_ASSERT_EQUAL(4, fired_count);
+    TEST_ASSERT_EQUAL(1, ctx_table[0].active_count);
+}
+
+void test_timer_get_next_alarm_remaining(void)
+{
+    fwk_id_t element_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0);
+    bool has_alarm;
+    uint64_t remaining_ticks;
+
+    setup_device(2, 0);
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_PARAM,
+        get_next_alarm_remaining(element_id, &has_alarm, &remaining_ticks));
+    TEST_ASSERT_FALSE(has_alarm);
+
+    start_alarm(0, 5, MOD_TIMER_ALARM_TYPE_ONCE);
+    start_alarm(1, 2, MOD_TIMER_ALARM_TYPE_ONCE);
+    fake_counter = 500;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        get_next_alarm_remaining(element_id, &has_alarm, &remaining_ticks));
+    TEST_ASSERT_TRUE(has_alarm);
+    TEST_ASSERT_EQUAL(1500, remaining_ticks);
+}
+
+int timer_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_timer_alarms_fire_in_deadline_order);
+    RUN_TEST(test_timer_isr_fires_every_expired_alarm);
+    RUN_TEST(test_timer_isr_coalesces_alarms_within_slack);
+    RUN_TEST(test_timer_alarm_stop_removes_from_queue);
+    RUN_TEST(test_timer_alarm_restart_reorders_queue);
+    RUN_TEST(test_timer_periodic_alarm_rearms);
+    RUN_TEST(test_timer_isr_bounds_callbacks_per_pass);
+    RUN_TEST(test_timer_get_next_alarm_remaining);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return timer_test_main();
+}
+#endif
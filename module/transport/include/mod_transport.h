@@ -500,7 +500,8 @@ struct mod_transport_firmware_api {
      *
      * \param channel_id Channel identifier.
      * \param message_header Message header.
-     * \param payload Payload data to write.
+     * \param payload Payload data to write, or NULL if the payload has
+     *      already been written in place using `get_transmit_payload()`.
      * \param size Size of the payload source.
      * \param request_ack_by_interrupt flag to select whether acknowledgement
      * interrupt is required for this message.
@@ -518,6 +519,30 @@ struct mod_transport_firmware_api {
         size_t size,
         bool request_ack_by_interrupt);
 
+    /*!
+     * \brief Get the payload area a message will be transmitted from.
+     *
+     * \details This allows a client to build its message directly in the
+     *      shared mailbox (out-band) or write buffer (in-band) and then send
+     *      it with `transmit()` and a NULL payload, avoiding any intermediate
+     *      copy.
+     *
+     * \param channel_id Channel identifier.
+     * \param[out] payload Pointer to the writable payload area.
+     * \param[out] size Size of the writable payload area in bytes.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+     *      - The `payload` parameter was a null pointer value.
+     *      - The `size` parameter was a null pointer value.
+     * \retval ::FWK_E_BUSY Previous message was not read by agent/platform.
+     * \retval ::FWK_E_SUPPORT The channel transport type is not supported.
+     */
+    int (*get_transmit_payload)(
+        fwk_id_t channel_id,
+        void **payload,
+        size_t *size);
+
     /*!
      * \brief Release the transport channel context lock.
      *
@@ -410,6 +410,58 @@ static int transport_transmit(
         channel_ctx->config->driver_id);
 }
 
+static int transport_get_transmit_payload(
+    fwk_id_t channel_id,
+    void **payload,
+    size_t *size)
+{
+    struct transport_channel_ctx *channel_ctx;
+    struct mod_transport_buffer *buffer = NULL;
+    enum mod_transport_channel_transport_type transport_type;
+
+    if (payload == NULL || size == NULL) {
+        fwk_unexpected();
+        return FWK_E_PARAM;
+    }
+
+    channel_ctx =
+        &transport_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+
+    transport_type = channel_ctx->config->transport_type;
+
+    fwk_assert(transport_type != MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_NONE);
+
+#if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
+    if (transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) {
+        buffer = ((struct mod_transport_buffer *)
+                      channel_ctx->config->out_band_mailbox_address);
+        /*
+         * The payload area belongs to the agent/platform until it has
+         * consumed the previous message, so it cannot be handed out yet.
+         */
+        if ((buffer->status & MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK) ==
+            (uint32_t)0) {
+            return FWK_E_BUSY;
+        }
+    }
+#endif
+
+#if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
+    if (transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_IN_BAND) {
+        buffer = channel_ctx->out;
+    }
+#endif
+
+    if (buffer == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    *payload = buffer->payload;
+    *size = channel_ctx->max_payload_size;
+
+    return FWK_SUCCESS;
+}
+
 static int transport_release_channel_lock(fwk_id_t channel_id)
 {
     struct transport_channel_ctx *channel_ctx;
@@ -467,6 +519,7 @@ static const struct mod_transport_firmware_api transport_firmware_api = {
     .write_payload = transport_write_payload,
     .respond = transport_respond,
     .transmit = transport_transmit,
+    .get_transmit_payload = transport_get_transmit_payload,
     .release_transport_channel_lock = transport_release_channel_lock,
     .trigger_interrupt = transport_trigger_interrupt,
 };
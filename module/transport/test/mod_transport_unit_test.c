@@ -196,6 +196,37 @@ void test_transport_write_payload_valid_param_end(void)
         payload[0], dst_payload[channel_ctx->max_payload_size - 1]);
 }
 
+void test_transport_get_transmit_payload_invalid_param(void)
+{
+    int status;
+    size_t size;
+
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+
+    status = transport_get_transmit_payload(service_id, NULL, &size);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_transport_get_transmit_payload_in_place(void)
+{
+    int status;
+    void *payload;
+    size_t size;
+
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+    struct transport_channel_ctx *channel_ctx =
+        &transport_ctx.channel_ctx_table[FAKE_SERVICE_IDX_OSPM];
+
+    fwk_id_get_element_idx_ExpectAndReturn(service_id, FAKE_SERVICE_IDX_OSPM);
+
+    status = transport_get_transmit_payload(service_id, &payload, &size);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_PTR(channel_ctx->out->payload, payload);
+    TEST_ASSERT_EQUAL(channel_ctx->max_payload_size, size);
+}
+
 int scmi_test_main(void)
 {
     UNITY_BEGIN();
@@ -207,6 +238,8 @@ int scmi_test_main(void)
     RUN_TEST(test_transport_write_payload_invalid_param_offset_beyond_end);
     RUN_TEST(test_transport_write_payload_valid_param_start);
     RUN_TEST(test_transport_write_payload_valid_param_end);
+    RUN_TEST(test_transport_get_transmit_payload_invalid_param);
+    RUN_TEST(test_transport_get_transmit_payload_in_place);
 
     return UNITY_END();
 }
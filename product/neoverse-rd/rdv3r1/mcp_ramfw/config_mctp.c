@@ -11,6 +11,25 @@
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 
+/* Serial binding framing: 3-byte header and 3-byte trailer per packet */
+#define MCTP_SERIAL_FRAMING_SIZE 6
+
+static const struct mod_mctp_pool_config packet_pools[] = {
+    {
+        .block_size = MOD_MCTP_PKTBUF_SIZE(
+            MCTP_PACKET_SIZE(MCTP_BTU),
+            MCTP_SERIAL_FRAMING_SIZE),
+        .block_count = 32,
+    },
+};
+
 struct fwk_module_config config_mctp = {
-    .data = NULL,
+    .data = &((struct mod_mctp_config){
+        .packet_pools = packet_pools,
+        .packet_pool_count = FWK_ARRAY_SIZE(packet_pools),
+        .reassembly_pool = {
+            .block_size = 4096,
+            .block_count = 2,
+        },
+    }),
 };
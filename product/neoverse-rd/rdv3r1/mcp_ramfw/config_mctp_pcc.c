@@ -20,7 +20,7 @@ static const struct fwk_element service_table[] = {
         .data = &((struct mod_mctp_pcc_config) {
             .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TRANSPORT, 0),
             .driver_api_id =
-                FWK_ID_API_INIT(FWK_MODULE_IDX_TRANSPORT, MOD_TRANSPORT_API_IDX_MCTP_PCC),
+                FWK_ID_API_INIT(FWK_MODULE_IDX_TRANSPORT, MOD_TRANSPORT_API_IDX_FIRMWARE),
         }),
     },
     [MCTP_PCC_BIND_SERVICE_API_IDX] = {
@@ -40,7 +40,11 @@ static const struct fwk_element *mctp_serial_get_elem_table(fwk_id_t module_id)
 static const struct mod_mctp_serial_module_config mctp_serial_data = {
     .alarm_id =
         FWK_ID_SUB_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, MCP_ALARM_ELEMENT_IDX, MCP_CFGD_MCTP_ALARM_IDX),
-    .poll_period = 1
+    .poll_period = 1,
+    .rx_irq_enabled = false,
+    .rx_buffer_size = MCTP_SERIAL_DEFAULT_RX_BUFFER_SIZE,
+    .tx_irq_enabled = false,
+    .tx_buffer_size = MCTP_SERIAL_DEFAULT_TX_BUFFER_SIZE,
 };
 
 const struct fwk_module_config config_mctp_serial = {
@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include "mcp_cfgd_timer.h"
+
 #include <mod_mctp_fw.h>
 #include <mod_pldm.h>
 #include <mod_pldm_fw.h>
@@ -92,7 +94,19 @@ static const struct fwk_element *pldm_fw_get_elem_table(fwk_id_t module_id)
     return (const struct fwk_element *)pldm_fw_elem_table;
 }
 
+static const pldm_fw_config_t pldm_fw_config = {
+    /* room for bursts of CPER and sensor events between two polls */
+    .event_queue_size = 4096,
+    .event_alarm_id = FWK_ID_SUB_ELEMENT_INIT(
+        FWK_MODULE_IDX_TIMER,
+        MCP_ALARM_ELEMENT_IDX,
+        MCP_CFGD_PLDM_EVENT_ALARM_IDX),
+    .event_coalesce_window_ms = 10,
+    .event_retry_timeout_ms = 100,
+    .event_retry_count = 3,
+};
+
 struct fwk_module_config config_pldm_fw = {
     .elements = FWK_MODULE_DYNAMIC_ELEMENTS(pldm_fw_get_elem_table),
-
+    .data = &pldm_fw_config,
 };
@@ -16,6 +16,7 @@
 /* Sub-element indexes (alarms) for MCP timer device */
 enum mcp_cfgd_mod_timer_subelement_idx {
     MCP_CFGD_MCTP_ALARM_IDX,
+    MCP_CFGD_PLDM_EVENT_ALARM_IDX,
     SCP_CFGD_MOD_TIMER_SEIDX_DEBUGGER_CLI,
     MCP_CFGD_MOD_TIMER_SEIDX_ALARM_COUNT,
 };
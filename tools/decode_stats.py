@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+#
+# Arm SCP/MCP Software
+# Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""
+    Decode a dump of the statistics region published by the statistics
+    module.
+"""
+import argparse
+import re
+import struct
+import sys
+
+REGION_SIGNATURE = 0x53544154
+REGION_REVISION = 1
+
+# struct mod_stats_region_header
+REGION_HEADER = struct.Struct('<IHHII')
+
+# struct mod_stats_section_header
+SECTION_HEADER = struct.Struct('<HHIII')
+
+# struct mod_stats_desc_header, without the domain offsets
+DESC_HEADER = struct.Struct('<IHHHHI')
+
+# struct mod_stats_domain_stats_data, without the levels
+DOMAIN_STATS = struct.Struct('<HHIQ')
+
+# struct mod_stats_level_stats
+LEVEL_STATS = struct.Struct('<IIQQ')
+
+# struct mod_stats_histogram, without the buckets
+HISTOGRAM = struct.Struct('<QQQ')
+
+SECTION_TYPE_DESC = 0
+SECTION_TYPE_RESIDENCY = 1
+SECTION_TYPE_COUNTERS = 2
+SECTION_TYPE_HISTOGRAM = 3
+
+
+class DecodeError(Exception):
+    pass
+
+
+def tag_name(tag):
+    # Tags are written as 'ABCD' = 0x41424344
+    text = struct.pack('>I', tag)
+    if all(0x20 <= c < 0x7F for c in text):
+        return "'{}'".format(text.decode('ascii'))
+    return '0x{:08x}'.format(tag)
+
+
+def module_name(module_idx, modules):
+    return modules.get(module_idx, 'module {}'.format(module_idx))
+
+
+def read_module_names(path):
+    modules = {}
+    pattern = re.compile(r'FWK_MODULE_IDX_(\w+)\s*=\s*(\d+)')
+
+    with open(path) as idx_file:
+        for match in pattern.finditer(idx_file.read()):
+            if match.group(1) != 'COUNT':
+                modules[int(match.group(2))] = match.group(1).lower()
+
+    return modules
+
+
+def unpack(layout, data, offset):
+    if offset + layout.size > len(data):
+        raise DecodeError('truncated data at offset {}'.format(offset))
+    return layout.unpack_from(data, offset)
+
+
+def decode_desc(data, offset, count):
+    signature, revision, attributes, domain_count, _, sequence = \
+        unpack(DESC_HEADER, data, offset)
+
+    yield '  signature {}, revision {}, {} domains, sequence {}'.format(
+        tag_name(signature), revision, domain_count, sequence)
+
+    if sequence & 1:
+        yield '  warning: dumped while being updated'
+
+
+def decode_residency(data, offset, count):
+    level_count, curr_level_id, _, ts_last_change_us = \
+        unpack(DOMAIN_STATS, data, offset)
+
+    yield '  current level {}, last change at {} us'.format(
+        curr_level_id, ts_last_change_us)
+
+    offset += DOMAIN_STATS.size
+    for _ in range(min(count, level_count)):
+        level_id, _, usage_count, total_residency_us = \
+            unpack(LEVEL_STATS, data, offset)
+        yield '  level {:3}: used {} times, {} us'.format(
+            level_id, usage_count, total_residency_us)
+        offset += LEVEL_STATS.size
+
+
+def decode_counters(data, offset, count):
+    for index in range(count):
+        value, = unpack(struct.Struct('<Q'), data, offset + (8 * index))
+        yield '  [{}] {}'.format(index, value)
+
+
+def decode_histogram(data, offset, count):
+    samples, total, maximum = unpack(HISTOGRAM, data, offset)
+    average = (total // samples) if samples else 0
+
+    yield '  {} values, average {}, max {}'.format(samples, average, maximum)
+
+    offset += HISTOGRAM.size
+    for bucket in range(count):
+        value, = unpack(struct.Struct('<Q'), data, offset + (8 * bucket))
+        if bucket == 0:
+            limit = '= 0'
+        elif bucket == count - 1:
+            limit = '>= {}'.format(1 << (bucket - 1))
+        else:
+            limit = '< {}'.format(1 << bucket)
+        yield '  {:>24}: {}'.format(limit, value)
+
+
+SECTION_DECODERS = {
+    SECTION_TYPE_DESC: ('description', decode_desc),
+    SECTION_TYPE_RESIDENCY: ('residency, domain', decode_residency),
+    SECTION_TYPE_COUNTERS: ('counters', decode_counters),
+    SECTION_TYPE_HISTOGRAM: ('histogram', decode_histogram),
+}
+
+
+def decode(data, modules):
+    signature, revision, section_count, size, sequence = \
+        unpack(REGION_HEADER, data, 0)
+
+    if signature != REGION_SIGNATURE:
+        raise DecodeError('invalid signature 0x{:08x}'.format(signature))
+    if revision != REGION_REVISION:
+        raise DecodeError('unsupported revision {}'.format(revision))
+    if size > len(data):
+        raise DecodeError('region of {} bytes, dump of {} bytes'.format(
+            size, len(data)))
+
+    yield 'statistics region: {} sections, {} bytes, sequence {}'.format(
+        section_count, size, sequence)
+    if sequence & 1:
+        yield 'warning: dumped while being updated'
+
+    offset = REGION_HEADER.size
+    for _ in range(section_count):
+        section_type, module_idx, section_size, section_id, count = \
+            unpack(SECTION_HEADER, data, offset)
+
+        if (section_size < SECTION_HEADER.size) or \
+                (offset + section_size > size):
+            raise DecodeError('invalid section size at offset {}'.format(
+                offset))
+
+        name, decoder = SECTION_DECODERS.get(section_type, (None, None))
+        if decoder is None:
+            yield '{}: unknown section type {}'.format(
+                module_name(module_idx, modules), section_type)
+        else:
+            if section_type == SECTION_TYPE_RESIDENCY:
+                label = '{} {}'.format(name, section_id)
+            else:
+                label = '{} {}'.format(name, tag_name(section_id))
+
+            yield '{}: {}'.format(module_name(module_idx, modules), label)
+            yield from decoder(data, offset + SECTION_HEADER.size, count)
+
+        offset += section_size
+
+
+def parse_args(argv, prog_name):
+    parser = argparse.ArgumentParser(
+        prog=prog_name,
+        description='Decode a dump of the firmware statistics region')
+
+    parser.add_argument('dump',
+                        help='Binary dump of the statistics region.')
+
+    parser.add_argument('-m', '--module-idx', dest='module_idx',
+                        required=False, default=None,
+                        help='fwk_module_idx.h generated by the firmware '
+                             'build, to name the modules.')
+
+    return parser.parse_args(argv)
+
+
+def main(argv=[], prog_name=''):
+    args = parse_args(argv, prog_name)
+
+    modules = {}
+    if args.module_idx is not None:
+        modules = read_module_names(args.module_idx)
+
+    with open(args.dump, 'rb') as dump:
+        data = dump.read()
+
+    try:
+        for line in decode(data, modules):
+            print(line)
+    except DecodeError as error:
+        print('error: {}'.format(error), file=sys.stderr)
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:], sys.argv[0]))
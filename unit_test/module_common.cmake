@@ -5,7 +5,19 @@
 # SPDX-License-Identifier: BSD-3-Clause
 #
 
+# Benchmarks are built from <TEST_FILE>_benchmark.c instead of the unit test
+# source, and only when UNIT_TEST_BENCHMARKS is enabled.
+if(TEST_BENCHMARK)
+    set(${TEST_FILE}_UT_SUFFIX benchmark)
+else()
+    set(${TEST_FILE}_UT_SUFFIX unit_test)
+endif()
+
 if(TEST_ON_HOST)
+    # A test directory may build several targets from the same TEST_FILE
+    unset(${TEST_FILE}_FWK_SRC)
+    unset(${TEST_FILE}_FWK_MOCK_SRC)
+
     # Duplicate list of framework sources to be added to build
     foreach(fwk_src IN LISTS FWK_SRC)
         list(APPEND ${TEST_FILE}_FWK_SRC ${fwk_src})
@@ -18,13 +30,13 @@ if(TEST_ON_HOST)
 
     # Create unit test target
     add_executable(${UNIT_TEST_TARGET}
-                   ${MODULE_UT_SRC}/${TEST_FILE}_unit_test.c)
+                   ${MODULE_UT_SRC}/${TEST_FILE}_${${TEST_FILE}_UT_SUFFIX}.c)
 endif()
 
 if(TEST_ON_TARGET)
     # Add sources to test target
     target_sources(${UNIT_TEST_TARGET}
-                  PRIVATE ${MODULE_UT_SRC}/${TEST_FILE}_unit_test.c)
+                  PRIVATE ${MODULE_UT_SRC}/${TEST_FILE}_${${TEST_FILE}_UT_SUFFIX}.c)
 
     target_compile_definitions(
         ${UNIT_TEST_TARGET}
@@ -107,18 +119,38 @@ if(TEST_ON_HOST)
 
     target_compile_definitions(${UNIT_TEST_TARGET} PUBLIC "PERF_OPT")
 
-    foreach(COMPILE_FLAG IN LISTS EXTRA_COMPILE_FLAGS)
+    if(TEST_BENCHMARK)
+        # Measure optimised code, without profiling or coverage overhead.
+        set(${TEST_FILE}_COMPILE_FLAGS ${EXTRA_COMPILE_FLAGS})
+        list(REMOVE_ITEM ${TEST_FILE}_COMPILE_FLAGS -p --coverage)
+        list(APPEND ${TEST_FILE}_COMPILE_FLAGS -O2)
+    else()
+        set(${TEST_FILE}_COMPILE_FLAGS ${EXTRA_COMPILE_FLAGS})
+    endif()
+
+    foreach(COMPILE_FLAG IN LISTS ${TEST_FILE}_COMPILE_FLAGS)
         target_compile_options(${UNIT_TEST_TARGET} PRIVATE "${COMPILE_FLAG}")
     endforeach()
 
     # Include framework includes
     target_include_directories(${UNIT_TEST_TARGET} PUBLIC "${FWK_INC_ROOT}")
     target_sources(${UNIT_TEST_TARGET} PUBLIC ${SCP_UNITY_SRC})
-    target_link_options(${UNIT_TEST_TARGET}
-                        PRIVATE "LINKER:-wrap=fwk_log_printf --coverage -lgcov")
-    target_link_libraries(${UNIT_TEST_TARGET} PRIVATE gcov)
-    # Add test to CTest
-    add_test(NAME ${UNIT_TEST_TARGET} COMMAND ${UNIT_TEST_TARGET})
+    if(TEST_BENCHMARK)
+        target_link_options(${UNIT_TEST_TARGET}
+                            PRIVATE "LINKER:-wrap=fwk_log_printf")
+        # Benchmarks are not added to CTest; they run via unit_test_benchmarks
+        add_custom_target(run_${UNIT_TEST_TARGET}
+                          COMMAND ${UNIT_TEST_TARGET}
+                          DEPENDS ${UNIT_TEST_TARGET})
+        add_dependencies(unit_test_benchmarks run_${UNIT_TEST_TARGET})
+    else()
+        target_link_options(${UNIT_TEST_TARGET}
+                            PRIVATE "LINKER:-wrap=fwk_log_printf --coverage -lgcov")
+        target_link_libraries(${UNIT_TEST_TARGET} PRIVATE gcov)
+        # Add test to CTest
+        add_test(NAME ${UNIT_TEST_TARGET} COMMAND ${UNIT_TEST_TARGET})
+    endif()
 endif()
 
 unset(MOCK_REPLACEMENTS)
+unset(TEST_BENCHMARK)